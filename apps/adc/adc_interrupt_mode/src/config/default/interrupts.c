@@ -64,6 +64,10 @@
 
 
 void _AD1CH0Interrupt (void);
+void _AD1CH1Interrupt (void);
+void _AD1CH2Interrupt (void);
+void _AD1CH3Interrupt (void);
+void _AD1CMP0Interrupt (void);
 
 // Section: System Interrupt Vector definitions
 
@@ -72,6 +76,26 @@ void __attribute__ (( interrupt, no_auto_psv)) _AD1CH0Interrupt (void)
     AD1CH0_InterruptHandler();
 }
 
+void __attribute__ (( interrupt, no_auto_psv)) _AD1CH1Interrupt (void)
+{
+    AD1CH1_InterruptHandler();
+}
+
+void __attribute__ (( interrupt, no_auto_psv)) _AD1CH2Interrupt (void)
+{
+    AD1CH2_InterruptHandler();
+}
+
+void __attribute__ (( interrupt, no_auto_psv)) _AD1CH3Interrupt (void)
+{
+    AD1CH3_InterruptHandler();
+}
+
+void __attribute__ (( interrupt, no_auto_psv)) _AD1CMP0Interrupt (void)
+{
+    AD1CMP0_InterruptHandler();
+}
+
 
 
 
@@ -57,6 +57,10 @@
 // *****************************************************************************
 // *****************************************************************************
 void AD1CH0_InterruptHandler( void );
+void AD1CH1_InterruptHandler( void );
+void AD1CH2_InterruptHandler( void );
+void AD1CH3_InterruptHandler( void );
+void AD1CMP0_InterruptHandler( void );
 
 
 
@@ -98,8 +98,41 @@
 
 // Section: File specific functions
 
-volatile static ADC_CHANNEL_OBJECT adc1ChannelObj[20];
-volatile static ADC_CMP_OBJECT adc1CmpObj[20];
+/* Object slot of each configured channel, indexed by ADC1_CHANNEL. Callback
+   objects are only allocated for the configured channels. */
+static const uint8_t adc1ChannelSlot[ADC1_CHANNEL0 + 1U] =
+{
+    0U,
+};
+
+volatile static ADC_CHANNEL_OBJECT adc1ChannelObj[ADC1_MAX_CHANNELS];
+volatile static ADC_CMP_OBJECT adc1CmpObj[ADC1_MAX_CHANNELS];
+volatile static ADC_SCAN_OBJECT adc1ScanObj;
+
+/* Channel registers of the scan list entries. The CON fields have the same
+   layout in every channel, so the AD1CH0CON macros are used for all of them. */
+static volatile uint32_t* const adc1ScanConReg[ADC1_SCAN_MAX_CHANNELS] =
+{
+    &AD1CH0CON, &AD1CH1CON, &AD1CH2CON, &AD1CH3CON
+};
+
+static volatile uint32_t* const adc1ScanDataReg[ADC1_SCAN_MAX_CHANNELS] =
+{
+    &AD1CH0DATA, &AD1CH1DATA, &AD1CH2DATA, &AD1CH3DATA
+};
+
+/* Channel configurations before the scan, restored on stop */
+static uint32_t adc1ScanSavedConfig[ADC1_SCAN_MAX_CHANNELS];
+
+static const uint32_t adc1ScanReadyMask[ADC1_SCAN_MAX_CHANNELS] =
+{
+    _AD1STAT_CH0RDY_MASK, _AD1STAT_CH1RDY_MASK, _AD1STAT_CH2RDY_MASK, _AD1STAT_CH3RDY_MASK
+};
+
+static const uint32_t adc1ScanTriggerMask[ADC1_SCAN_MAX_CHANNELS] =
+{
+    _AD1SWTRG_CH0TRG_MASK, _AD1SWTRG_CH1TRG_MASK, _AD1SWTRG_CH2TRG_MASK, _AD1SWTRG_CH3TRG_MASK
+};
 
 
 typedef enum {
@@ -113,7 +146,15 @@ typedef enum {
     PWM4_TRIGGER2 = 11, 
 }ADC1_PWM_TRIGGERS;
 
-static uint16_t ADC1_TriggerSourceValueGet(ADC1_PWM_INSTANCE pwmInstance, ADC_PWM_TRIGGERS triggerNumber);
+/* TRG1SRC value of each PWM trigger, indexed by
+   [pwmInstance - ADC1_PWM1][triggerNumber - ADC_PWM_TRIGGER_1] */
+static const uint8_t adc1PwmTriggerSource[ADC1_PWM4][2] =
+{
+    {(uint8_t)PWM1_TRIGGER1, (uint8_t)PWM1_TRIGGER2},
+    {(uint8_t)PWM2_TRIGGER1, (uint8_t)PWM2_TRIGGER2},
+    {(uint8_t)PWM3_TRIGGER1, (uint8_t)PWM3_TRIGGER2},
+    {(uint8_t)PWM4_TRIGGER1, (uint8_t)PWM4_TRIGGER2},
+};
 
 // Section: ADC1 Implementation
 
@@ -156,6 +197,11 @@ void ADC1_Deinitialize(void)
     (void)dummy;
     _AD1CH0IF = 0U;
     _AD1CH0IE = 0U;
+    _AD1CH1IE = 0U;
+    _AD1CH2IE = 0U;
+    _AD1CH3IE = 0U;
+    _AD1CMP0IF = 0U;
+    _AD1CMP0IE = 0U;
     
     AD1CON = 0x4A0000UL;
     AD1DATAOVR = 0x0UL;
@@ -170,57 +216,350 @@ void ADC1_Deinitialize(void)
     
 }
 
-static uint16_t ADC1_TriggerSourceValueGet(ADC1_PWM_INSTANCE pwmInstance, ADC_PWM_TRIGGERS triggerNumber)
+void ADC1_PWMTriggerSourceSet(ADC1_CHANNEL channel, ADC1_PWM_INSTANCE pwmInstance, ADC_PWM_TRIGGERS triggerNumber)
 {
-    uint16_t adcTriggerSourceValue = 0x0U;
-    switch(pwmInstance)
+    uint8_t adcTriggerValue;
+    uint32_t pwmIndex = (uint32_t)pwmInstance - (uint32_t)ADC1_PWM1;
+    uint32_t triggerIndex = (uint32_t)triggerNumber - (uint32_t)ADC_PWM_TRIGGER_1;
+
+    if ((pwmIndex < (uint32_t)ADC1_PWM4) && (triggerIndex < 2U))
     {
-        case ADC1_PWM4:
-                if(triggerNumber == ADC_PWM_TRIGGER_1)
-                {
-                    adcTriggerSourceValue = (uint16_t)PWM4_TRIGGER1;
-                }
-                else if(triggerNumber == ADC_PWM_TRIGGER_2)
+        adcTriggerValue = adc1PwmTriggerSource[pwmIndex][triggerIndex];
+        switch(channel)
+        {
+            case ADC1_CHANNEL0:
+                    AD1CH0CONbits.TRG1SRC = adcTriggerValue;
+                    break;
+            default:
+                    /*Do Nothing*/
+                    break;
+        }
+    }
+}
+
+void ADC1_CompareConfigure(ADC1_CHANNEL channel, ADC_CMP_MODE mode, uint32_t lowLimit, uint32_t highLimit)
+{
+    switch(channel)
+    {
+        case ADC1_CHANNEL0:
+                //Disable comparator event while the limits are updated
+                _AD1CMP0IE = 0U;
+                AD1CH0CON &= ~_AD1CH0CON_CMPMOD_MASK;
+                AD1CH0CMPLO = lowLimit;
+                AD1CH0CMPHI = highLimit;
+                AD1CMPSTATbits.CH0CMP = 0U;
+                IFS4bits.AD1CMP0IF = 0U;
+                AD1CH0CON |= ((uint32_t)_AD1CH0CON_CMPMOD_MASK & ((uint32_t)mode << _AD1CH0CON_CMPMOD_POSITION));
+                if (mode != ADC_CMP_MODE_DISABLED)
                 {
-                    adcTriggerSourceValue = (uint16_t)PWM4_TRIGGER2;
+                    _AD1CMP0IE = 1U;
                 }
-                else
+                break;
+        default:
+                /*Do Nothing*/
+                break;
+    }
+}
+
+void ADC1_CompareCallbackRegister(ADC1_CHANNEL channel, ADC_CMP_CALLBACK callback, uintptr_t context)
+{
+    uint8_t slot;
+
+    if ((uint32_t)channel < (sizeof(adc1ChannelSlot) / sizeof(adc1ChannelSlot[0])))
+    {
+        slot = adc1ChannelSlot[channel];
+        adc1CmpObj[slot].callback = callback;
+        adc1CmpObj[slot].context = context;
+    }
+}
+
+void ADC1_ChannelModeSet(ADC1_CHANNEL channel, ADC_CHANNEL_MODE mode, ADC_ACCUMULATION_COUNT accumulation)
+{
+    switch(channel)
+    {
+        case ADC1_CHANNEL0:
+                AD1CH0CON = (AD1CH0CON & ~(_AD1CH0CON_MODE_MASK | _AD1CH0CON_ACCNUM_MASK))
+                            | ((uint32_t)_AD1CH0CON_MODE_MASK & ((uint32_t)mode << _AD1CH0CON_MODE_POSITION))
+                            | ((uint32_t)_AD1CH0CON_ACCNUM_MASK & ((uint32_t)accumulation << _AD1CH0CON_ACCNUM_POSITION));
+                break;
+        default:
+                /*Do Nothing*/
+                break;
+    }
+}
+
+void ADC1_ChannelIntegrationCountSet(ADC1_CHANNEL channel, uint32_t count)
+{
+    switch(channel)
+    {
+        case ADC1_CHANNEL0:
+                AD1CH0CNT = AD1CH0CNT_CNT_SET(count);
+                break;
+        default:
+                /*Do Nothing*/
+                break;
+    }
+}
+
+static uint32_t ADC1_AccumulatedResultScale(uint32_t result, uint32_t config, uint32_t count)
+{
+    uint32_t mode = (config & _AD1CH0CON_MODE_MASK) >> _AD1CH0CON_MODE_POSITION;
+    /* ACCNUM selects 4^(ACCNUM + 1) conversions */
+    uint32_t accnum = (config & _AD1CH0CON_ACCNUM_MASK) >> _AD1CH0CON_ACCNUM_POSITION;
+
+    switch(mode)
+    {
+        case (uint32_t)ADC_CHANNEL_MODE_OVERSAMPLING:
+                result >>= ((accnum + 1U) * 2U);
+                break;
+        case (uint32_t)ADC_CHANNEL_MODE_INTEGRATION:
+        case (uint32_t)ADC_CHANNEL_MODE_WINDOW:
+                if (count != 0U)
                 {
-                    /*Do Nothing*/
+                    result /= count;
                 }
                 break;
-         default:
+        default:
                 /*Do Nothing*/
                 break;
     }
-    return adcTriggerSourceValue;
+    return result;
 }
 
-void ADC1_PWMTriggerSourceSet(ADC1_CHANNEL channel, ADC1_PWM_INSTANCE pwmInstance, ADC_PWM_TRIGGERS triggerNumber)
+uint32_t ADC1_ChannelAverageResultGet(ADC1_CHANNEL channel)
 {
-    uint16_t adcTriggerValue;
-    adcTriggerValue= ADC1_TriggerSourceValueGet(pwmInstance, triggerNumber);
+    uint32_t result = 0x0U;
+
     switch(channel)
     {
         case ADC1_CHANNEL0:
-                AD1CH0CONbits.TRG1SRC = (uint8_t)adcTriggerValue;
+                result = ADC1_AccumulatedResultScale(AD1CH0DATA, AD1CH0CON, (AD1CH0CNT & _AD1CH0CNT_CNT_MASK) >> _AD1CH0CNT_CNT_POSITION);
                 break;
         default:
                 /*Do Nothing*/
                 break;
     }
+    return result;
+}
+
+uint32_t ADC1_ChannelOversampledResultGet(ADC1_CHANNEL channel)
+{
+    uint32_t result = 0x0U;
+
+    switch(channel)
+    {
+        case ADC1_CHANNEL0:
+                /* 4^(ACCNUM + 1) conversions give ACCNUM + 1 extra bits */
+                result = AD1CH0DATA >> ((((AD1CH0CON & _AD1CH0CON_ACCNUM_MASK) >> _AD1CH0CON_ACCNUM_POSITION) + 1U));
+                break;
+        default:
+                /*Do Nothing*/
+                break;
+    }
+    return result;
 }
 
 void ADC1_ChannelCallbackRegister(ADC1_CHANNEL channel,ADC_CHANNEL_CALLBACK callback,uintptr_t context)
 {
-    adc1ChannelObj[channel].callback = callback;
-    adc1ChannelObj[channel].context = context;
+    uint8_t slot;
+
+    if ((uint32_t)channel < (sizeof(adc1ChannelSlot) / sizeof(adc1ChannelSlot[0])))
+    {
+        slot = adc1ChannelSlot[channel];
+        adc1ChannelObj[slot].callback = callback;
+        adc1ChannelObj[slot].context = context;
+    }
 } 
 
 
+/* Enables or disables the result interrupt of a scan list channel, the flag is cleared */
+static void ADC1_ScanInterruptSet(uint32_t channel, bool enable)
+{
+    uint8_t value = enable ? 1U : 0U;
+
+    switch(channel)
+    {
+        case 0U:
+                IEC4bits.AD1CH0IE = 0U;
+                IFS4bits.AD1CH0IF = 0U;
+                IEC4bits.AD1CH0IE = value;
+                break;
+        case 1U:
+                IEC4bits.AD1CH1IE = 0U;
+                IFS4bits.AD1CH1IF = 0U;
+                IEC4bits.AD1CH1IE = value;
+                break;
+        case 2U:
+                IEC4bits.AD1CH2IE = 0U;
+                IFS4bits.AD1CH2IF = 0U;
+                IEC4bits.AD1CH2IE = value;
+                break;
+        case 3U:
+                IEC4bits.AD1CH3IE = 0U;
+                IFS4bits.AD1CH3IF = 0U;
+                IEC4bits.AD1CH3IE = value;
+                break;
+        default:
+                /*Do Nothing*/
+                break;
+    }
+}
+
+bool ADC1_ScanStart(const ADC1_SCAN_CONFIG* config, uint32_t* frameBuffer, uint32_t scansPerFrame, ADC_SCAN_CALLBACK callback, uintptr_t context)
+{
+    uint32_t i;
+    uint32_t readyMask = 0U;
+
+    if ((config == NULL) || (config->inputs == NULL) || (frameBuffer == NULL) || (scansPerFrame == 0U) ||
+        (config->channelCount == 0U) || (config->channelCount > ADC1_SCAN_MAX_CHANNELS))
+    {
+        return false;
+    }
+
+    IEC4bits.AD1CH0IE = 0U;
+
+    if (adc1ScanObj.isActive == false)
+    {
+        for (i = 0U; i < ADC1_SCAN_MAX_CHANNELS; i++)
+        {
+            adc1ScanSavedConfig[i] = *adc1ScanConReg[i];
+        }
+    }
+    else
+    {
+        ADC1_ScanInterruptSet(adc1ScanObj.channelCount - 1U, false);
+    }
+
+    for (i = 0U; i < ADC1_SCAN_MAX_CHANNELS; i++)
+    {
+        if (i < config->channelCount)
+        {
+            *adc1ScanConReg[i] = (AD1CH0CON_MODE_SINGLE_SAMPLE
+                                |AD1CH0CON_ACCNUM_4_SAMPLES
+                                |AD1CH0CON_CMPMOD_DISABLED
+                                |AD1CH0CON_PINSEL_SET(config->inputs[i])
+                                |AD1CH0CON_NINSEL_SET(0)
+                                |AD1CH0CON_SAMC_SET(config->samplingTime)
+                                |AD1CH0CON_TRG1SRC_SET(config->triggerSource));
+            readyMask |= adc1ScanReadyMask[i];
+        }
+        else
+        {
+            /* Channels of a previous, longer scan list must not stay on its trigger */
+            *adc1ScanConReg[i] = adc1ScanSavedConfig[i];
+        }
+    }
+
+    adc1ScanObj.frameBuffer = frameBuffer;
+    adc1ScanObj.scansPerFrame = scansPerFrame;
+    adc1ScanObj.scanIndex = 0U;
+    adc1ScanObj.readyMask = readyMask;
+    adc1ScanObj.channelCount = config->channelCount;
+    adc1ScanObj.callback = callback;
+    adc1ScanObj.context = context;
+    adc1ScanObj.isActive = true;
+
+    /* Only the last channel of the list interrupts */
+    ADC1_ScanInterruptSet(adc1ScanObj.channelCount - 1U, true);
+
+    return true;
+}
+
+void ADC1_ScanStop(void)
+{
+    uint32_t i;
+
+    if (adc1ScanObj.isActive == true)
+    {
+        ADC1_ScanInterruptSet(adc1ScanObj.channelCount - 1U, false);
+        adc1ScanObj.isActive = false;
+
+        for (i = 0U; i < ADC1_SCAN_MAX_CHANNELS; i++)
+        {
+            *adc1ScanConReg[i] = adc1ScanSavedConfig[i];
+        }
+
+        IFS4bits.AD1CH0IF = 0U;
+        IEC4bits.AD1CH0IE = 1U;
+    }
+}
+
+void ADC1_ScanSoftwareTriggerEnable(void)
+{
+    uint32_t i;
+    uint32_t triggerMask = 0U;
+
+    for (i = 0U; i < adc1ScanObj.channelCount; i++)
+    {
+        triggerMask |= adc1ScanTriggerMask[i];
+    }
+    AD1SWTRG = triggerMask;
+}
+
+/* The results are moved by the CPU rather than by DMA. The frame buffer holds
+   the results of each scan together in scan list order, while a DMA channel
+   reads one AD1CHxDATA register and can only step its destination by one
+   result, so one DMA channel per scan channel would be needed and the results
+   of each channel would end up in a buffer of their own. */
+static void ADC1_ScanResultsRead(void)
+{
+    uint32_t i;
+    uint32_t channelCount = adc1ScanObj.channelCount;
+    uint32_t scanIndex = adc1ScanObj.scanIndex;
+    uint32_t halfFrame = adc1ScanObj.scansPerFrame / 2U;
+    uint32_t* samples = &adc1ScanObj.frameBuffer[scanIndex * channelCount];
+
+    /* The channels triggered together are converted in channel order, so the
+       others are ready when the last channel of the list interrupts */
+    if ((AD1STAT & adc1ScanObj.readyMask) != adc1ScanObj.readyMask)
+    {
+        /* A missing channel would shift every following set of results, restart the frame */
+        adc1ScanObj.scanIndex = 0U;
+        if (adc1ScanObj.callback != NULL)
+        {
+            adc1ScanObj.callback(ADC_SCAN_EVENT_FRAME_ERROR, NULL, 0U, adc1ScanObj.context);
+        }
+        return;
+    }
+
+    for (i = 0U; i < channelCount; i++)
+    {
+        samples[i] = *adc1ScanDataReg[i];
+    }
+
+    scanIndex++;
+
+    if (scanIndex == adc1ScanObj.scansPerFrame)
+    {
+        adc1ScanObj.scanIndex = 0U;
+        if (adc1ScanObj.callback != NULL)
+        {
+            adc1ScanObj.callback(ADC_SCAN_EVENT_FRAME, &adc1ScanObj.frameBuffer[halfFrame * channelCount], scanIndex - halfFrame, adc1ScanObj.context);
+        }
+    }
+    else
+    {
+        adc1ScanObj.scanIndex = scanIndex;
+        if ((scanIndex == halfFrame) && (adc1ScanObj.callback != NULL))
+        {
+            adc1ScanObj.callback(ADC_SCAN_EVENT_HALF_FRAME, adc1ScanObj.frameBuffer, halfFrame, adc1ScanObj.context);
+        }
+    }
+}
+
 void AD1CH0_InterruptHandler(void)
 {
     uint32_t valChannel0Data;
+
+    if (adc1ScanObj.isActive == true)
+    {
+        ADC1_ScanResultsRead();
+
+        //clear the CH 0 interrupt flag
+        IFS4bits.AD1CH0IF = 0U;
+        return;
+    }
+
     //Read the ADC value from the ADCH0DATA
     valChannel0Data = AD1CH0DATA;
     
@@ -233,4 +572,48 @@ void AD1CH0_InterruptHandler(void)
     IFS4bits.AD1CH0IF = 0U;
 }
 
+void AD1CH1_InterruptHandler(void)
+{
+    if (adc1ScanObj.isActive == true)
+    {
+        ADC1_ScanResultsRead();
+    }
+
+    //clear the CH 1 interrupt flag
+    IFS4bits.AD1CH1IF = 0U;
+}
+
+void AD1CH2_InterruptHandler(void)
+{
+    if (adc1ScanObj.isActive == true)
+    {
+        ADC1_ScanResultsRead();
+    }
 
+    //clear the CH 2 interrupt flag
+    IFS4bits.AD1CH2IF = 0U;
+}
+
+void AD1CH3_InterruptHandler(void)
+{
+    if (adc1ScanObj.isActive == true)
+    {
+        ADC1_ScanResultsRead();
+    }
+
+    //clear the CH 3 interrupt flag
+    IFS4bits.AD1CH3IF = 0U;
+}
+
+void AD1CMP0_InterruptHandler(void)
+{
+    //Clear status flag before the callback so that a new event is not lost
+    AD1CMPSTATbits.CH0CMP = 0U;
+    //clear the CMP 0 interrupt flag
+    IFS4bits.AD1CMP0IF = 0U;
+
+    if(adc1CmpObj[0].callback != NULL)
+    {
+      adc1CmpObj[0].callback(adc1CmpObj[0].context);
+    }
+}
@@ -43,6 +43,7 @@
 #define PLIB_ADC_COMMON_H
 
 #include <stdint.h>
+#include <stdbool.h>
 
 // /cond IGNORE_THIS
 /* Provide C++ Compatibility */
@@ -65,11 +66,68 @@ typedef enum
     ADC_PWM_TRIGGER_2 = 2,     /**< PWM TRIGGER 2 */
 } ADC_PWM_TRIGGERS;
 
+/**
+ @enum     ADC_CHANNEL_MODE
+ @brief    Defines the conversion modes of a channel.
+*/
+typedef enum
+{
+    ADC_CHANNEL_MODE_SINGLE_SAMPLE = 0,     /**< One conversion per trigger */
+    ADC_CHANNEL_MODE_WINDOW = 1,            /**< Conversions are accumulated while the trigger window is open */
+    ADC_CHANNEL_MODE_INTEGRATION = 2,       /**< A fixed number of triggers is accumulated */
+    ADC_CHANNEL_MODE_OVERSAMPLING = 3,      /**< A fixed number of conversions is accumulated per trigger */
+} ADC_CHANNEL_MODE;
+
+/**
+ @enum     ADC_ACCUMULATION_COUNT
+ @brief    Defines the number of conversions accumulated in oversampling mode.
+*/
+typedef enum
+{
+    ADC_ACCUMULATION_4_SAMPLES = 0,
+    ADC_ACCUMULATION_16_SAMPLES = 1,
+    ADC_ACCUMULATION_64_SAMPLES = 2,
+    ADC_ACCUMULATION_256_SAMPLES = 3,
+} ADC_ACCUMULATION_COUNT;
+
 /** 
   @brief    Callback function prototype for ADC Channel conversion complete interrupt
 */
 typedef void (*ADC_CHANNEL_CALLBACK)(uint32_t result, uintptr_t context);
 
+/**
+ @enum     ADC_SCAN_EVENT
+ @brief    Defines the frame buffer events of a channel scan.
+*/
+typedef enum
+{
+    ADC_SCAN_EVENT_HALF_FRAME,  /**< First half of the frame buffer is filled */
+    ADC_SCAN_EVENT_FRAME,       /**< Second half (or all) of the frame buffer is filled */
+    ADC_SCAN_EVENT_FRAME_ERROR, /**< A channel of a scan was not ready, the frame is restarted */
+} ADC_SCAN_EVENT;
+
+/** 
+  @brief    Callback function prototype for ADC channel scan frame events.
+            samples points to scanCount sets of results, one result per channel
+            of the scan list, in scan list order. For ADC_SCAN_EVENT_FRAME_ERROR
+            samples is NULL and scanCount is 0.
+*/
+typedef void (*ADC_SCAN_CALLBACK)(ADC_SCAN_EVENT event, const uint32_t* samples, uint32_t scanCount, uintptr_t context);
+
+/**
+ @enum     ADC_CMP_MODE
+ @brief    Defines the comparator modes of a channel. The comparator event is
+           generated when the conversion result satisfies the condition.
+*/
+typedef enum
+{
+    ADC_CMP_MODE_DISABLED = 0,              /**< Comparator disabled */
+    ADC_CMP_MODE_OUT_OF_BOUNDS = 1,         /**< Result < low limit or result >= high limit */
+    ADC_CMP_MODE_IN_BOUNDS = 2,             /**< Low limit <= result < high limit */
+    ADC_CMP_MODE_GREATER_THAN = 3,          /**< Result > low limit */
+    ADC_CMP_MODE_LESS_THAN_OR_EQUAL = 4,    /**< Result <= low limit */
+} ADC_CMP_MODE;
+
 /** 
   @brief    Callback function prototype for ADC Comparator event
 */
@@ -105,6 +163,18 @@ typedef struct
     uintptr_t                       context;
 } ADC_CMP_OBJECT;
 
+typedef struct
+{
+    ADC_SCAN_CALLBACK               callback;
+    uintptr_t                       context;
+    uint32_t*                       frameBuffer;
+    uint32_t                        scansPerFrame;
+    uint32_t                        scanIndex;
+    uint32_t                        readyMask;
+    uint8_t                         channelCount;
+    bool                            isActive;
+} ADC_SCAN_OBJECT;
+
 
 // /endcond
 
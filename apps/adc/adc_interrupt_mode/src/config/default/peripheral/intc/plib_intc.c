@@ -48,6 +48,10 @@ void INTC_Initialize( void )
 {
     /* Configure Interrupt priority */
     IPC18bits.AD1CH0IP = 1;
+    IPC18bits.AD1CMP0IP = 1;
+    IPC18bits.AD1CH1IP = 1;
+    IPC18bits.AD1CH2IP = 1;
+    IPC19bits.AD1CH3IP = 1;
 
 
 }
@@ -117,5 +121,35 @@ void INTC_Restore( bool state )
     }
 }
 
+void INTC_SourcePrioritySet( INT_SOURCE source, uint32_t priority )
+{
+    volatile uint32_t *IPCx = (volatile uint32_t *)((uint32_t)&IPC0 + ((uint32_t)(0x10U * (source / 8U)) / 4U));
+    uint32_t shift = (source & 0x7U) * 4U;
+
+    *IPCx = (*IPCx & ~(INTC_PRIORITY_MAX << shift)) | ((priority & INTC_PRIORITY_MAX) << shift);
+}
+
+uint32_t INTC_SourcePriorityGet( INT_SOURCE source )
+{
+    volatile uint32_t *IPCx = (volatile uint32_t *)((uint32_t)&IPC0 + ((uint32_t)(0x10U * (source / 8U)) / 4U));
+
+    return ((*IPCx >> ((source & 0x7U) * 4U)) & INTC_PRIORITY_MAX);
+}
+
+void INTC_NestingEnable( void )
+{
+    INTCON1bits.NSTDIS = 0;
+}
+
+void INTC_NestingDisable( void )
+{
+    INTCON1bits.NSTDIS = 1;
+}
+
+bool INTC_NestingIsEnabled( void )
+{
+    return (INTCON1bits.NSTDIS == 0U);
+}
+
 
 /* End of file */
\ No newline at end of file
@@ -49,11 +49,8 @@
 #include <stdlib.h>                     // Defines EXIT_FAILURE
 #include "definitions.h"                // SYS function prototypes
 
-#define ADC_VREF                (3.3f)
-#define ADC_MAX_COUNT           (4096U)
-
 static uint16_t adc_count;
-static float input_voltage;
+static uint32_t input_voltage_mv;
 volatile static bool result_ready = false;
 
 // *****************************************************************************
@@ -93,8 +90,8 @@ int main ( void )
         if(result_ready == true)
         {
             result_ready = false;
-            input_voltage = (float)adc_count * ADC_VREF / ADC_MAX_COUNT;
-            printf("ADC Count = 0x%03x, ADC Input Voltage = %d.%02d V \r", adc_count, (int)input_voltage, (int)((input_voltage - (int)input_voltage)*100.0));
+            input_voltage_mv = ADC1_ResultToMillivolts(adc_count);
+            printf("ADC Count = 0x%03x, ADC Input Voltage = %d.%02d V \r", adc_count, (int)(input_voltage_mv / 1000U), (int)((input_voltage_mv % 1000U) / 10U));
         }
     }
 
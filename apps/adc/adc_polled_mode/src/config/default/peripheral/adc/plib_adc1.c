@@ -98,8 +98,15 @@
 
 // Section: File specific functions
 
-volatile static ADC_CHANNEL_OBJECT adc1ChannelObj[20];
-volatile static ADC_CMP_OBJECT adc1CmpObj[20];
+/* Object slot of each configured channel, indexed by ADC1_CHANNEL. Callback
+   objects are only allocated for the configured channels. */
+static const uint8_t adc1ChannelSlot[ADC1_CHANNEL0 + 1U] =
+{
+    0U,
+};
+
+volatile static ADC_CHANNEL_OBJECT adc1ChannelObj[ADC1_MAX_CHANNELS];
+volatile static ADC_CMP_OBJECT adc1CmpObj[ADC1_MAX_CHANNELS];
 
 
 typedef enum {
@@ -113,7 +120,15 @@ typedef enum {
     PWM4_TRIGGER2 = 11, 
 }ADC1_PWM_TRIGGERS;
 
-static uint16_t ADC1_TriggerSourceValueGet(ADC1_PWM_INSTANCE pwmInstance, ADC_PWM_TRIGGERS triggerNumber);
+/* TRG1SRC value of each PWM trigger, indexed by
+   [pwmInstance - ADC1_PWM1][triggerNumber - ADC_PWM_TRIGGER_1] */
+static const uint8_t adc1PwmTriggerSource[ADC1_PWM4][2] =
+{
+    {(uint8_t)PWM1_TRIGGER1, (uint8_t)PWM1_TRIGGER2},
+    {(uint8_t)PWM2_TRIGGER1, (uint8_t)PWM2_TRIGGER2},
+    {(uint8_t)PWM3_TRIGGER1, (uint8_t)PWM3_TRIGGER2},
+    {(uint8_t)PWM4_TRIGGER1, (uint8_t)PWM4_TRIGGER2},
+};
 
 // Section: ADC1 Implementation
 
@@ -165,51 +180,123 @@ void ADC1_Deinitialize(void)
     
 }
 
-static uint16_t ADC1_TriggerSourceValueGet(ADC1_PWM_INSTANCE pwmInstance, ADC_PWM_TRIGGERS triggerNumber)
+void ADC1_PWMTriggerSourceSet(ADC1_CHANNEL channel, ADC1_PWM_INSTANCE pwmInstance, ADC_PWM_TRIGGERS triggerNumber)
 {
-    uint16_t adcTriggerSourceValue = 0x0U;
-    switch(pwmInstance)
+    uint8_t adcTriggerValue;
+    uint32_t pwmIndex = (uint32_t)pwmInstance - (uint32_t)ADC1_PWM1;
+    uint32_t triggerIndex = (uint32_t)triggerNumber - (uint32_t)ADC_PWM_TRIGGER_1;
+
+    if ((pwmIndex < (uint32_t)ADC1_PWM4) && (triggerIndex < 2U))
     {
-        case ADC1_PWM4:
-                if(triggerNumber == ADC_PWM_TRIGGER_1)
-                {
-                    adcTriggerSourceValue = (uint16_t)PWM4_TRIGGER1;
-                }
-                else if(triggerNumber == ADC_PWM_TRIGGER_2)
-                {
-                    adcTriggerSourceValue = (uint16_t)PWM4_TRIGGER2;
-                }
-                else
-                {
+        adcTriggerValue = adc1PwmTriggerSource[pwmIndex][triggerIndex];
+        switch(channel)
+        {
+            case ADC1_CHANNEL0:
+                    AD1CH0CONbits.TRG1SRC = adcTriggerValue;
+                    break;
+            default:
                     /*Do Nothing*/
+                    break;
+        }
+    }
+}
+
+void ADC1_ChannelModeSet(ADC1_CHANNEL channel, ADC_CHANNEL_MODE mode, ADC_ACCUMULATION_COUNT accumulation)
+{
+    switch(channel)
+    {
+        case ADC1_CHANNEL0:
+                AD1CH0CON = (AD1CH0CON & ~(_AD1CH0CON_MODE_MASK | _AD1CH0CON_ACCNUM_MASK))
+                            | ((uint32_t)_AD1CH0CON_MODE_MASK & ((uint32_t)mode << _AD1CH0CON_MODE_POSITION))
+                            | ((uint32_t)_AD1CH0CON_ACCNUM_MASK & ((uint32_t)accumulation << _AD1CH0CON_ACCNUM_POSITION));
+                break;
+        default:
+                /*Do Nothing*/
+                break;
+    }
+}
+
+void ADC1_ChannelIntegrationCountSet(ADC1_CHANNEL channel, uint32_t count)
+{
+    switch(channel)
+    {
+        case ADC1_CHANNEL0:
+                AD1CH0CNT = AD1CH0CNT_CNT_SET(count);
+                break;
+        default:
+                /*Do Nothing*/
+                break;
+    }
+}
+
+static uint32_t ADC1_AccumulatedResultScale(uint32_t result, uint32_t config, uint32_t count)
+{
+    uint32_t mode = (config & _AD1CH0CON_MODE_MASK) >> _AD1CH0CON_MODE_POSITION;
+    /* ACCNUM selects 4^(ACCNUM + 1) conversions */
+    uint32_t accnum = (config & _AD1CH0CON_ACCNUM_MASK) >> _AD1CH0CON_ACCNUM_POSITION;
+
+    switch(mode)
+    {
+        case (uint32_t)ADC_CHANNEL_MODE_OVERSAMPLING:
+                result >>= ((accnum + 1U) * 2U);
+                break;
+        case (uint32_t)ADC_CHANNEL_MODE_INTEGRATION:
+        case (uint32_t)ADC_CHANNEL_MODE_WINDOW:
+                if (count != 0U)
+                {
+                    result /= count;
                 }
                 break;
-         default:
+        default:
                 /*Do Nothing*/
                 break;
     }
-    return adcTriggerSourceValue;
+    return result;
 }
 
-void ADC1_PWMTriggerSourceSet(ADC1_CHANNEL channel, ADC1_PWM_INSTANCE pwmInstance, ADC_PWM_TRIGGERS triggerNumber)
+uint32_t ADC1_ChannelAverageResultGet(ADC1_CHANNEL channel)
 {
-    uint16_t adcTriggerValue;
-    adcTriggerValue= ADC1_TriggerSourceValueGet(pwmInstance, triggerNumber);
+    uint32_t result = 0x0U;
+
     switch(channel)
     {
         case ADC1_CHANNEL0:
-                AD1CH0CONbits.TRG1SRC = (uint8_t)adcTriggerValue;
+                result = ADC1_AccumulatedResultScale(AD1CH0DATA, AD1CH0CON, (AD1CH0CNT & _AD1CH0CNT_CNT_MASK) >> _AD1CH0CNT_CNT_POSITION);
                 break;
         default:
                 /*Do Nothing*/
                 break;
     }
+    return result;
+}
+
+uint32_t ADC1_ChannelOversampledResultGet(ADC1_CHANNEL channel)
+{
+    uint32_t result = 0x0U;
+
+    switch(channel)
+    {
+        case ADC1_CHANNEL0:
+                /* 4^(ACCNUM + 1) conversions give ACCNUM + 1 extra bits */
+                result = AD1CH0DATA >> ((((AD1CH0CON & _AD1CH0CON_ACCNUM_MASK) >> _AD1CH0CON_ACCNUM_POSITION) + 1U));
+                break;
+        default:
+                /*Do Nothing*/
+                break;
+    }
+    return result;
 }
 
 void ADC1_ChannelCallbackRegister(ADC1_CHANNEL channel,ADC_CHANNEL_CALLBACK callback,uintptr_t context)
 {
-    adc1ChannelObj[channel].callback = callback;
-    adc1ChannelObj[channel].context = context;
+    uint8_t slot;
+
+    if ((uint32_t)channel < (sizeof(adc1ChannelSlot) / sizeof(adc1ChannelSlot[0])))
+    {
+        slot = adc1ChannelSlot[channel];
+        adc1ChannelObj[slot].callback = callback;
+        adc1ChannelObj[slot].context = context;
+    }
 } 
 
 
@@ -83,6 +83,13 @@ typedef enum
     ADC1_PWM4 = 4,
 } ADC1_PWM_INSTANCE;
 
+/* Converter resolution and reference voltage used by the result scaling helpers */
+#define ADC1_RESOLUTION_BITS            (12U)
+#define ADC1_VREF_MILLIVOLTS            (3300U)
+
+/* Shift from a converter result to Q15 (fraction of the reference voltage) */
+#define ADC1_Q15_SHIFT                  (15U - ADC1_RESOLUTION_BITS)
+
 
 // Section: Driver Interface Functions
 
@@ -318,6 +325,136 @@ inline static void ADC1_IndividualChannelInterruptPrioritySet(ADC1_CHANNEL chann
 void ADC1_ChannelCallbackRegister(ADC1_CHANNEL channel,ADC_CHANNEL_CALLBACK callback,uintptr_t context);
 
 
+/**
+ * @brief      Selects the conversion mode of a channel.
+ * @details    In oversampling mode the hardware accumulates accumulation conversions per
+ *             trigger, in integration mode it accumulates the conversions of the number
+ *             of triggers set by \ref ADC1_ChannelIntegrationCountSet, and in window mode
+ *             it accumulates conversions for as long as the trigger window is open.
+ *             Only one result (and one interrupt) is produced per accumulation, which
+ *             replaces averaging in software.
+ * @pre        The channel must not be converting.
+ * @param[in]  channel - Selected channel.
+ * @param[in]  mode - Conversion mode.
+ * @param[in]  accumulation - Number of conversions accumulated in oversampling mode.
+ *             Ignored in the other modes.
+ * @return     none
+ */
+void ADC1_ChannelModeSet(ADC1_CHANNEL channel, ADC_CHANNEL_MODE mode, ADC_ACCUMULATION_COUNT accumulation);
+
+/**
+ * @brief      Sets the number of triggers accumulated in integration mode.
+ * @pre        The channel must not be converting.
+ * @param[in]  channel - Selected channel.
+ * @param[in]  count - Number of triggers per result.
+ * @return     none
+ */
+void ADC1_ChannelIntegrationCountSet(ADC1_CHANNEL channel, uint32_t count);
+
+/**
+ * @brief      Returns the result of the channel scaled back to the converter resolution.
+ * @details    The accumulated result is divided by the number of accumulated conversions:
+ *             a power of two shift in oversampling mode, the integration count in
+ *             integration mode and the number of conversions reported by the channel
+ *             counter in window mode. In single sample mode the result is returned as is.
+ * @pre        Conversion result must be ready, see \ref ADC1_ChannelResultIsReady.
+ * @param[in]  channel - Selected channel.
+ * @return     Average of the accumulated conversions.
+ */
+uint32_t ADC1_ChannelAverageResultGet(ADC1_CHANNEL channel);
+
+/**
+ * @brief      Returns the oversampled result of the channel with the extra resolution.
+ * @details    Accumulating 4^n conversions gives n extra bits of resolution. The
+ *             accumulated result is shifted right by n, so that 4, 16, 64 and 256
+ *             conversions give 13, 14, 15 and 16-bit results from the 12-bit converter.
+ * @pre        Conversion result must be ready and the channel must be in oversampling mode.
+ * @param[in]  channel - Selected channel.
+ * @return     Oversampled result.
+ */
+uint32_t ADC1_ChannelOversampledResultGet(ADC1_CHANNEL channel);
+
+/**
+ * @brief      Converts a result with the given number of bits to millivolts.
+ * @details    Integer alternative to floating point conversion. The reference voltage
+ *             is scaled by the full scale of the result, which is a power of two, so
+ *             the conversion is one multiply and one shift. The intermediate product
+ *             fits in 32 bits for results of up to 20 bits.
+ * @param[in]  result - Conversion result.
+ * @param[in]  resultBits - Number of bits of the result.
+ * @return     Input voltage in millivolts, rounded to the nearest millivolt.
+ */
+inline static uint32_t ADC1_ScaledResultToMillivolts(uint32_t result, uint32_t resultBits)
+{
+    return ((result * ADC1_VREF_MILLIVOLTS) + (1UL << (resultBits - 1U))) >> resultBits;
+}
+
+/**
+ * @brief      Converts a single sample result to millivolts.
+ * @param[in]  result - Result returned by \ref ADC1_ChannelResultGet or
+ *             \ref ADC1_ChannelAverageResultGet.
+ * @return     Input voltage in millivolts.
+ */
+inline static uint32_t ADC1_ResultToMillivolts(uint32_t result)
+{
+    return ADC1_ScaledResultToMillivolts(result, ADC1_RESOLUTION_BITS);
+}
+
+/**
+ * @brief      Converts an oversampling mode result to millivolts.
+ * @details    4^(accumulation + 1) conversions are accumulated, so the raw result has
+ *             2 * (accumulation + 1) extra bits and the oversampled result
+ *             (accumulation + 1) extra bits.
+ * @param[in]  result - Result of the channel in oversampling mode.
+ * @param[in]  accumulation - Accumulation count the channel is configured with.
+ * @param[in]  isOversampled - true when result is returned by
+ *             \ref ADC1_ChannelOversampledResultGet, false when it is the raw
+ *             accumulated result returned by \ref ADC1_ChannelResultGet.
+ * @return     Input voltage in millivolts.
+ */
+inline static uint32_t ADC1_AccumulatedResultToMillivolts(uint32_t result, ADC_ACCUMULATION_COUNT accumulation, bool isOversampled)
+{
+    uint32_t extraBits = (uint32_t)accumulation + 1U;
+
+    if (isOversampled == false)
+    {
+        extraBits <<= 1U;
+    }
+    return ADC1_ScaledResultToMillivolts(result, ADC1_RESOLUTION_BITS + extraBits);
+}
+
+/**
+ * @brief      Converts a single sample result to a Q15 fraction of the reference voltage.
+ * @param[in]  result - Conversion result.
+ * @return     Result in Q15 format, 0 to (1 - 2^-12) of the reference voltage.
+ */
+inline static int16_t ADC1_ResultToQ15(uint32_t result)
+{
+    return (int16_t)(result << ADC1_Q15_SHIFT);
+}
+
+/**
+ * @brief      Converts an oversampled result to a Q15 fraction of the reference voltage.
+ * @param[in]  result - Result returned by \ref ADC1_ChannelOversampledResultGet.
+ * @param[in]  accumulation - Accumulation count the channel is configured with.
+ * @return     Result in Q15 format.
+ */
+inline static int16_t ADC1_OversampledResultToQ15(uint32_t result, ADC_ACCUMULATION_COUNT accumulation)
+{
+    uint32_t resultBits = ADC1_RESOLUTION_BITS + (uint32_t)accumulation + 1U;
+    uint32_t q15;
+
+    if (resultBits <= 15U)
+    {
+        q15 = result << (15U - resultBits);
+    }
+    else
+    {
+        q15 = result >> (resultBits - 15U);
+    }
+    return (int16_t)q15;
+}
+
 /**
  * @brief    Sets Trigger source as PWM Trigger 
  * @pre      PWM must be enabled and configured 
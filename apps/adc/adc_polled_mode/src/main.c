@@ -53,7 +53,7 @@
 #define ADC_MAX_COUNT           (4096U)
 
 static uint16_t adc_count;
-static float input_voltage;
+static uint32_t input_voltage_mv;
 
 // *****************************************************************************
 // *****************************************************************************
@@ -88,9 +88,9 @@ int main ( void )
 
         /* Read the ADC result */
         adc_count = ADC1_ChannelResultGet(ADC1_CHANNEL0);
-        input_voltage = (float)adc_count * ADC_VREF / ADC_MAX_COUNT;
+        input_voltage_mv = ADC1_ResultToMillivolts(adc_count);
 
-        printf("ADC Count = 0x%03x, ADC Input Voltage = %d.%02d V \r", adc_count, (int)input_voltage, (int)((input_voltage - (int)input_voltage)*100.0));
+        printf("ADC Count = 0x%03x, ADC Input Voltage = %d.%02d V \r", adc_count, (int)(input_voltage_mv / 1000U), (int)((input_voltage_mv % 1000U) / 10U));
     }
 
     /* Execution should not come here during normal operation */
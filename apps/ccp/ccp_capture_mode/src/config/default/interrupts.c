@@ -63,6 +63,21 @@
 // Section: System Interrupt Vector declarations
 
 
+void _CCP1Interrupt (void);
+void _CCT1Interrupt (void);
+
+// Section: System Interrupt Vector definitions
+
+void __attribute__ (( interrupt, no_auto_psv)) _CCP1Interrupt (void)
+{
+    CCP1_InterruptHandler();
+}
+
+void __attribute__ (( interrupt, no_auto_psv)) _CCT1Interrupt (void)
+{
+    CCT1_InterruptHandler();
+}
+
 
 
 /*******************************************************************************
@@ -56,6 +56,8 @@
 // Section: Handler Routines
 // *****************************************************************************
 // *****************************************************************************
+void CCP1_InterruptHandler( void );
+void CCT1_InterruptHandler( void );
 
 
 
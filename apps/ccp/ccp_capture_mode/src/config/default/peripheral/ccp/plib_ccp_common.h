@@ -134,6 +134,42 @@ typedef struct
 
 }CCP_CAPTURE_OBJECT;
 
+// *****************************************************************************
+/* CCP_CAPTURE_STATISTICS
+
+  Summary:
+    Signal statistics computed from a set of captured edges.
+
+  Description:
+    Periods and pulse widths are in timer counts, the frequency is in Hz.
+    A period is measured between two leading edges and a pulse width between
+    a leading edge and the next trailing edge.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    /* Number of complete periods the statistics are computed from */
+    uint32_t periods;
+
+    uint32_t periodMin;
+
+    uint32_t periodMax;
+
+    uint32_t periodAverage;
+
+    uint32_t pulseWidthMin;
+
+    uint32_t pulseWidthMax;
+
+    uint32_t pulseWidthAverage;
+
+    uint32_t frequency;
+
+}CCP_CAPTURE_STATISTICS;
+
 // *****************************************************************************
 /* CCP_COMPARE_CALLBACK
 
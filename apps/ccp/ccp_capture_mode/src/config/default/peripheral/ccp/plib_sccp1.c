@@ -42,6 +42,149 @@
 
 // *****************************************************************************
 
+// *****************************************************************************
+// Section: Local Objects
+// *****************************************************************************
+// *****************************************************************************
+
+/* SCCP1 time base clock: 100 MHz standard speed peripheral clock, 1:64 prescaler */
+#define SCCP1_CAPTURE_FREQUENCY    (1562500U)
+
+static volatile CCP_CAPTURE_OBJECT sccp1CaptureObj;
+
+/* Timestamp ring buffer, written by the capture interrupt only. The indexes
+   are free running and wrap at SCCP1_CAPTURE_BUFFER_SIZE when used. */
+static volatile uint32_t sccp1Timestamps[SCCP1_CAPTURE_BUFFER_SIZE];
+static volatile uint32_t sccp1WriteIndex = 0U;
+static volatile uint32_t sccp1ReadIndex = 0U;
+
+/* Edge numbers of the next written and next read timestamps, the parity
+   tells the leading (even) and trailing (odd) edges apart */
+static volatile uint32_t sccp1WriteEdge = 0U;
+static volatile uint32_t sccp1ReadEdge = 0U;
+
+/* Level of the ICM1 input, it tells whether the next edge is a leading (low)
+   or a trailing (high) edge */
+#define SCCP1_CAPTURE_INPUT_LEVEL()    GPIO_PinRead(SCCP1_CAPTURE_INPUT_PIN)
+
+/* Input level reads while an edge keeps arriving before the polarity is resynchronized */
+#define SCCP1_CAPTURE_RESYNC_RETRIES   (4U)
+
+/* Upper 16 bits of the timestamps, counted by the time base interrupt */
+static volatile uint32_t sccp1Rollovers = 0U;
+static volatile bool sccp1Overflow = false;
+
+// *****************************************************************************
+// Section: SCCP1 Local Functions
+// *****************************************************************************
+
+/* Returns the time base count and its upper 16 bits, including a roll-over whose
+   interrupt is still pending */
+static uint32_t SCCP1_TimeBaseRead(uint32_t* rollovers)
+{
+    uint32_t counter;
+    bool cct1Enabled = ((IEC1 & _IEC1_CCT1IE_MASK) != 0U);
+
+    IEC1 &= ~_IEC1_CCT1IE_MASK;
+
+    counter = CCP1TMR & 0xFFFFU;
+    *rollovers = sccp1Rollovers;
+    if ((IFS1 & _IFS1_CCT1IF_MASK) != 0U)
+    {
+        /* The count read may be from before the roll-over, read it again */
+        *rollovers += 1U;
+        counter = CCP1TMR & 0xFFFFU;
+    }
+
+    if (cct1Enabled)
+    {
+        IEC1 |= _IEC1_CCT1IE_MASK;
+    }
+
+    return counter;
+}
+
+/* Moves the captured values to the ring buffer. This is the only writer of the
+   ring buffer, it runs from the capture interrupt or with the SCCP1 interrupts
+   disabled. The time base is read after each capture, so a capture above the
+   count was taken before the last roll-over and gets the previous upper 16 bits. */
+static void SCCP1_CaptureBufferDrain(void)
+{
+    uint32_t capture;
+    uint32_t counter;
+    uint32_t rollovers;
+
+    while ((CCP1STAT & _CCP1STAT_ICBNE_MASK) != 0U)
+    {
+        capture = CCP1BUF & 0xFFFFU;
+        counter = SCCP1_TimeBaseRead(&rollovers);
+
+        if (capture > counter)
+        {
+            rollovers--;
+        }
+
+        if ((sccp1WriteIndex - sccp1ReadIndex) < SCCP1_CAPTURE_BUFFER_SIZE)
+        {
+            sccp1Timestamps[sccp1WriteIndex & (SCCP1_CAPTURE_BUFFER_SIZE - 1U)] = (rollovers << 16) | capture;
+            sccp1WriteIndex++;
+        }
+        else
+        {
+            sccp1Overflow = true;
+        }
+        sccp1WriteEdge++;
+    }
+
+    if ((CCP1STAT & _CCP1STAT_ICOV_MASK) != 0U)
+    {
+        CCP1STAT &= ~_CCP1STAT_ICOV_MASK;
+        sccp1Overflow = true;
+    }
+}
+
+/* Empties the ring buffer and aligns the edge count on the input level, so that
+   an even count is a leading edge again after edges have been lost. Called with
+   the SCCP1 interrupts disabled. */
+static void SCCP1_CaptureEdgeResync(void)
+{
+    uint32_t retries = SCCP1_CAPTURE_RESYNC_RETRIES;
+    bool isHigh;
+
+    /* An edge captured after the level is read could be either side of it, read again */
+    do
+    {
+        SCCP1_CaptureBufferDrain();
+        isHigh = SCCP1_CAPTURE_INPUT_LEVEL();
+        retries--;
+    } while (((CCP1STAT & _CCP1STAT_ICBNE_MASK) != 0U) && (retries > 0U));
+
+    SCCP1_CaptureBufferDrain();
+
+    if (((sccp1WriteEdge & 1U) != 0U) != isHigh)
+    {
+        sccp1WriteEdge++;
+    }
+    sccp1ReadIndex = sccp1WriteIndex;
+    sccp1ReadEdge = sccp1WriteEdge;
+    sccp1Overflow = false;
+}
+
+static uint32_t SCCP1_CaptureInterruptSave(void)
+{
+    uint32_t interruptState = IEC1 & (_IEC1_CCP1IE_MASK | _IEC1_CCT1IE_MASK);
+
+    IEC1 &= ~(_IEC1_CCP1IE_MASK | _IEC1_CCT1IE_MASK);
+
+    return interruptState;
+}
+
+static void SCCP1_CaptureInterruptRestore(uint32_t interruptState)
+{
+    IEC1 |= interruptState;
+}
+
+// *****************************************************************************
 // *****************************************************************************
 // Section: SCCP1 Implementation
 // *****************************************************************************
@@ -58,12 +201,33 @@ void SCCP1_CaptureInitialize (void)
 
     CCP1CON3 = 0x0;
 
+    /* Free running 16-bit time base, the roll-overs extend the timestamps to 32-bit */
+    CCP1TMR = 0x0;
+
+    CCP1PR = 0xFFFFU;
+
+    sccp1CaptureObj.callback_fn = NULL;
+
+    IFS1 &= ~(_IFS1_CCP1IF_MASK | _IFS1_CCT1IF_MASK);
+    IEC1 |= (_IEC1_CCP1IE_MASK | _IEC1_CCT1IE_MASK);
 }
 
 
 void SCCP1_CaptureStart (void)
 {
+    uint32_t interruptState = SCCP1_CaptureInterruptSave();
+
+    /* Timestamps restart from zero */
+    CCP1TMR = 0x0;
+    sccp1Rollovers = 0U;
+    sccp1WriteEdge = 0U;
+
     CCP1CON1 |= _CCP1CON1_ON_MASK;
+
+    /* The first edge is a leading edge only if the input is low at start */
+    SCCP1_CaptureEdgeResync();
+
+    SCCP1_CaptureInterruptRestore(interruptState);
 }
 
 
@@ -86,3 +250,161 @@ bool SCCP1_CaptureStatusGet (void)
     return status;
 }
 
+uint32_t SCCP1_CaptureFrequencyGet (void)
+{
+    return SCCP1_CAPTURE_FREQUENCY;
+}
+
+void SCCP1_CaptureCallbackRegister (CCP_CAPTURE_CALLBACK callback_fn, uintptr_t context)
+{
+    /* Save callback_fn and context in local memory */
+    sccp1CaptureObj.callback_fn = callback_fn;
+    sccp1CaptureObj.context = context;
+}
+
+uint32_t SCCP1_CaptureTimestampCountGet (void)
+{
+    return sccp1WriteIndex - sccp1ReadIndex;
+}
+
+uint32_t SCCP1_CaptureTimestampRead (uint32_t* timestamps, uint32_t count)
+{
+    uint32_t available = sccp1WriteIndex - sccp1ReadIndex;
+    uint32_t readIndex = sccp1ReadIndex;
+    uint32_t index;
+
+    if (count > available)
+    {
+        count = available;
+    }
+
+    for (index = 0U; index < count; index++)
+    {
+        timestamps[index] = sccp1Timestamps[(readIndex + index) & (SCCP1_CAPTURE_BUFFER_SIZE - 1U)];
+    }
+
+    /* Release the entries only once they have been copied */
+    sccp1ReadIndex = readIndex + count;
+    sccp1ReadEdge += count;
+
+    return count;
+}
+
+uint32_t SCCP1_CaptureEdgeCountGet (void)
+{
+    return sccp1ReadEdge;
+}
+
+bool SCCP1_CaptureOverflowGet (void)
+{
+    return sccp1Overflow;
+}
+
+void SCCP1_CaptureBufferFlush (void)
+{
+    uint32_t interruptState = SCCP1_CaptureInterruptSave();
+
+    SCCP1_CaptureEdgeResync();
+
+    SCCP1_CaptureInterruptRestore(interruptState);
+}
+
+bool SCCP1_CaptureStatisticsGet (uint32_t edges, CCP_CAPTURE_STATISTICS* statistics)
+{
+    uint32_t timestamps[SCCP1_CAPTURE_BUFFER_SIZE];
+    uint32_t skip;
+    uint32_t index;
+    uint32_t value;
+    uint32_t widths = 0U;
+    uint64_t periodSum = 0U;
+    uint64_t widthSum = 0U;
+
+    /* A trailing edge may have to be skipped first, it must fit in the buffer too */
+    if ((edges < 3U) || (edges > (SCCP1_CAPTURE_BUFFER_SIZE - 1U)) || (statistics == NULL))
+    {
+        return false;
+    }
+
+    if (sccp1Overflow)
+    {
+        SCCP1_CaptureBufferFlush();
+        return false;
+    }
+
+    /* Start at a leading edge */
+    skip = sccp1ReadEdge & 1U;
+    if (SCCP1_CaptureTimestampCountGet() < (edges + skip))
+    {
+        return false;
+    }
+    if (skip != 0U)
+    {
+        (void)SCCP1_CaptureTimestampRead(timestamps, 1U);
+    }
+    (void)SCCP1_CaptureTimestampRead(timestamps, edges);
+
+    statistics->periods = 0U;
+    statistics->periodMin = UINT32_MAX;
+    statistics->periodMax = 0U;
+    statistics->pulseWidthMin = UINT32_MAX;
+    statistics->pulseWidthMax = 0U;
+
+    for (index = 0U; (index + 1U) < edges; index += 2U)
+    {
+        value = timestamps[index + 1U] - timestamps[index];
+        widthSum += value;
+        widths++;
+        if (value < statistics->pulseWidthMin)
+        {
+            statistics->pulseWidthMin = value;
+        }
+        if (value > statistics->pulseWidthMax)
+        {
+            statistics->pulseWidthMax = value;
+        }
+
+        if ((index + 2U) < edges)
+        {
+            value = timestamps[index + 2U] - timestamps[index];
+            periodSum += value;
+            statistics->periods++;
+            if (value < statistics->periodMin)
+            {
+                statistics->periodMin = value;
+            }
+            if (value > statistics->periodMax)
+            {
+                statistics->periodMax = value;
+            }
+        }
+    }
+
+    statistics->periodAverage = (uint32_t)(periodSum / statistics->periods);
+    statistics->pulseWidthAverage = (uint32_t)(widthSum / widths);
+    statistics->frequency = (periodSum != 0U) ? (uint32_t)(((uint64_t)SCCP1_CAPTURE_FREQUENCY * statistics->periods) / periodSum) : 0U;
+
+    return true;
+}
+
+void __attribute__((used)) CCP1_InterruptHandler (void)
+{
+    /* Additional local variable to prevent MISRA C violations (Rule 13.x) */
+    uintptr_t context = sccp1CaptureObj.context;
+
+    IFS1 &= ~_IFS1_CCP1IF_MASK;
+
+    SCCP1_CaptureBufferDrain();
+
+    if(sccp1CaptureObj.callback_fn != NULL)
+    {
+        sccp1CaptureObj.callback_fn(context);
+    }
+}
+
+void __attribute__((used)) CCT1_InterruptHandler (void)
+{
+    /* The captures are only drained by the capture interrupt, they are dated
+       against the time base count there */
+    IFS1 &= ~_IFS1_CCT1IF_MASK;
+    sccp1Rollovers++;
+}
@@ -46,6 +46,7 @@
 #include <stdint.h>
 #include "device.h"
 #include "plib_ccp_common.h"
+#include "peripheral/gpio/plib_gpio.h"
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
@@ -53,6 +54,17 @@
 #endif
 // DOM-IGNORE-END
 
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+/* Number of timestamps held by the capture ring buffer, must be a power of 2 */
+#define SCCP1_CAPTURE_BUFFER_SIZE    (64U)
+
+/* Pin of the ICM1 input, its level tells the leading and trailing edges apart.
+   It must match the ICM1 remapping done by GPIO_Initialize (RP20). */
+#define SCCP1_CAPTURE_INPUT_PIN      (GPIO_PIN_RB3)
 
 // *****************************************************************************
 // Section: Interface
@@ -152,6 +164,174 @@ uint16_t SCCP1_Capture16bitBufferRead (void);
 */
 bool SCCP1_CaptureStatusGet (void);
 
+// *****************************************************************************
+/* Function:
+   uint32_t SCCP1_CaptureFrequencyGet (void)
+
+  Summary:
+    Returns the SCCP1 time base frequency
+
+  Description:
+    This function returns the frequency of the SCCP1 time base in Hz, which
+    is the resolution of the captured timestamps.
+
+  Parameters:
+    none
+
+  Returns:
+    uint32_t
+*/
+uint32_t SCCP1_CaptureFrequencyGet (void);
+
+// *****************************************************************************
+/* Function:
+   void SCCP1_CaptureCallbackRegister (CCP_CAPTURE_CALLBACK callback_fn, uintptr_t context)
+
+  Summary:
+    Registers the function to be called from the capture interrupt
+
+  Description:
+    The callback is called after the captured values have been moved from the
+    SCCP1 capture buffer to the timestamp ring buffer.
+
+  Parameters:
+    callback_fn - Pointer to the function to be called, NULL to disable it
+    context - Value passed to the callback function
+
+  Returns:
+    void
+*/
+void SCCP1_CaptureCallbackRegister (CCP_CAPTURE_CALLBACK callback_fn, uintptr_t context);
+
+// *****************************************************************************
+/* Function:
+   uint32_t SCCP1_CaptureTimestampCountGet (void)
+
+  Summary:
+    Returns the number of timestamps in the ring buffer
+
+  Description:
+    Every captured edge is extended to a 32-bit timestamp with the count of
+    SCCP1 time base roll-overs, and stored in a ring buffer of
+    SCCP1_CAPTURE_BUFFER_SIZE entries by the capture interrupt.
+
+  Parameters:
+    none
+
+  Returns:
+    uint32_t
+*/
+uint32_t SCCP1_CaptureTimestampCountGet (void);
+
+// *****************************************************************************
+/* Function:
+   uint32_t SCCP1_CaptureTimestampRead (uint32_t* timestamps, uint32_t count)
+
+  Summary:
+    Reads timestamps from the ring buffer
+
+  Description:
+    This function moves up to count timestamps, oldest first, from the ring
+    buffer to the timestamps array.
+
+  Parameters:
+    timestamps - Destination array
+    count - Maximum number of timestamps to read
+
+  Returns:
+    Number of timestamps read
+*/
+uint32_t SCCP1_CaptureTimestampRead (uint32_t* timestamps, uint32_t count);
+
+// *****************************************************************************
+/* Function:
+   uint32_t SCCP1_CaptureEdgeCountGet (void)
+
+  Summary:
+    Returns the number of edges read from the ring buffer
+
+  Description:
+    The count restarts with SCCP1_CaptureStart and includes the edges discarded
+    by SCCP1_CaptureBufferFlush. An even count means that the next timestamp
+    read is a leading edge. SCCP1_CaptureStart and SCCP1_CaptureBufferFlush
+    align the count on the input level, which adds one when the next edge is
+    a trailing edge.
+
+  Parameters:
+    none
+
+  Returns:
+    uint32_t
+*/
+uint32_t SCCP1_CaptureEdgeCountGet (void);
+
+// *****************************************************************************
+/* Function:
+   bool SCCP1_CaptureOverflowGet (void)
+
+  Summary:
+    Returns the capture overflow state
+
+  Description:
+    Returns true when edges have been lost since the last flush, either because
+    the ring buffer was full or because the SCCP1 capture buffer overflowed.
+
+  Parameters:
+    none
+
+  Returns:
+    bool
+*/
+bool SCCP1_CaptureOverflowGet (void);
+
+// *****************************************************************************
+/* Function:
+   void SCCP1_CaptureBufferFlush (void)
+
+  Summary:
+    Empties the ring buffer and clears the overflow state
+
+  Description:
+    The edge polarity is taken again from the input level, so the edge count
+    is valid even when edges have been lost.
+
+  Parameters:
+    none
+
+  Returns:
+    void
+*/
+void SCCP1_CaptureBufferFlush (void);
+
+// *****************************************************************************
+/* Function:
+   bool SCCP1_CaptureStatisticsGet (uint32_t edges, CCP_CAPTURE_STATISTICS* statistics)
+
+  Summary:
+    Computes period, pulse width and frequency statistics over a set of edges
+
+  Description:
+    This function consumes the given number of edges from the ring buffer,
+    starting at a leading edge, and computes the minimum, maximum and average
+    period and pulse width and the average frequency.
+
+    The first edge captured after SCCP1_CaptureStart or SCCP1_CaptureBufferFlush
+    is the leading edge; with the capture on every edge the leading and trailing
+    edges then alternate.
+
+  Parameters:
+    edges - Number of edges, 3 to SCCP1_CAPTURE_BUFFER_SIZE - 1. One entry of
+            the ring buffer is kept for a trailing edge skipped at the start.
+    statistics - Computed statistics
+
+  Returns:
+    true - Statistics computed
+    false - Not enough edges captured yet, invalid edge count, or edges were lost.
+            Lost edges flush the ring buffer so that the next set starts at a
+            leading edge.
+*/
+bool SCCP1_CaptureStatisticsGet (uint32_t edges, CCP_CAPTURE_STATISTICS* statistics);
+
 
 
 
@@ -0,0 +1,204 @@
+/*******************************************************************************
+  Frequency Meter Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    freq_meter.c
+
+  Summary:
+    Continuous period and duty cycle measurement on the SCCP1 capture.
+
+  Description:
+    The gates are processed in the SCCP1 capture interrupt and published in a
+    snapshot that is read without disabling interrupts.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// Section: Included Files
+
+#include <stddef.h>
+#include "definitions.h"
+#include "freq_meter.h"
+
+// Section: Local Objects
+
+/* Number of timestamps read from the ring buffer at a time */
+#define FREQ_METER_READ_SIZE    (8U)
+
+/* Gate state, only used from the capture interrupt */
+static uint32_t meterGateTime = 0U;
+static uint32_t meterMaxPeriods = 1U;
+static bool meterGateOpen = false;
+static uint32_t meterGateStart = 0U;
+static uint32_t meterLastLeading = 0U;
+static uint32_t meterPeriods = 0U;
+static uint32_t meterHighTime = 0U;
+
+/* Published snapshot, the sequence is odd while the snapshot is written */
+static volatile uint32_t meterSequence = 0U;
+static volatile FREQ_METER_RESULT meterResult;
+
+// Section: Local Functions
+
+static void FREQ_METER_Publish(uint32_t elapsed)
+{
+    uint32_t periodQ8 = (uint32_t)(((uint64_t)elapsed << 8) / meterPeriods);
+    uint32_t frequency = (uint32_t)(((uint64_t)SCCP1_CaptureFrequencyGet() * 1000U * meterPeriods) / elapsed);
+    uint32_t dutyCycle = (uint32_t)(((uint64_t)meterHighTime * 10000U) / elapsed);
+
+    meterSequence++;
+
+    meterResult.periodQ8 = periodQ8;
+    meterResult.frequencyMilliHz = frequency;
+    meterResult.dutyCycle = dutyCycle;
+    meterResult.periods = meterPeriods;
+    meterResult.updates++;
+
+    meterSequence++;
+}
+
+static void FREQ_METER_LostGate(void)
+{
+    meterSequence++;
+    meterResult.lostGates++;
+    meterSequence++;
+
+    meterGateOpen = false;
+}
+
+static void FREQ_METER_Edge(uint32_t timestamp, bool isLeading)
+{
+    uint32_t elapsed;
+
+    if (isLeading)
+    {
+        if (meterGateOpen)
+        {
+            meterPeriods++;
+            elapsed = timestamp - meterGateStart;
+
+            if ((elapsed >= meterGateTime) || (meterPeriods >= meterMaxPeriods))
+            {
+                FREQ_METER_Publish(elapsed);
+
+                /* The edge that closes a gate opens the next one */
+                meterGateOpen = false;
+            }
+        }
+
+        if (meterGateOpen == false)
+        {
+            meterGateOpen = true;
+            meterGateStart = timestamp;
+            meterPeriods = 0U;
+            meterHighTime = 0U;
+        }
+        meterLastLeading = timestamp;
+    }
+    else if (meterGateOpen)
+    {
+        meterHighTime += timestamp - meterLastLeading;
+    }
+    else
+    {
+        /* Trailing edge before the first leading edge */
+    }
+}
+
+/* This function is called from the SCCP1 capture interrupt */
+static void FREQ_METER_CaptureHandler(uintptr_t context)
+{
+    uint32_t timestamps[FREQ_METER_READ_SIZE];
+    uint32_t edge;
+    uint32_t count;
+    uint32_t index;
+
+    if (SCCP1_CaptureOverflowGet())
+    {
+        SCCP1_CaptureBufferFlush();
+        FREQ_METER_LostGate();
+    }
+
+    do
+    {
+        edge = SCCP1_CaptureEdgeCountGet();
+        count = SCCP1_CaptureTimestampRead(timestamps, FREQ_METER_READ_SIZE);
+
+        for (index = 0U; index < count; index++)
+        {
+            FREQ_METER_Edge(timestamps[index], (((edge + index) & 1U) == 0U));
+        }
+    } while (count == FREQ_METER_READ_SIZE);
+}
+
+// Section: Frequency Meter Implementation
+
+void FREQ_METER_Start(uint32_t gateTime, uint32_t maxPeriods)
+{
+    SCCP1_CaptureCallbackRegister(NULL, 0U);
+
+    meterGateTime = gateTime;
+    meterMaxPeriods = (maxPeriods != 0U) ? maxPeriods : 1U;
+    meterGateOpen = false;
+
+    meterSequence++;
+    meterResult.updates = 0U;
+    meterResult.lostGates = 0U;
+    meterSequence++;
+
+    SCCP1_CaptureBufferFlush();
+    SCCP1_CaptureCallbackRegister(FREQ_METER_CaptureHandler, 0U);
+}
+
+void FREQ_METER_Stop(void)
+{
+    SCCP1_CaptureCallbackRegister(NULL, 0U);
+}
+
+bool FREQ_METER_ResultGet(FREQ_METER_RESULT* result)
+{
+    uint32_t sequence;
+
+    do
+    {
+        /* Wait for the writer to finish, it cannot be interrupted by the reader */
+        do
+        {
+            sequence = meterSequence;
+        } while ((sequence & 1U) != 0U);
+
+        result->periodQ8 = meterResult.periodQ8;
+        result->frequencyMilliHz = meterResult.frequencyMilliHz;
+        result->dutyCycle = meterResult.dutyCycle;
+        result->periods = meterResult.periods;
+        result->updates = meterResult.updates;
+        result->lostGates = meterResult.lostGates;
+
+    } while (sequence != meterSequence);
+
+    return (result->updates != 0U);
+}
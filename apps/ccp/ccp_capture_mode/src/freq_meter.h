@@ -0,0 +1,129 @@
+/*******************************************************************************
+  Frequency Meter Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    freq_meter.h
+
+  Summary:
+    Continuous period and duty cycle measurement on the SCCP1 capture.
+
+  Description:
+    The meter uses reciprocal counting: it measures the time taken by a whole
+    number of input periods instead of counting periods in a fixed gate, so
+    the resolution is one time base count over the whole gate at any input
+    frequency. A gate closes at the first leading edge after the gate time,
+    or after the maximum number of periods.
+
+    Each closed gate is published in a snapshot protected by a sequence
+    counter. The capture interrupt writes the snapshot and the application
+    reads it without disabling interrupts.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef FREQ_METER_H
+#define FREQ_METER_H
+
+// Section: Included Files
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// Section: Data Types
+
+/**
+ @struct   FREQ_METER_RESULT
+ @brief    Measurement of the last closed gate
+*/
+typedef struct
+{
+    /* Average period in SCCP1 time base counts, with 8 fractional bits */
+    uint32_t                periodQ8;
+
+    /* Average frequency in mHz */
+    uint32_t                frequencyMilliHz;
+
+    /* Duty cycle in 0.01 % steps, 0 to 10000 */
+    uint32_t                dutyCycle;
+
+    /* Number of periods averaged */
+    uint32_t                periods;
+
+    /* Number of gates published since the start, tells a new result from a stale one */
+    uint32_t                updates;
+
+    /* Number of gates discarded because edges were lost */
+    uint32_t                lostGates;
+
+} FREQ_METER_RESULT;
+
+// Section: Interface Functions
+
+/**
+ * @brief      Starts the continuous measurement.
+ * @details    The meter registers the SCCP1 capture callback and consumes the
+ *             timestamps from the capture interrupt. The SCCP1 capture must be
+ *             started with SCCP1_CaptureStart.
+ * @param[in]  gateTime   - Minimum gate time in SCCP1 time base counts
+ * @param[in]  maxPeriods - Maximum number of periods in a gate, at least 1
+ * @return     none
+ */
+void FREQ_METER_Start(uint32_t gateTime, uint32_t maxPeriods);
+
+/**
+ * @brief      Stops the measurement and releases the SCCP1 capture callback.
+ * @return     none
+ */
+void FREQ_METER_Stop(void);
+
+/**
+ * @brief      Reads the last published measurement.
+ * @details    The snapshot is read again when the capture interrupt published a
+ *             new result during the copy, interrupts are never disabled.
+ * @param[out] result - Last measurement
+ * @return     true  - result holds a measurement
+ * @return     false - No gate has closed yet
+ */
+bool FREQ_METER_ResultGet(FREQ_METER_RESULT* result);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif // FREQ_METER_H
@@ -50,9 +50,29 @@
 #include <stdlib.h>                     // Defines EXIT_FAILURE
 #include "definitions.h"                // SYS function prototypes
 #include "stdio.h"
+#include "freq_meter.h"
 
-static uint16_t capturedValue[3];
-volatile static uint8_t captureIndex = 0;
+/* Set to 1 to measure the signal continuously with the frequency meter
+   instead of computing statistics over sets of edges */
+#define CAPTURE_FREQ_METER  (0)
+
+#if (CAPTURE_FREQ_METER == 1)
+
+/* Gate of at least 100 ms and at most 10000 periods */
+#define METER_GATE_TIME     (SCCP1_CaptureFrequencyGet() / 10U)
+#define METER_MAX_PERIODS   (10000U)
+
+static FREQ_METER_RESULT meterResult;
+static uint32_t meterLastUpdate = 0U;
+
+#else
+
+/* Number of edges the signal statistics are computed from */
+#define CAPTURE_EDGES   (33U)
+
+static CCP_CAPTURE_STATISTICS captureStatistics;
+
+#endif
 
 // *****************************************************************************
 // *****************************************************************************
@@ -69,6 +89,10 @@ int main ( void )
     printf("\n\r                    CCP Capture Demo                 ");
     printf("\n\r---------------------------------------------------------\n\r");
 
+#if (CAPTURE_FREQ_METER == 1)
+    FREQ_METER_Start(METER_GATE_TIME, METER_MAX_PERIODS);
+#endif
+
     SCCP1_CaptureStart();
     
     SCCP2_CompareStart();
@@ -77,15 +101,31 @@ int main ( void )
     {
         /* Maintain state machines of all polled MPLAB Harmony modules. */
         SYS_Tasks ( );
-        
-        while(!SCCP1_CaptureStatusGet());
-
-        capturedValue[captureIndex++] = SCCP1_Capture16bitBufferRead();
-        capturedValue[2] = capturedValue[1]-capturedValue[0];
-        if ( captureIndex > 1){
-            printf("Pulse Width Count = %d\r\n",capturedValue[2]);
-            captureIndex = 0;
+
+#if (CAPTURE_FREQ_METER == 1)
+        /* The meter publishes a new result at the end of each gate */
+        if (FREQ_METER_ResultGet(&meterResult) && (meterResult.updates != meterLastUpdate))
+        {
+            meterLastUpdate = meterResult.updates;
+            printf("Frequency = %lu.%03lu Hz, Duty Cycle = %lu.%02lu %%, Periods = %lu\r\n",
+                   (unsigned long)(meterResult.frequencyMilliHz / 1000U), (unsigned long)(meterResult.frequencyMilliHz % 1000U),
+                   (unsigned long)(meterResult.dutyCycle / 100U), (unsigned long)(meterResult.dutyCycle % 100U),
+                   (unsigned long)meterResult.periods);
+        }
+#else
+        /* The capture interrupt moves the timestamps of all edges to a ring buffer */
+        if (SCCP1_CaptureStatisticsGet(CAPTURE_EDGES, &captureStatistics))
+        {
+            printf("Pulse Width Count = %lu (min %lu, max %lu)\r\n", (unsigned long)captureStatistics.pulseWidthAverage,
+                   (unsigned long)captureStatistics.pulseWidthMin, (unsigned long)captureStatistics.pulseWidthMax);
+            printf("Period Count = %lu (min %lu, max %lu), Frequency = %lu Hz\r\n", (unsigned long)captureStatistics.periodAverage,
+                   (unsigned long)captureStatistics.periodMin, (unsigned long)captureStatistics.periodMax,
+                   (unsigned long)captureStatistics.frequency);
+
+            /* Measure a new set of edges after the report */
+            SCCP1_CaptureBufferFlush();
         }
+#endif
     }
 
     /* Execution should not come here during normal operation */
@@ -63,11 +63,17 @@
 // Section: System Interrupt Vector declarations
 
 
+void _CCT1Interrupt (void);
 void _CCT2Interrupt (void);
 void _CCT4Interrupt (void);
 
 // Section: System Interrupt Vector definitions
 
+void __attribute__ (( interrupt, no_auto_psv)) _CCT1Interrupt (void)
+{
+    CCT1_InterruptHandler();
+}
+
 void __attribute__ (( interrupt, no_auto_psv)) _CCT2Interrupt (void)
 {
     CCT2_InterruptHandler();
@@ -56,6 +56,7 @@
 // Section: Handler Routines
 // *****************************************************************************
 // *****************************************************************************
+void CCT1_InterruptHandler( void );
 void CCT2_InterruptHandler( void );
 void CCT4_InterruptHandler( void );
 
@@ -163,6 +163,30 @@ typedef struct
     uintptr_t context;
 }CCP_COMPARE_OBJECT;
 
+// *****************************************************************************
+/* CCP_COMPARE_VALUES
+
+  Summary:
+    Compare values of one period of a compare waveform.
+
+  Description:
+    Values staged by the buffered update API or stored in a compare sequence
+    table. They are applied together at a period roll-over.
+
+  Remarks:
+    valueB is only used by the dual edge compare modes.
+*/
+
+typedef struct
+{
+    uint16_t period;
+
+    uint16_t valueA;
+
+    uint16_t valueB;
+
+}CCP_COMPARE_VALUES;
+
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
 
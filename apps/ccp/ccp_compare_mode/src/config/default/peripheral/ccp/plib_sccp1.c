@@ -48,6 +48,33 @@
 
 // *****************************************************************************
 
+static volatile CCP_TIMER_OBJECT sccp1TimerObj;
+
+/* Compare values applied at the next period roll-over */
+static volatile CCP_COMPARE_VALUES sccp1Staged;
+static volatile bool sccp1UpdatePending = false;
+
+/* Compare sequence played back by the timer interrupt, one entry per period */
+static const CCP_COMPARE_VALUES* volatile sccp1Sequence = NULL;
+static volatile uint32_t sccp1SequenceLength = 0U;
+static volatile uint32_t sccp1SequenceIndex = 0U;
+static volatile uint32_t sccp1SequenceRepeat = 0U;
+static volatile uint32_t sccp1SequencePlayed = 0U;
+
+/* The timer interrupt is only enabled while it has work: a staged update, a
+   running sequence or a timer callback */
+static void SCCP1_TimerInterruptUpdate (void)
+{
+    if (sccp1UpdatePending || (sccp1Sequence != NULL) || (sccp1TimerObj.callback_fn != NULL))
+    {
+        IEC1 |= _IEC1_CCT1IE_MASK;
+    }
+    else
+    {
+        IEC1 &= ~_IEC1_CCT1IE_MASK;
+    }
+}
+
 void SCCP1_CompareInitialize (void)
 {
     /* Disable Timer */
@@ -63,6 +90,8 @@ void SCCP1_CompareInitialize (void)
     CCP1RA = 500;
     CCP1RB = 1000;
 
+    IFS1 &= ~_IFS1_CCT1IF_MASK;
+    SCCP1_TimerInterruptUpdate();
 }
 
 void SCCP1_CompareStart (void)
@@ -119,5 +148,118 @@ uint16_t SCCP1_Compare16bitRBValueGet (void)
     return (uint16_t)CCP1RB;
 }
 
+void SCCP1_CompareBufferedUpdate (uint16_t period, uint16_t valueA, uint16_t valueB)
+{
+    /* Hold off the timer interrupt so that it never applies half staged values */
+    IEC1 &= ~_IEC1_CCT1IE_MASK;
+
+    sccp1Sequence = NULL;
+    sccp1Staged.period = period;
+    sccp1Staged.valueA = valueA;
+    sccp1Staged.valueB = valueB;
+    sccp1UpdatePending = true;
+
+    SCCP1_TimerInterruptUpdate();
+}
+
+bool SCCP1_CompareUpdateIsPending (void)
+{
+    return sccp1UpdatePending;
+}
+
+bool SCCP1_CompareSequenceStart (const CCP_COMPARE_VALUES* table, uint32_t length, uint32_t repeat)
+{
+    if ((table == NULL) || (length == 0U))
+    {
+        return false;
+    }
+
+    IEC1 &= ~_IEC1_CCT1IE_MASK;
+
+    sccp1UpdatePending = false;
+    sccp1SequenceLength = length;
+    sccp1SequenceIndex = 0U;
+    sccp1SequenceRepeat = repeat;
+    sccp1SequencePlayed = 0U;
+    sccp1Sequence = table;
+
+    SCCP1_TimerInterruptUpdate();
+
+    return true;
+}
+
+void SCCP1_CompareSequenceStop (void)
+{
+    IEC1 &= ~_IEC1_CCT1IE_MASK;
+
+    sccp1Sequence = NULL;
+
+    SCCP1_TimerInterruptUpdate();
+}
+
+bool SCCP1_CompareSequenceIsRunning (void)
+{
+    return (sccp1Sequence != NULL);
+}
+
+void SCCP1_TimerCallbackRegister(CCP_TIMER_CALLBACK callback, uintptr_t context)
+{
+    IEC1 &= ~_IEC1_CCT1IE_MASK;
+
+    sccp1TimerObj.callback_fn = callback;
+
+    sccp1TimerObj.context = context;
+
+    SCCP1_TimerInterruptUpdate();
+}
+
+void __attribute__((used)) CCT1_InterruptHandler (void)
+{
+    /* Additional local variable to prevent MISRA C violations (Rule 13.x) */
+    uintptr_t context = sccp1TimerObj.context;
+    uint32_t status = IFS1bits.CCT1IF;
+    const CCP_COMPARE_VALUES* entry;
+    IFS1 &= ~_IFS1_CCT1IF_MASK;    //Clear IRQ flag
+
+    /* The period has just rolled over, the new values apply to the whole period */
+    if (sccp1UpdatePending)
+    {
+        CCP1PR = sccp1Staged.period;
+        CCP1RA = sccp1Staged.valueA;
+        CCP1RB = sccp1Staged.valueB;
+        sccp1UpdatePending = false;
+    }
+    else if (sccp1Sequence != NULL)
+    {
+        entry = &sccp1Sequence[sccp1SequenceIndex];
+        CCP1PR = entry->period;
+        CCP1RA = entry->valueA;
+        CCP1RB = entry->valueB;
+
+        sccp1SequenceIndex++;
+        if (sccp1SequenceIndex >= sccp1SequenceLength)
+        {
+            sccp1SequenceIndex = 0U;
+            sccp1SequencePlayed++;
+            if ((sccp1SequenceRepeat != 0U) && (sccp1SequencePlayed >= sccp1SequenceRepeat))
+            {
+                sccp1Sequence = NULL;
+            }
+        }
+    }
+    else
+    {
+        /* Nothing to apply */
+    }
+
+    if( (sccp1TimerObj.callback_fn != NULL))
+    {
+        sccp1TimerObj.callback_fn(status, context);
+    }
+
+    /* Off again once the update is applied or the sequence is done */
+    SCCP1_TimerInterruptUpdate();
+}
+
 
 
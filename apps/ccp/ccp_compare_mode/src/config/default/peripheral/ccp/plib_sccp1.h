@@ -42,6 +42,7 @@
 #define PLIB_SCCP1_H
 
 #include <stddef.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include "device.h"
 #include "plib_ccp_common.h"
@@ -132,6 +133,138 @@ void SCCP1_Compare16bitRBValueSet (uint16_t value);
 
 uint16_t SCCP1_Compare16bitRBValueGet (void);
 
+// *****************************************************************************
+/* Function:
+   void SCCP1_CompareBufferedUpdate (uint16_t period, uint16_t valueA, uint16_t valueB)
+
+  Summary:
+    Stages new compare values for the next period roll-over
+
+  Description:
+    The values are applied together by the SCCP1 timer interrupt, right after
+    the next period roll-over, so the waveform never mixes old and new values.
+    A newer update replaces an update that has not been applied yet.
+
+  Precondition:
+    SCCP1_CompareInitialize must have been called. The SCCP1 timer interrupt
+    is enabled until the values are applied.
+
+  Parameters:
+    period - Timer period in count
+    valueA - Compare value A (RA) in count
+    valueB - Compare value B (RB) in count
+
+  Returns:
+    void
+*/
+void SCCP1_CompareBufferedUpdate (uint16_t period, uint16_t valueA, uint16_t valueB);
+
+// *****************************************************************************
+/* Function:
+   bool SCCP1_CompareUpdateIsPending (void)
+
+  Summary:
+    Returns the state of the buffered update
+
+  Description:
+    Returns true while staged values wait for the next period roll-over.
+
+  Parameters:
+    void
+
+  Returns:
+    bool
+*/
+bool SCCP1_CompareUpdateIsPending (void);
+
+// *****************************************************************************
+/* Function:
+   bool SCCP1_CompareSequenceStart (const CCP_COMPARE_VALUES* table, uint32_t length, uint32_t repeat)
+
+  Summary:
+    Plays back a table of compare values, one entry per period
+
+  Description:
+    The SCCP1 timer interrupt applies the next table entry at every period
+    roll-over, so a pulse train is generated without any work from the
+    application. The table must remain valid while the sequence runs.
+    A buffered update stops a running sequence. The SCCP1 timer interrupt is
+    only enabled while the sequence runs, a buffered update is pending or a
+    timer callback is registered.
+
+  Parameters:
+    table - Compare values, one entry per period
+    length - Number of entries of the table
+    repeat - Number of table playbacks, 0 to repeat until stopped
+
+  Returns:
+    true - The sequence is started
+    false - The table is empty
+*/
+bool SCCP1_CompareSequenceStart (const CCP_COMPARE_VALUES* table, uint32_t length, uint32_t repeat);
+
+// *****************************************************************************
+/* Function:
+   void SCCP1_CompareSequenceStop (void)
+
+  Summary:
+    Stops the compare sequence
+
+  Description:
+    The values of the last applied entry remain in use.
+
+  Parameters:
+    void
+
+  Returns:
+    void
+*/
+void SCCP1_CompareSequenceStop (void);
+
+// *****************************************************************************
+/* Function:
+   bool SCCP1_CompareSequenceIsRunning (void)
+
+  Summary:
+    Returns the state of the compare sequence
+
+  Description:
+    Returns false once all the playbacks of the table are done or the
+    sequence is stopped.
+
+  Parameters:
+    void
+
+  Returns:
+    bool
+*/
+bool SCCP1_CompareSequenceIsRunning (void);
+
+// *****************************************************************************
+/* Function:
+  void SCCP1_TimerCallbackRegister( CCP_TIMER_CALLBACK callback, uintptr_t context )
+
+  Summary:
+    Sets the callback function for a ocmp interrupt.
+
+  Description:
+    This function sets the callback function that will be called when the timer overflows.
+
+  Precondition:
+    None.
+
+  Parameters:
+    *callback   - a pointer to the function to be called when value is reached.
+                  Use NULL to Un Register the timer callback
+
+    context     - a pointer to user defined data to be used when the callback
+                  function is called. NULL can be passed in if no data needed.
+
+  Returns:
+    void
+*/
+void SCCP1_TimerCallbackRegister(CCP_TIMER_CALLBACK callback, uintptr_t context);
+
 
 
 
@@ -49,6 +49,11 @@
 // *****************************************************************************
 
 static volatile CCP_TIMER_OBJECT sccp2TimerObj;
+
+/* Compare values applied at the next period roll-over */
+static volatile CCP_COMPARE_VALUES sccp2Staged;
+static volatile bool sccp2UpdatePending = false;
+
 void SCCP2_CompareInitialize (void)
 {
     /* Disable Timer */
@@ -107,6 +112,27 @@ uint16_t SCCP2_Compare16bitPeriodValueGet (void)
     return (uint16_t)CCP2PR;
 }
 
+void SCCP2_CompareBufferedUpdate (uint16_t period, uint16_t value)
+{
+    /* Hold off the timer interrupt so that it never applies half staged values */
+    bool interruptEnabled = ((IEC1 & _IEC1_CCT2IE_MASK) != 0U);
+    IEC1 &= ~_IEC1_CCT2IE_MASK;
+
+    sccp2Staged.period = period;
+    sccp2Staged.valueA = value;
+    sccp2UpdatePending = true;
+
+    if (interruptEnabled)
+    {
+        IEC1 |= _IEC1_CCT2IE_MASK;
+    }
+}
+
+bool SCCP2_CompareUpdateIsPending (void)
+{
+    return sccp2UpdatePending;
+}
+
 
 
 void SCCP2_TimerCallbackRegister(CCP_TIMER_CALLBACK callback, uintptr_t context)
@@ -123,6 +149,14 @@ void __attribute__((used)) CCT2_InterruptHandler (void)
     uint32_t status = IFS1bits.CCT2IF;
     IFS1 &= ~_IFS1_CCT2IF_MASK;    //Clear IRQ flag
 
+    /* The period has just rolled over, the new values apply to the whole period */
+    if (sccp2UpdatePending)
+    {
+        CCP2PR = sccp2Staged.period;
+        CCP2RA = sccp2Staged.valueA;
+        sccp2UpdatePending = false;
+    }
+
     if( (sccp2TimerObj.callback_fn != NULL))
     {
         sccp2TimerObj.callback_fn(status, context);
@@ -42,6 +42,7 @@
 #define PLIB_SCCP2_H
 
 #include <stddef.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include "device.h"
 #include "plib_ccp_common.h"
@@ -127,6 +128,49 @@ void SCCP2_Compare16bitPeriodValueSet (uint16_t value);
 
 uint16_t SCCP2_Compare16bitPeriodValueGet (void);
 
+// *****************************************************************************
+/* Function:
+   void SCCP2_CompareBufferedUpdate (uint16_t period, uint16_t value)
+
+  Summary:
+    Stages new compare values for the next period roll-over
+
+  Description:
+    The values are applied together by the SCCP2 timer interrupt, right after
+    the next period roll-over, so the waveform never mixes old and new values.
+    A newer update replaces an update that has not been applied yet.
+
+  Precondition:
+    The SCCP2 timer interrupt must be enabled, which is done by
+    SCCP2_CompareInitialize.
+
+  Parameters:
+    period - Timer period in count
+    value - Compare value (RA) in count
+
+  Returns:
+    void
+*/
+void SCCP2_CompareBufferedUpdate (uint16_t period, uint16_t value);
+
+// *****************************************************************************
+/* Function:
+   bool SCCP2_CompareUpdateIsPending (void)
+
+  Summary:
+    Returns the state of the buffered update
+
+  Description:
+    Returns true while staged values wait for the next period roll-over.
+
+  Parameters:
+    void
+
+  Returns:
+    bool
+*/
+bool SCCP2_CompareUpdateIsPending (void);
+
 
 
 // *****************************************************************************
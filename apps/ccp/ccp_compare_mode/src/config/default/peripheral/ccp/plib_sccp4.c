@@ -49,6 +49,11 @@
 // *****************************************************************************
 
 static volatile CCP_TIMER_OBJECT sccp4TimerObj;
+
+/* Compare values applied at the next period roll-over */
+static volatile CCP_COMPARE_VALUES sccp4Staged;
+static volatile bool sccp4UpdatePending = false;
+
 void SCCP4_CompareInitialize (void)
 {
     /* Disable Timer */
@@ -107,6 +112,27 @@ uint16_t SCCP4_Compare16bitPeriodValueGet (void)
     return (uint16_t)CCP4PR;
 }
 
+void SCCP4_CompareBufferedUpdate (uint16_t period, uint16_t value)
+{
+    /* Hold off the timer interrupt so that it never applies half staged values */
+    bool interruptEnabled = ((IEC1 & _IEC1_CCT4IE_MASK) != 0U);
+    IEC1 &= ~_IEC1_CCT4IE_MASK;
+
+    sccp4Staged.period = period;
+    sccp4Staged.valueA = value;
+    sccp4UpdatePending = true;
+
+    if (interruptEnabled)
+    {
+        IEC1 |= _IEC1_CCT4IE_MASK;
+    }
+}
+
+bool SCCP4_CompareUpdateIsPending (void)
+{
+    return sccp4UpdatePending;
+}
+
 
 
 void SCCP4_TimerCallbackRegister(CCP_TIMER_CALLBACK callback, uintptr_t context)
@@ -123,6 +149,14 @@ void __attribute__((used)) CCT4_InterruptHandler (void)
     uint32_t status = IFS1bits.CCT4IF;
     IFS1 &= ~_IFS1_CCT4IF_MASK;    //Clear IRQ flag
 
+    /* The period has just rolled over, the new values apply to the whole period */
+    if (sccp4UpdatePending)
+    {
+        CCP4PR = sccp4Staged.period;
+        CCP4RA = sccp4Staged.valueA;
+        sccp4UpdatePending = false;
+    }
+
     if( (sccp4TimerObj.callback_fn != NULL))
     {
         sccp4TimerObj.callback_fn(status, context);
@@ -52,6 +52,28 @@
 #include <stdlib.h>                     // Defines EXIT_FAILURE
 #include "definitions.h"                // SYS function prototypes
 
+/* Set to 1 to generate a pulse train of increasing pulse widths on the SCCP1
+   dual edge output, one table entry per period */
+#define COMPARE_PULSE_SEQUENCE  (0)
+
+#if (COMPARE_PULSE_SEQUENCE == 1)
+
+/* Period, rising edge (RA) and falling edge (RB) of each pulse */
+static const CCP_COMPARE_VALUES pulseTrain[] =
+{
+    {5000U, 500U, 1000U},
+    {5000U, 500U, 1500U},
+    {5000U, 500U, 2000U},
+    {5000U, 500U, 2500U},
+    {5000U, 500U, 3000U},
+    {5000U, 500U, 3500U},
+    {5000U, 500U, 4000U},
+    {5000U, 500U, 4500U},
+};
+
+#define PULSE_TRAIN_LENGTH  (sizeof(pulseTrain) / sizeof(pulseTrain[0]))
+
+#endif
 
 // *****************************************************************************
 // *****************************************************************************
@@ -65,6 +87,11 @@ int main ( void )
     SYS_Initialize ( NULL );
 
     
+#if (COMPARE_PULSE_SEQUENCE == 1)
+    /* Played back until stopped, the timer interrupt applies the next pulse at each period roll-over */
+    (void)SCCP1_CompareSequenceStart(pulseTrain, PULSE_TRAIN_LENGTH, 0U);
+#endif
+
     /* PIN RB3 - displays dual edge output */
     SCCP1_CompareStart();
     
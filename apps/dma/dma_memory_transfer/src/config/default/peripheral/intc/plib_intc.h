@@ -254,6 +254,9 @@
  */
 typedef uint32_t INT_SOURCE;
 
+/* Highest interrupt priority level */
+#define INTC_PRIORITY_MAX         7U
+
 
 // Section: Interface Routines
 
@@ -475,6 +478,98 @@ bool INTC_Disable( void );
  */
 void INTC_Restore( bool state );
 
+/**
+ * @brief   Sets the priority of an interrupt source.
+ * @details This function sets the priority level of the interrupt source. A
+ *          source of a higher priority preempts the handler of a lower
+ *          priority source when interrupt nesting is enabled. A source of
+ *          priority 0 is disabled.
+ * @pre     None.
+ * @param   source   One of the possible values from INT_SOURCE.
+ * @param   priority Priority level, from 0 to INTC_PRIORITY_MAX.
+ * @return  None.
+ * @note    This API performs a Read-Modify-Write (RMW) operation on the IPCx register.
+ *          To prevent race conditions, please disable global interrupts using
+ *          `INTC_Disable` API before calling this function.
+ *
+ * @b Example
+ * @code
+ * bool prevStatus = INTC_Disable();
+ * INTC_SourcePrioritySet(INT_SOURCE_U3RX, 6U);
+ * INTC_Restore(prevStatus);
+ * @endcode
+ *
+ * @remarks A handler must not change the priority of its own source.
+ */
+void INTC_SourcePrioritySet( INT_SOURCE source, uint32_t priority );
+
+/**
+ * @brief   Returns the priority of an interrupt source.
+ * @details This function returns the priority level of the interrupt source.
+ * @pre     None.
+ * @param   source One of the possible values from INT_SOURCE.
+ * @return  Priority level, from 0 to INTC_PRIORITY_MAX.
+ *
+ * @b Example
+ * @code
+ * uint32_t priority = INTC_SourcePriorityGet(INT_SOURCE_U3RX);
+ * @endcode
+ *
+ * @remarks None.
+ */
+uint32_t INTC_SourcePriorityGet( INT_SOURCE source );
+
+/**
+ * @brief   Enables interrupt nesting.
+ * @details When nesting is enabled, an interrupt of a higher priority preempts
+ *          the handler in progress. This is the reset state.
+ * @pre     None.
+ * @param   None.
+ * @return  None.
+ *
+ * @b Example
+ * @code
+ * INTC_NestingEnable();
+ * @endcode
+ *
+ * @remarks None.
+ */
+void INTC_NestingEnable( void );
+
+/**
+ * @brief   Disables interrupt nesting.
+ * @details When nesting is disabled, a handler always runs to completion and
+ *          the priorities only order the pending interrupts.
+ * @pre     None.
+ * @param   None.
+ * @return  None.
+ *
+ * @b Example
+ * @code
+ * INTC_NestingDisable();
+ * @endcode
+ *
+ * @remarks None.
+ */
+void INTC_NestingDisable( void );
+
+/**
+ * @brief   Returns the interrupt nesting state.
+ * @details This function returns whether an interrupt of a higher priority
+ *          preempts the handler in progress.
+ * @pre     None.
+ * @param   None.
+ * @return  true when interrupt nesting is enabled.
+ *
+ * @b Example
+ * @code
+ * bool nesting = INTC_NestingIsEnabled();
+ * @endcode
+ *
+ * @remarks None.
+ */
+bool INTC_NestingIsEnabled( void );
+
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
@@ -58,6 +58,7 @@
 // Section: Global Data
 
 volatile static I2C_CLIENT_OBJ i2c1Obj;
+volatile static I2C_CLIENT_REGMAP_OBJ i2c1RegMapObj;
 
 void I2C1_Initialize(void)
 {
@@ -91,6 +92,7 @@ void I2C1_Initialize(void)
     _I2C1EIE = 1U;
 
     i2c1Obj.callback = NULL;
+    i2c1RegMapObj.regMap.memory = NULL;
 
     /* Turn on the I2C module */
     I2C1CON1bits.ON = 1U;
@@ -113,6 +115,7 @@ void I2C1_Deinitialize(void)
     I2C1MSK = 0x0UL;
 
     i2c1Obj.callback = NULL;  
+    i2c1RegMapObj.regMap.memory = NULL;
 }
 
 /* I2C client state machine */
@@ -206,6 +209,229 @@ static void I2C1_TransferSM(void)
 
 }
 
+/* Refused byte, reported with the transaction */
+static void I2C1_RegMapAccessError(void)
+{
+    i2c1RegMapObj.transfer.accessError = true;
+    i2c1RegMapObj.transfer.accessErrorCount++;
+}
+
+/* Loads the next byte read by the I2C Master */
+static uint16_t I2C1_RegMapTxByteLoad(uint16_t addrPtr)
+{
+    if (((uint32_t)i2c1RegMapObj.regMap.access & (uint32_t)I2C_CLIENT_REGMAP_ACCESS_READ) != 0U)
+    {
+        I2C1TRN = i2c1RegMapObj.regMap.memory[addrPtr];
+        addrPtr++;
+        if (addrPtr >= i2c1RegMapObj.regMap.size)
+        {
+            addrPtr = 0U;
+        }
+        i2c1RegMapObj.transfer.readCount++;
+    }
+    else
+    {
+        /* A read cannot be NAK'ed by the client, send the fill byte to release
+           the clock and keep the address */
+        I2C1TRN = I2C_CLIENT_REGMAP_FILL_BYTE;
+        I2C1_RegMapAccessError();
+    }
+
+    return addrPtr;
+}
+
+/* I2C client register map state machine */
+static void I2C1_RegMapTransferSM(void)
+{
+    uint32_t i2c_addr;
+    uint8_t rxByte;
+    uint16_t addrPtr = i2c1RegMapObj.addrPtr;
+
+    /* ACK the client interrupt */
+    IFS2bits.I2C1IF = 0U;
+
+    if (I2C1STAT1bits.P != 0U)
+    {
+        /* Stop condition, report the transaction once */
+        if (i2c1RegMapObj.isActive == true)
+        {
+            i2c1RegMapObj.isActive = false;
+
+            if (i2c1RegMapObj.callback != NULL)
+            {
+                I2C_CLIENT_REGMAP_TRANSFER transfer = i2c1RegMapObj.transfer;
+
+                i2c1RegMapObj.callback(&transfer, i2c1RegMapObj.context);
+            }
+        }
+    }
+    else if (I2C1STAT1bits.D_A == 0U)
+    {
+        if (I2C1STAT1bits.RBF != 0U)
+        {
+            /* Received I2C address must be read out */
+            i2c_addr = I2C1RCV;
+            (void)i2c_addr;
+
+            if (i2c1RegMapObj.isActive == false)
+            {
+                i2c1RegMapObj.isActive = true;
+                i2c1RegMapObj.transfer.startAddress = addrPtr;
+                i2c1RegMapObj.transfer.writeCount = 0U;
+                i2c1RegMapObj.transfer.readCount = 0U;
+                i2c1RegMapObj.transfer.accessError = false;
+                i2c1RegMapObj.transfer.accessErrorCount = 0U;
+            }
+
+            if (I2C1STAT1bits.R_W != 0U)
+            {
+                if (i2c1RegMapObj.transfer.writeCount == 0U)
+                {
+                    /* Read after a repeated start starts at the address just written */
+                    i2c1RegMapObj.transfer.startAddress = addrPtr;
+                }
+                i2c1RegMapObj.addrIndex = 0U;
+
+                /* Load the first byte, the address is ACK'ed by hardware */
+                addrPtr = I2C1_RegMapTxByteLoad(addrPtr);
+            }
+            else
+            {
+                /* Memory address follows, MSB first */
+                i2c1RegMapObj.addrIndex = i2c1RegMapObj.regMap.addressBytes;
+                i2c1RegMapObj.rxAddress = 0U;
+                I2C1CON1bits.ACKDT = 0U;
+            }
+        }
+    }
+    else
+    {
+        /* Master reads from client, client transmits */
+        if (I2C1STAT1bits.R_W != 0U)
+        {
+            if (((I2C1STAT1 & (_I2C1STAT1_TBF_MASK | _I2C1STAT1_ACKSTAT_MASK))  == 0U))
+            {
+                addrPtr = I2C1_RegMapTxByteLoad(addrPtr);
+            }
+        }
+        /* Master writes to client, client receives */
+        else
+        {
+            if ((I2C1STAT1 & _I2C1STAT1_RBF_MASK) != 0U)
+            {
+                rxByte = (uint8_t)I2C1RCV;
+
+                if (i2c1RegMapObj.addrIndex > 0U)
+                {
+                    i2c1RegMapObj.addrIndex--;
+                    i2c1RegMapObj.rxAddress = (uint16_t)((uint32_t)i2c1RegMapObj.rxAddress << 8U) | rxByte;
+
+                    if (i2c1RegMapObj.addrIndex == 0U)
+                    {
+                        if (i2c1RegMapObj.rxAddress < i2c1RegMapObj.regMap.size)
+                        {
+                            addrPtr = i2c1RegMapObj.rxAddress;
+                            i2c1RegMapObj.transfer.startAddress = addrPtr;
+                            I2C1CON1bits.ACKDT = 0U;
+                        }
+                        else
+                        {
+                            I2C1_RegMapAccessError();
+                            I2C1CON1bits.ACKDT = 1U;
+                        }
+                    }
+                    else
+                    {
+                        I2C1CON1bits.ACKDT = 0U;
+                    }
+                }
+                else if (((uint32_t)i2c1RegMapObj.regMap.access & (uint32_t)I2C_CLIENT_REGMAP_ACCESS_WRITE) != 0U)
+                {
+                    i2c1RegMapObj.regMap.memory[addrPtr] = rxByte;
+                    addrPtr++;
+
+                    if (i2c1RegMapObj.regMap.pageSize != 0U)
+                    {
+                        /* If exceeding the page boundary, rollover to the start of the page */
+                        if ((addrPtr % i2c1RegMapObj.regMap.pageSize) == 0U)
+                        {
+                            addrPtr -= (uint16_t)i2c1RegMapObj.regMap.pageSize;
+                        }
+                    }
+                    else if (addrPtr >= i2c1RegMapObj.regMap.size)
+                    {
+                        addrPtr = 0U;
+                    }
+                    else
+                    {
+                        /* Do Nothing */
+                    }
+                    i2c1RegMapObj.transfer.writeCount++;
+                    I2C1CON1bits.ACKDT = 0U;
+                }
+                else
+                {
+                    I2C1_RegMapAccessError();
+                    I2C1CON1bits.ACKDT = 1U;
+                }
+            }
+        }
+    }
+
+    i2c1RegMapObj.addrPtr = addrPtr;
+
+    // Release clock stretch on 9th bit
+    I2C1CON1bits.SCLREL = 1U;
+}
+
+bool I2C1_RegMapRegister(const I2C_CLIENT_REGMAP* regMap, I2C_CLIENT_REGMAP_CALLBACK callback, uintptr_t contextHandle)
+{
+    size_t maxSize;
+
+    if (regMap == NULL)
+    {
+        i2c1RegMapObj.regMap.memory = NULL;
+        return true;
+    }
+
+    if ((regMap->memory == NULL) || (regMap->size == 0U) ||
+        (regMap->addressBytes < 1U) || (regMap->addressBytes > 2U) ||
+        (regMap->pageSize > regMap->size))
+    {
+        return false;
+    }
+
+    /* The page roll over assumes that the pages tile the whole window */
+    if ((regMap->pageSize != 0U) && ((regMap->size % regMap->pageSize) != 0U))
+    {
+        return false;
+    }
+
+    maxSize = (regMap->addressBytes == 1U) ? 0x100U : 0x10000U;
+    if (regMap->size > maxSize)
+    {
+        return false;
+    }
+
+    /* Keep the interrupt from seeing a partially updated window */
+    _I2C1IE = 0U;
+
+    i2c1RegMapObj.regMap.size = regMap->size;
+    i2c1RegMapObj.regMap.pageSize = regMap->pageSize;
+    i2c1RegMapObj.regMap.addressBytes = regMap->addressBytes;
+    i2c1RegMapObj.regMap.access = regMap->access;
+    i2c1RegMapObj.callback = callback;
+    i2c1RegMapObj.context = contextHandle;
+    i2c1RegMapObj.addrPtr = 0U;
+    i2c1RegMapObj.addrIndex = 0U;
+    i2c1RegMapObj.isActive = false;
+    i2c1RegMapObj.regMap.memory = regMap->memory;
+
+    _I2C1IE = 1U;
+
+    return true;
+}
+
 void I2C1_CallbackRegister(I2C_CLIENT_CALLBACK callback, uintptr_t contextHandle)
 {
     if (callback != NULL)
@@ -274,5 +500,12 @@ void __attribute__((used)) I2C1E_InterruptHandler(void)
 
 void __attribute__((used)) I2C1_InterruptHandler(void)
 {
-    I2C1_TransferSM();
+    if (i2c1RegMapObj.regMap.memory != NULL)
+    {
+        I2C1_RegMapTransferSM();
+    }
+    else
+    {
+        I2C1_TransferSM();
+    }
 }
@@ -173,6 +173,33 @@ I2C_CLIENT_ACK_STATUS I2C1_LastByteAckStatusGet(void);
 */
 I2C_CLIENT_ERROR I2C1_ErrorGet(void);
 
+/**
+ * @breif       Switches the PLIB to register map mode.
+ * @description In register map mode the PLIB serves a memory window on its own. Address
+ *              bytes, auto-increment, page roll over and window wrap are handled inside
+ *              the peripheral interrupt without calling the application per byte. Written
+ *              bytes outside the window or not permitted by the access setting are NAK'ed.
+ *              When reads are denied, I2C_CLIENT_REGMAP_FILL_BYTE is sent for each byte
+ *              read and the address pointer does not move.
+ *              The address pointer is kept between transactions, so that the I2C Master
+ *              can read from the current address.
+ *
+ *              The callback is called once per transaction, after the Stop condition,
+ *              with a summary of the transaction.
+ * @pre         I2C1_Initialize must have been called for the
+ *              associated I2C instance.
+ * @param       regMap   - Description of the memory window. The structure is copied.
+ *                         NULL returns to the per byte callback mode of
+ *                         I2C1_CallbackRegister.
+ *              callback - Transaction complete callback. May be NULL.
+ *              contextHandle - A value passed into the callback.
+ * @return      true  - Register map mode was set up.
+ *              false - The window description is invalid, or the page size does
+ *                      not divide the window size.
+ * @remarks     The window must not be resized while a transaction is in progress.
+*/
+bool I2C1_RegMapRegister(const I2C_CLIENT_REGMAP* regMap, I2C_CLIENT_REGMAP_CALLBACK callback, uintptr_t contextHandle);
+
 
 // /cond IGNORE_THIS
 #ifdef __cplusplus  // Provide C++ Compatibility
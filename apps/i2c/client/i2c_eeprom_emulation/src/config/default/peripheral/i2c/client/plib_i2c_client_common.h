@@ -130,6 +130,91 @@ typedef enum
 */
 typedef bool (*I2C_CLIENT_CALLBACK) (I2C_CLIENT_TRANSFER_EVENT event, uintptr_t contextHandle);
 
+/**  
+ * @summary         I2C Client Register Map Access Enums
+ * @breif           Defines the access permissions of a register map window.
+ * @remarks         None
+ */
+typedef enum
+{
+    I2C_CLIENT_REGMAP_ACCESS_READ = 0x1,        /* I2C Master may read the window */
+    I2C_CLIENT_REGMAP_ACCESS_WRITE = 0x2,       /* I2C Master may write the window */
+    I2C_CLIENT_REGMAP_ACCESS_READ_WRITE = 0x3
+
+} I2C_CLIENT_REGMAP_ACCESS;
+
+/**  
+ * @summary         I2C Client Register Map Window
+ * @breif           Describes the memory window served by the PLIB in register map mode.
+ *                  The I2C Master first writes addressBytes of memory address (MSB first),
+ *                  followed by the data to be written, or issues a read to fetch data from
+ *                  the current address.
+ * @remarks         None
+ */
+typedef struct
+{
+    /* Memory window */
+    uint8_t*                    memory;
+
+    /* Size of the window in bytes */
+    size_t                      size;
+
+    /* Writes roll over to the start of the page at a page boundary, the page size
+       must divide the window size. Zero disables page roll over, writes then wrap
+       at the end of the window like reads do. */
+    size_t                      pageSize;
+
+    /* Number of address bytes sent by the I2C Master, 1 or 2 */
+    uint8_t                     addressBytes;
+
+    /* Access permissions of the I2C Master */
+    I2C_CLIENT_REGMAP_ACCESS    access;
+
+} I2C_CLIENT_REGMAP;
+
+/**  
+ * @summary         I2C Client Register Map Transfer Summary
+ * @breif           Describes a complete transaction handled in register map mode.
+ * @remarks         None
+ */
+typedef struct
+{
+    /* Address of the first data byte written or read */
+    uint16_t                    startAddress;
+
+    /* Number of data bytes written by the I2C Master, excluding address bytes */
+    size_t                      writeCount;
+
+    /* Number of data bytes read by the I2C Master */
+    size_t                      readCount;
+
+    /* A byte was NAK'ed because of the window bounds or access permissions,
+       or a fill byte was sent instead of a denied read */
+    bool                        accessError;
+
+    /* Number of bytes refused or replaced by the fill byte */
+    size_t                      accessErrorCount;
+
+} I2C_CLIENT_REGMAP_TRANSFER;
+
+/* Byte sent to the I2C Master when reads are denied. The read address is ACK'ed
+   by hardware, so a byte must be sent to release the clock. */
+#define I2C_CLIENT_REGMAP_FILL_BYTE     (0xFFU)
+
+/* I2C Client Register Map Callback
+
+   Summary:
+    I2C Client Register Map Callback Function Pointer.
+
+   Description:
+    This data type defines the function called once per transaction, after the
+    Stop condition, in register map mode.
+
+   Remarks:
+    None.
+*/
+typedef void (*I2C_CLIENT_REGMAP_CALLBACK) (const I2C_CLIENT_REGMAP_TRANSFER* transfer, uintptr_t contextHandle);
+
 // /cond IGNORE_THIS
 // Section: Local Objects **** Do Not Use ****
 
@@ -141,6 +226,18 @@ typedef struct
     uint8_t                 lastByteWritten;
 } I2C_CLIENT_OBJ;
 
+typedef struct
+{
+    I2C_CLIENT_REGMAP               regMap;
+    I2C_CLIENT_REGMAP_CALLBACK      callback;
+    uintptr_t                       context;
+    I2C_CLIENT_REGMAP_TRANSFER      transfer;
+    uint16_t                        addrPtr;
+    uint16_t                        rxAddress;
+    uint8_t                         addrIndex;
+    bool                            isActive;
+} I2C_CLIENT_REGMAP_OBJ;
+
 // /endcond
 
 // /cond IGNORE_THIS
@@ -68,16 +68,6 @@
 // *****************************************************************************
 // *****************************************************************************
 
-typedef struct
-{
-    /* currentAddrPtr - to allow for sequential read (from the current address) */
-    uint16_t                    currentAddrPtr;
-    /* addrIndex - used to copy 2 bytes of EEPROM memory address */
-    uint8_t                     addrIndex;        
-}EEPROM_DATA;
-
-static EEPROM_DATA         eepromData;
-
 static uint8_t EEPROM_EmulationBuffer[EEPROM_SIZE_BYTES] =
 {
     0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f,
@@ -115,60 +105,26 @@ static uint8_t EEPROM_EmulationBuffer[EEPROM_SIZE_BYTES] =
     0xf0,0xf1,0xf2,0xf3,0xf4,0xf5,0xf6,0xf7,0xf8,0xf9,0xfa,0xfb,0xfc,0xfd,0xfe,0xff
 };
 
-bool APP_I2C_SLAVE_Callback ( I2C_CLIENT_TRANSFER_EVENT event, uintptr_t contextHandle )
+static const I2C_CLIENT_REGMAP eepromRegMap =
 {
-    bool isSuccess = true;
-
-    switch(event)
-    {
-        case I2C_CLIENT_TRANSFER_EVENT_ADDR_MATCH:
-            
-            /* Reset the index. MSB address is sent first followed by LSB. */
-            eepromData.addrIndex = 2;
-            
-            break;
-
-        case I2C_CLIENT_TRANSFER_EVENT_RX_READY:
-            /* Read the data sent by I2C Master */
-            if (eepromData.addrIndex > 0)
-            {
-                ((uint8_t*)&eepromData.currentAddrPtr)[--eepromData.addrIndex] = I2C1_ReadByte();
-            }
-            else
-            {
-                EEPROM_EmulationBuffer[eepromData.currentAddrPtr++] = I2C1_ReadByte();
-                
-                /* If exceeding the page boundary, rollover to the start of the page */
-                if ((eepromData.currentAddrPtr % EEPROM_PAGE_SIZE_BYTES) == 0)
-                {
-                    eepromData.currentAddrPtr -= EEPROM_PAGE_SIZE_BYTES;
-                }                                                              
-            }
-            break;
-
-        case I2C_CLIENT_TRANSFER_EVENT_TX_READY:
-            
-            /* Provide the EEPROM data requested by the I2C Master */
-            I2C1_WriteByte(EEPROM_EmulationBuffer[eepromData.currentAddrPtr++]);
-            if (eepromData.currentAddrPtr >= EEPROM_SIZE_BYTES)
-            {
-                eepromData.currentAddrPtr = 0;
-            }
-            break;
-        
-        default:
-            break;
-    }
-
-    return isSuccess;
-}
+    .memory         = EEPROM_EmulationBuffer,
+    .size           = EEPROM_SIZE_BYTES,
+    .pageSize       = EEPROM_PAGE_SIZE_BYTES,
+    .addressBytes   = 2,
+    .access         = I2C_CLIENT_REGMAP_ACCESS_READ_WRITE,
+};
 
 int main ( void )
 {
     /* Initialize all modules */
     SYS_Initialize ( NULL );
 
-    I2C1_CallbackRegister(APP_I2C_SLAVE_Callback, 0);
+    /* The PLIB handles the EEPROM address bytes, auto-increment and page roll over */
+    if (I2C1_RegMapRegister(&eepromRegMap, NULL, 0) == false)
+    {
+        /* The EEPROM geometry is invalid, the client is not served */
+        return ( EXIT_FAILURE );
+    }
 
     while ( true )
     {
@@ -55,13 +55,124 @@
 #define I2C1CON1_SDAHT_100NS          ((uint32_t)(_I2C1CON1_SDAHT_MASK & ((uint32_t)(0) << _I2C1CON1_SDAHT_POSITION))) 
 #define I2C1CON1_SDAHT_300NS          ((uint32_t)(_I2C1CON1_SDAHT_MASK & ((uint32_t)(1) << _I2C1CON1_SDAHT_POSITION))) 
 
+//I2CxBRG limits
+#define I2C1_BRG_MIN                    0x4UL
+#define I2C1_BRG_MAX                    0xFFFFFFUL
+
+//Pulse gobbler delay added by the module to each SCL phase, in ns
+#define I2C1_PGD_DELAY_NS               200UL
+
+#define I2C1_NS_PER_SECOND              1000000000UL
+
+//Number of clients for which a bus speed can be registered
+#define I2C1_CLIENT_BUS_SPEED_MAP_SIZE  8U
+
+//Speed class of the baud rate configured from the MHC or by I2C1_TransferSetup
+#define I2C1_BUS_SPEED_SETUP            I2C_BUS_SPEED_MAX
+
 // Section: Global Data
 
 #define NOP asm(" NOP")
 volatile static I2C_HOST_OBJ i2c1Obj;
 
+/* I2C bus specification limits of each speed class */
+static const I2C_BUS_SPEED_SPEC i2c1BusSpeedSpec[I2C_BUS_SPEED_MAX] =
+{
+    /* Standard mode */
+    { 100000UL,  4700UL, 4000UL, 1000UL, 300UL, false },
+    /* Fast mode */
+    { 400000UL,  1300UL,  600UL,  300UL, 300UL, true  },
+    /* Fast mode plus */
+    { 1000000UL,  500UL,  260UL,  120UL, 120UL, false },
+};
+
+static I2C_BUS_SPEED_CONFIG i2c1BusSpeedConfig[I2C_BUS_SPEED_MAX];
+
+static I2C_CLIENT_BUS_SPEED i2c1ClientBusSpeed[I2C1_CLIENT_BUS_SPEED_MAP_SIZE];
+
+/* Baud rate configured from the MHC or by I2C1_TransferSetup */
+static I2C_BUS_SPEED_CONFIG i2c1SetupBusSpeedConfig;
+
+static uint32_t I2C1_PhaseToBRG(uint32_t phaseNs, uint32_t srcClkFreq)
+{
+    uint64_t counts;
+    uint32_t brgValue;
+
+    if (phaseNs <= I2C1_PGD_DELAY_NS)
+    {
+        return I2C1_BRG_MIN;
+    }
+
+    /* Round up so that the phase is never shorter than requested */
+    counts = (((uint64_t)(phaseNs - I2C1_PGD_DELAY_NS) * srcClkFreq) + (I2C1_NS_PER_SECOND - 1U)) / I2C1_NS_PER_SECOND;
+
+    if (counts < (I2C1_BRG_MIN + 3U))
+    {
+        brgValue = I2C1_BRG_MIN;
+    }
+    else if (counts > ((uint64_t)I2C1_BRG_MAX + 3U))
+    {
+        /* Out of range, reported to the caller as zero */
+        brgValue = 0U;
+    }
+    else
+    {
+        brgValue = (uint32_t)counts - 3U;
+    }
+
+    return brgValue;
+}
+
+static uint32_t I2C1_BRGToPhase(uint32_t brgValue, uint32_t srcClkFreq)
+{
+    return (uint32_t)((((uint64_t)brgValue + 3U) * I2C1_NS_PER_SECOND) / srcClkFreq) + I2C1_PGD_DELAY_NS;
+}
+
+static void I2C1_BusSpeedApply(I2C_BUS_SPEED speed)
+{
+    const I2C_BUS_SPEED_CONFIG* config;
+
+    if ((speed < I2C_BUS_SPEED_MAX) && (i2c1BusSpeedConfig[speed].valid == true))
+    {
+        config = &i2c1BusSpeedConfig[speed];
+    }
+    else
+    {
+        /* Clients without a usable speed class run at the setup baud rate */
+        speed = I2C1_BUS_SPEED_SETUP;
+        config = &i2c1SetupBusSpeedConfig;
+    }
+
+    /* Registers are only written when the speed class changes */
+    if (speed != i2c1Obj.busSpeed)
+    {
+        I2C1HBRG = config->hbrg;
+        I2C1LBRG = config->lbrg;
+        I2C1CON1bits.DISSLW = (config->slewRateControl == true) ? 0U : 1U;
+        i2c1Obj.busSpeed = speed;
+    }
+}
+
+static I2C_BUS_SPEED I2C1_ClientBusSpeedLookup(uint16_t address)
+{
+    I2C_BUS_SPEED speed = i2c1Obj.defaultBusSpeed;
+    uint32_t i;
+
+    for (i = 0U; i < I2C1_CLIENT_BUS_SPEED_MAP_SIZE; i++)
+    {
+        if ((i2c1ClientBusSpeed[i].busSpeed != I2C_BUS_SPEED_INVALID) && (i2c1ClientBusSpeed[i].address == address))
+        {
+            speed = i2c1ClientBusSpeed[i].busSpeed;
+            break;
+        }
+    }
+
+    return speed;
+}
+
 void I2C1_Initialize(void)
 {
+    uint32_t i;
 
     _I2C1IE = 0U;
     _I2C1EIE = 0U;
@@ -94,6 +205,26 @@ void I2C1_Initialize(void)
 
     /* Set the initial state of the I2C state machine */
     i2c1Obj.state = I2C_STATE_IDLE;
+
+    /* Compute the settings of each speed class for worst case bus timing.
+     * The BRG values written above are kept until a class is selected. */
+    for (i = 0U; i < (uint32_t)I2C_BUS_SPEED_MAX; i++)
+    {
+        (void)I2C1_BusSpeedConfigure((I2C_BUS_SPEED)i, NULL);
+    }
+
+    for (i = 0U; i < I2C1_CLIENT_BUS_SPEED_MAP_SIZE; i++)
+    {
+        i2c1ClientBusSpeed[i].busSpeed = I2C_BUS_SPEED_INVALID;
+    }
+
+    i2c1SetupBusSpeedConfig.hbrg = 0x1ddUL;
+    i2c1SetupBusSpeedConfig.lbrg = 0x1ddUL;
+    i2c1SetupBusSpeedConfig.slewRateControl = false;
+    i2c1SetupBusSpeedConfig.valid = true;
+
+    i2c1Obj.busSpeed = I2C1_BUS_SPEED_SETUP;
+    i2c1Obj.defaultBusSpeed = I2C_BUS_SPEED_INVALID;
 }
 
 void I2C1_Deinitialize(void)
@@ -395,6 +526,8 @@ bool I2C1_Read(uint16_t address, uint8_t* rdata, size_t rlength)
         i2c1Obj.transferType        = I2C_TRANSFER_TYPE_READ;
         i2c1Obj.error               = I2C_ERROR_NONE;
         i2c1Obj.state               = I2C_STATE_ADDR_BYTE_1_SEND;
+
+        I2C1_BusSpeedApply(I2C1_ClientBusSpeedLookup(address));
         I2C1CON1bits.SEN = 1U;
         _I2C1IE = 1U;
         _I2C1EIE = 1U;
@@ -421,7 +554,9 @@ bool I2C1_Write(uint16_t address, uint8_t* wdata, size_t wlength)
         i2c1Obj.transferType        = I2C_TRANSFER_TYPE_WRITE;
         i2c1Obj.error               = I2C_ERROR_NONE;
         i2c1Obj.state               = I2C_STATE_ADDR_BYTE_1_SEND;
-        
+
+        I2C1_BusSpeedApply(I2C1_ClientBusSpeedLookup(address));
+
         I2C1CON1bits.SEN = 1U;
         _I2C1IE = 1U;
         _I2C1EIE= 1U;
@@ -450,6 +585,8 @@ bool I2C1_WriteRead(uint16_t address, uint8_t* wdata, size_t wlength, uint8_t* r
         i2c1Obj.error               = I2C_ERROR_NONE;
         i2c1Obj.state               = I2C_STATE_ADDR_BYTE_1_SEND;
 
+        I2C1_BusSpeedApply(I2C1_ClientBusSpeedLookup(address));
+
         I2C1CON1bits.SEN = 1U;
         _I2C1IE = 1U;
         _I2C1EIE = 1U;
@@ -489,7 +626,7 @@ bool I2C1_TransferSetup(I2C_TRANSFER_SETUP* setup, uint32_t srcClkFreq )
 
     if( srcClkFreq == 0U)
     {
-        srcClkFreq = 100000000UL;
+        srcClkFreq = I2C1_FrequencyGet();
     }
     
     fBaudValue = (float)((((1.0f / (2.0f * (float)i2cClkSpeed)) - 0.0000002f) * (float)srcClkFreq) - 3.0f);
@@ -515,6 +652,164 @@ bool I2C1_TransferSetup(I2C_TRANSFER_SETUP* setup, uint32_t srcClkFreq )
         I2C1CON1bits.DISSLW = 1U;
     }
 
+    /* Restored for unregistered clients after a transfer at another speed class */
+    i2c1SetupBusSpeedConfig.hbrg = baudValue;
+    i2c1SetupBusSpeedConfig.lbrg = baudValue;
+    i2c1SetupBusSpeedConfig.slewRateControl = (i2cClkSpeed == 400000U);
+
+    i2c1Obj.busSpeed = I2C1_BUS_SPEED_SETUP;
+    i2c1Obj.defaultBusSpeed = I2C_BUS_SPEED_INVALID;
+
+    return true;
+}
+
+bool I2C1_BusSpeedConfigure(I2C_BUS_SPEED speed, const I2C_BUS_TIMING* timing)
+{
+    const I2C_BUS_SPEED_SPEC* spec;
+    I2C_BUS_SPEED_CONFIG config;
+    uint32_t srcClkFreq = I2C1_FrequencyGet();
+    uint32_t riseTimeNs;
+    uint32_t fallTimeNs;
+    uint32_t periodNs;
+    uint32_t edgeTimeNs;
+    uint32_t slackNs;
+    uint32_t tLowNs;
+    uint32_t tHighNs;
+
+    if (speed >= I2C_BUS_SPEED_MAX)
+    {
+        return false;
+    }
+
+    spec = &i2c1BusSpeedSpec[speed];
+
+    if (timing != NULL)
+    {
+        riseTimeNs = timing->riseTimeNs;
+        fallTimeNs = timing->fallTimeNs;
+    }
+    else
+    {
+        riseTimeNs = spec->riseTimeMaxNs;
+        fallTimeNs = spec->fallTimeMaxNs;
+    }
+
+    i2c1BusSpeedConfig[speed].valid = false;
+
+    /* Bus is too slow for this speed class */
+    if ((riseTimeNs > spec->riseTimeMaxNs) || (fallTimeNs > spec->fallTimeMaxNs))
+    {
+        return false;
+    }
+
+    periodNs = I2C1_NS_PER_SECOND / spec->clkSpeed;
+    edgeTimeNs = riseTimeNs + fallTimeNs + spec->tLowMinNs + spec->tHighMinNs;
+
+    if (edgeTimeNs > periodNs)
+    {
+        return false;
+    }
+
+    /* Share the time left over by fast edges between both SCL phases */
+    slackNs = periodNs - edgeTimeNs;
+    tLowNs = spec->tLowMinNs + (slackNs / 2U);
+    tHighNs = spec->tHighMinNs + (slackNs - (slackNs / 2U));
+
+    config.lbrg = I2C1_PhaseToBRG(tLowNs, srcClkFreq);
+    config.hbrg = I2C1_PhaseToBRG(tHighNs, srcClkFreq);
+
+    if ((config.lbrg == 0U) || (config.hbrg == 0U))
+    {
+        return false;
+    }
+
+    periodNs = I2C1_BRGToPhase(config.lbrg, srcClkFreq) + I2C1_BRGToPhase(config.hbrg, srcClkFreq) + riseTimeNs + fallTimeNs;
+
+    config.clkSpeed = I2C1_NS_PER_SECOND / periodNs;
+    config.riseMarginNs = spec->riseTimeMaxNs - riseTimeNs;
+    config.slewRateControl = spec->slewRateControl;
+    config.valid = true;
+
+    i2c1BusSpeedConfig[speed] = config;
+
+    /* Force the registers to be reloaded on the next transfer */
+    if (i2c1Obj.busSpeed == speed)
+    {
+        i2c1Obj.busSpeed = I2C_BUS_SPEED_INVALID;
+    }
+
+    return true;
+}
+
+bool I2C1_BusSpeedConfigGet(I2C_BUS_SPEED speed, I2C_BUS_SPEED_CONFIG* config)
+{
+    if ((speed >= I2C_BUS_SPEED_MAX) || (config == NULL))
+    {
+        return false;
+    }
+
+    *config = i2c1BusSpeedConfig[speed];
+
+    return config->valid;
+}
+
+bool I2C1_BusSpeedSet(I2C_BUS_SPEED speed)
+{
+    if ((speed >= I2C_BUS_SPEED_MAX) || (i2c1BusSpeedConfig[speed].valid == false))
+    {
+        return false;
+    }
+
+    i2c1Obj.defaultBusSpeed = speed;
+
+    return true;
+}
+
+bool I2C1_ClientBusSpeedSet(uint16_t address, I2C_BUS_SPEED speed)
+{
+    uint32_t i;
+    uint32_t freeIndex = I2C1_CLIENT_BUS_SPEED_MAP_SIZE;
+
+    if ((speed != I2C_BUS_SPEED_INVALID) &&
+        ((speed >= I2C_BUS_SPEED_MAX) || (i2c1BusSpeedConfig[speed].valid == false)))
+    {
+        return false;
+    }
+
+    for (i = 0U; i < I2C1_CLIENT_BUS_SPEED_MAP_SIZE; i++)
+    {
+        if (i2c1ClientBusSpeed[i].busSpeed == I2C_BUS_SPEED_INVALID)
+        {
+            if (freeIndex == I2C1_CLIENT_BUS_SPEED_MAP_SIZE)
+            {
+                freeIndex = i;
+            }
+        }
+        else if (i2c1ClientBusSpeed[i].address == address)
+        {
+            /* Update or remove an existing entry */
+            i2c1ClientBusSpeed[i].busSpeed = speed;
+            return true;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    if (speed == I2C_BUS_SPEED_INVALID)
+    {
+        return true;
+    }
+
+    if (freeIndex == I2C1_CLIENT_BUS_SPEED_MAP_SIZE)
+    {
+        return false;
+    }
+
+    i2c1ClientBusSpeed[freeIndex].address = address;
+    i2c1ClientBusSpeed[freeIndex].busSpeed = speed;
+
     return true;
 }
 
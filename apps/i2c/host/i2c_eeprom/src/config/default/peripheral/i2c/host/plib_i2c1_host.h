@@ -45,6 +45,7 @@
 // Section: Included Files
 
 #include "plib_i2c_host_common.h"
+#include "peripheral/clk/plib_clk.h"
 
 // /cond IGNORE_THIS
 #ifdef __cplusplus // Provide C++ Compatibility
@@ -55,6 +56,11 @@
 #endif
 // /endcond
 
+// Section: Macro Definitions
+
+/* I2C1 is clocked from the standard speed peripheral clock (Fosc/2) */
+#define I2C1_FrequencyGet()    (uint32_t)(CLOCK_GeneratorFrequencyGet(CLOCK_GENERATOR_1) / 2U)
+
 // Section: Interface Routines
 
 /** 
@@ -245,9 +251,73 @@ void I2C1_CallbackRegister(I2C_CALLBACK callback, uintptr_t contextHandle);
  *                  false - Failure while updating transfer setup.
  * @remarks     srcClkFreq overrides any change in the peripheral clock frequency.
  *              If configured to zero PLib takes the peripheral clock frequency from MHC.
+ *              The default bus speed selected by I2C1_BusSpeedSet is cleared.
 */
 bool I2C1_TransferSetup(I2C_TRANSFER_SETUP* setup, uint32_t srcClkFreq );
 
+/**
+ * @breif           Computes and caches the baud rate generator settings of a bus speed class.
+ * @details         The SCL low and high times are derived from the I2C1 source clock
+ *                  \ref I2C1_FrequencyGet and the given bus timing, and are validated against
+ *                  the I2C bus specification minimums of the speed class. Any time left over
+ *                  by fast edges is shared between both SCL phases. The result is cached so
+ *                  that switching speed before a transfer is only two register writes.
+ *
+ *                  I2C1_Initialize configures all speed classes for the worst case rise
+ *                  and fall times allowed by the specification.
+ * @pre             I2C1_Initialize must have been called for the associated I2C instance.
+ * @param           speed  -    Speed class to configure.
+ *                  timing -    Measured bus rise and fall times. NULL selects the
+ *                              specification maximums of the speed class.
+ * @return          true  -     Speed class is usable on this bus.
+ *                  false -     Bus edges are too slow for the speed class or the
+ *                              baud rate cannot be reached from the source clock.
+ * @remarks         A speed class that fails validation cannot be selected until it is
+ *                  configured successfully.
+*/
+bool I2C1_BusSpeedConfigure(I2C_BUS_SPEED speed, const I2C_BUS_TIMING* timing);
+
+/**
+ * @breif           Returns the cached settings of a bus speed class.
+ * @pre             I2C1_Initialize must have been called for the associated I2C instance.
+ * @param           speed  -    Speed class.
+ *                  config -    Pointer to the structure receiving the settings, including
+ *                              the actual SCL frequency and the remaining rise time margin.
+ * @return          true  -     Speed class is valid.
+ *                  false -     Speed class is invalid or not usable on this bus.
+ * @remarks         None
+*/
+bool I2C1_BusSpeedConfigGet(I2C_BUS_SPEED speed, I2C_BUS_SPEED_CONFIG* config);
+
+/**
+ * @breif           Selects the bus speed used for clients without a registered speed.
+ * @pre             I2C1_Initialize must have been called for the associated I2C instance.
+ * @param           speed -     Speed class.
+ * @return          true  -     Default speed was updated.
+ *                  false -     Speed class is not usable on this bus.
+ * @remarks         Until this function is called, transfers to unregistered clients use the
+ *                  baud rate configured from the MHC or by I2C1_TransferSetup. That baud
+ *                  rate is restored after a transfer to a client at another speed class.
+*/
+bool I2C1_BusSpeedSet(I2C_BUS_SPEED speed);
+
+/**
+ * @breif           Registers the bus speed of a client.
+ * @details         I2C1_Read, I2C1_Write and I2C1_WriteRead switch the bus to the
+ *                  registered speed of the addressed client before generating the Start
+ *                  condition, so that fast clients are not throttled by slow ones sharing
+ *                  the bus. The registers are only written when the speed class changes.
+ * @pre             I2C1_Initialize must have been called for the associated I2C instance.
+ * @param           address -   7-bit / 10-bit client address.
+ *                  speed   -   Speed class of the client. I2C_BUS_SPEED_INVALID removes
+ *                              the client registration.
+ * @return          true  -     Client speed was registered.
+ *                  false -     Speed class is not usable on this bus or no free entry is left.
+ * @remarks         Every device on the bus must tolerate the fastest speed used, since
+ *                  all of them see the traffic addressed to other clients.
+*/
+bool I2C1_ClientBusSpeedSet(uint16_t address, I2C_BUS_SPEED speed);
+
 /**
  * @breif           Force stops the I2C transfer
  * @pre             None
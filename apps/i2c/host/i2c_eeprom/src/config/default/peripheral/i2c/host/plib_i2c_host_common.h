@@ -121,6 +121,73 @@ typedef struct
 
 } I2C_TRANSFER_SETUP;
 
+/**
+ *  @summary        I2C Bus Speed Class
+ *  @breif          This data type defines the bus speed classes for which the PLib
+ *                  computes and caches the baud rate generator settings.
+ *  @remarks        None
+*/
+typedef enum
+{
+    /* Standard mode, 100 kHz */
+    I2C_BUS_SPEED_STANDARD = 0U,
+
+    /* Fast mode, 400 kHz */
+    I2C_BUS_SPEED_FAST,
+
+    /* Fast mode plus, 1 MHz */
+    I2C_BUS_SPEED_FAST_PLUS,
+
+    I2C_BUS_SPEED_MAX,
+
+    I2C_BUS_SPEED_INVALID = 0xFFU
+
+} I2C_BUS_SPEED;
+
+/**
+ *  @summary        I2C Bus Timing Data Structure
+ *  @breif          This data structure defines the measured (or worst case) SCL/SDA
+ *                  edge times of the bus, used to validate a speed class.
+ *  @remarks        Times are in nanoseconds, measured between 30% and 70% of VDD.
+*/
+typedef struct
+{
+    /* SCL/SDA rise time */
+    uint32_t riseTimeNs;
+
+    /* SCL/SDA fall time */
+    uint32_t fallTimeNs;
+
+} I2C_BUS_TIMING;
+
+/**
+ *  @summary        I2C Bus Speed Configuration Data Structure
+ *  @breif          This data structure holds the cached baud rate generator settings
+ *                  of a bus speed class.
+ *  @remarks        None
+*/
+typedef struct
+{
+    /* I2CxHBRG value */
+    uint32_t hbrg;
+
+    /* I2CxLBRG value */
+    uint32_t lbrg;
+
+    /* Actual SCL frequency in Hz, including rise and fall times */
+    uint32_t clkSpeed;
+
+    /* Spare rise time before the specification limit is reached */
+    uint32_t riseMarginNs;
+
+    /* Slew rate control is enabled */
+    bool slewRateControl;
+
+    /* Settings were computed and validated */
+    bool valid;
+
+} I2C_BUS_SPEED_CONFIG;
+
 // /cond IGNORE_THIS
 // Section: Local Objects **** Do Not Use ****
 typedef struct
@@ -138,9 +205,29 @@ typedef struct
     I2C_ERROR               error;
     I2C_CALLBACK            callback;
     uintptr_t               context;
+    I2C_BUS_SPEED           busSpeed;
+    I2C_BUS_SPEED           defaultBusSpeed;
 
 } I2C_HOST_OBJ;
 
+typedef struct
+{
+    uint32_t                clkSpeed;
+    uint32_t                tLowMinNs;
+    uint32_t                tHighMinNs;
+    uint32_t                riseTimeMaxNs;
+    uint32_t                fallTimeMaxNs;
+    bool                    slewRateControl;
+
+} I2C_BUS_SPEED_SPEC;
+
+typedef struct
+{
+    uint16_t                address;
+    I2C_BUS_SPEED           busSpeed;
+
+} I2C_CLIENT_BUS_SPEED;
+
 // /endcond
 
 // /cond IGNORE_THIS
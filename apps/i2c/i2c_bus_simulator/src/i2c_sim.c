@@ -0,0 +1,754 @@
+/*******************************************************************************
+  I2C Bus Simulator Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    i2c_sim.c
+
+  Summary:
+    Register model and virtual bus linking an I2C host to an I2C client.
+
+  Description:
+    The bus runs one host operation at a time, in simulated time, and calls
+    the interrupt handlers of both PLIB instances when their models raise an
+    interrupt.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/* clock_gettime */
+#define _POSIX_C_SOURCE 199309L
+
+// Section: Included Files
+
+#include <string.h>
+#include <time.h>
+#include "i2c_sim.h"
+#include "i2c_sim_plib.h"
+
+// Section: Local Objects
+
+/* I2C1 source clock of both instances, as I2C1_FrequencyGet */
+#define I2C_SIM_SRC_CLK_FREQ    (CLOCK_GeneratorFrequencyGet(CLOCK_GENERATOR_1) / 2U)
+
+/* Pulse gobbler delay added by the module to each SCL phase */
+#define I2C_SIM_PGD_DELAY_NS    (200U)
+
+#define I2C_SIM_NS_PER_SECOND   (1000000000ULL)
+
+typedef enum
+{
+    I2C_SIM_PHASE_IDLE,
+    I2C_SIM_PHASE_ADDRESS,
+    I2C_SIM_PHASE_ADDRESS_10BIT,
+    I2C_SIM_PHASE_WRITE,
+    I2C_SIM_PHASE_READ,
+
+} I2C_SIM_PHASE;
+
+typedef enum
+{
+    I2C_SIM_TARGET_NONE,
+    I2C_SIM_TARGET_CLIENT,
+    I2C_SIM_TARGET_DEVICE,
+
+} I2C_SIM_TARGET;
+
+volatile I2C_SIM_REGISTERS i2cSimHostRegs;
+volatile I2C_SIM_REGISTERS i2cSimClientRegs;
+
+static I2C_SIM_CONFIG simConfig;
+static I2C_SIM_STATISTICS simStats;
+
+/* Transaction in progress */
+static I2C_SIM_PHASE simPhase;
+static I2C_SIM_TARGET simTarget;
+static uint32_t simByteIndex;
+static uint8_t simHeader;
+
+/* Memory device */
+static uint16_t deviceAddress;
+static uint8_t* deviceMemory;
+static size_t deviceSize;
+static size_t devicePointer;
+static bool devicePointerNext;
+static bool device10BitSelected;
+
+/* Injections, cleared at the Stop condition */
+static uint32_t injectNackByte;
+static uint32_t injectStretchByte;
+static uint32_t injectStretchNs;
+static bool rivalArmed;
+static bool rivalContending;
+static uint8_t rivalAddressByte;
+static uint32_t rivalDataBytes;
+
+/* SCL periods left in the transaction of the rival after the host lost */
+static uint32_t rivalRemainingBits;
+
+// Section: Local Functions
+
+static uint64_t I2C_SIM_TimeNs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * I2C_SIM_NS_PER_SECOND) + (uint64_t)now.tv_nsec;
+}
+
+/* SCL period set by the host baud rate generator */
+static uint64_t I2C_SIM_BitNs(void)
+{
+    uint64_t counts = (uint64_t)i2cSimHostRegs.LBRG + i2cSimHostRegs.HBRG + 6U;
+
+    return ((counts * I2C_SIM_NS_PER_SECOND) / I2C_SIM_SRC_CLK_FREQ) + (2U * I2C_SIM_PGD_DELAY_NS) +
+           simConfig.riseTimeNs + simConfig.fallTimeNs;
+}
+
+static void I2C_SIM_Clock(uint32_t bits)
+{
+    uint64_t timeNs = bits * I2C_SIM_BitNs();
+
+    simStats.busBusyNs += timeNs;
+    simStats.elapsedNs += timeNs;
+}
+
+static void I2C_SIM_Stretch(uint64_t timeNs)
+{
+    simStats.stretchNs += timeNs;
+    simStats.elapsedNs += timeNs;
+}
+
+static void I2C_SIM_StretchInjected(void)
+{
+    if (simByteIndex == injectStretchByte)
+    {
+        I2C_SIM_Stretch(injectStretchNs);
+    }
+}
+
+static void I2C_SIM_HostInterrupt(bool isError)
+{
+    uint64_t startNs = I2C_SIM_TimeNs();
+
+    if (isError)
+    {
+        HOST_I2C1E_InterruptHandler();
+        simStats.hostErrorInterrupts++;
+    }
+    else
+    {
+        HOST_I2C1_InterruptHandler();
+        simStats.hostInterrupts++;
+    }
+
+    simStats.hostIsrCpuNs += I2C_SIM_TimeNs() - startNs;
+
+    /* The bus waits for the host to request the next operation */
+    simStats.elapsedNs += simConfig.hostIsrNs;
+}
+
+/* Raises the client interrupt. When holdsClock is set, SCL is held low until
+   the interrupt sets SCLREL. */
+static void I2C_SIM_ClientInterrupt(bool holdsClock)
+{
+    volatile I2C_SIM_REGISTERS* client = &i2cSimClientRegs;
+    uint64_t startNs;
+
+    if (holdsClock)
+    {
+        client->CON1.bits.SCLREL = 0U;
+    }
+
+    client->IFS.I2C1IF = 1U;
+
+    if (client->IEC.I2C1IE != 0U)
+    {
+        startNs = I2C_SIM_TimeNs();
+        CLIENT_I2C1_InterruptHandler();
+        simStats.clientIsrCpuNs += I2C_SIM_TimeNs() - startNs;
+        simStats.clientInterrupts++;
+
+        if (holdsClock)
+        {
+            I2C_SIM_Stretch(simConfig.clientIsrNs);
+        }
+    }
+
+    if (holdsClock && (client->CON1.bits.SCLREL == 0U))
+    {
+        /* Released here so that the simulation can go on */
+        simStats.clockHeldErrors++;
+        client->CON1.bits.SCLREL = 1U;
+    }
+}
+
+static bool I2C_SIM_ClientAddressMatch(uint8_t addressByte)
+{
+    uint32_t address = (uint32_t)addressByte >> 1;
+
+    return ((i2cSimClientRegs.CON1.bits.ON != 0U) &&
+            (((address ^ i2cSimClientRegs.ADD) & ~i2cSimClientRegs.MSK & 0x7FU) == 0U));
+}
+
+/* Byte clocked into the client, returns true when the client NAKs it */
+static bool I2C_SIM_ClientReceive(uint8_t data, bool isAddress)
+{
+    volatile I2C_SIM_REGISTERS* client = &i2cSimClientRegs;
+    bool overflow = (client->STAT1.bits.RBF != 0U);
+
+    if (overflow)
+    {
+        /* The byte is lost and NAK'ed by the hardware */
+        client->STAT1.bits.I2COV = 1U;
+    }
+    else
+    {
+        client->RCV = data;
+        client->STAT1.bits.RBF = 1U;
+        client->STAT1.bits.D_A = isAddress ? 0U : 1U;
+
+        if (isAddress)
+        {
+            client->STAT1.bits.R_W = data & 1U;
+            client->STAT1.bits.ACKSTAT = 0U;
+        }
+    }
+
+    I2C_SIM_ClientInterrupt(true);
+
+    return (overflow || (client->CON1.bits.ACKDT != 0U));
+}
+
+/* Byte shifted out of the client for the host */
+static uint8_t I2C_SIM_ClientTransmit(void)
+{
+    volatile I2C_SIM_REGISTERS* client = &i2cSimClientRegs;
+    uint8_t data = 0xFFU;
+
+    if (client->TRN == I2C_SIM_TRN_EMPTY)
+    {
+        /* The hardware would hold SCL low until a byte is written */
+        simStats.clockHeldErrors++;
+    }
+    else
+    {
+        data = (uint8_t)client->TRN;
+        client->TRN = I2C_SIM_TRN_EMPTY;
+    }
+
+    client->STAT1.bits.TBF = 0U;
+
+    return data;
+}
+
+/* ACK or NAK of the host after a byte transmitted by the client */
+static void I2C_SIM_ClientAcknowledge(bool nak)
+{
+    volatile I2C_SIM_REGISTERS* client = &i2cSimClientRegs;
+
+    client->STAT1.bits.ACKSTAT = nak ? 1U : 0U;
+    client->STAT1.bits.D_A = 1U;
+
+    /* After a NAK the client releases the bus and waits for a Stop */
+    I2C_SIM_ClientInterrupt(!nak);
+}
+
+static void I2C_SIM_ClientStart(void)
+{
+    volatile I2C_SIM_REGISTERS* client = &i2cSimClientRegs;
+
+    client->STAT1.bits.S = 1U;
+    client->STAT1.bits.P = 0U;
+    client->STAT1.bits.D_A = 0U;
+
+    if ((client->CON1.bits.ON != 0U) && (client->CON1.bits.SCIE != 0U))
+    {
+        I2C_SIM_ClientInterrupt(false);
+    }
+}
+
+static void I2C_SIM_ClientStop(void)
+{
+    volatile I2C_SIM_REGISTERS* client = &i2cSimClientRegs;
+
+    client->STAT1.bits.S = 0U;
+    client->STAT1.bits.P = 1U;
+
+    if ((client->CON1.bits.ON != 0U) && (client->CON1.bits.PCIE != 0U))
+    {
+        I2C_SIM_ClientInterrupt(false);
+    }
+}
+
+static void I2C_SIM_DeviceReceive(uint8_t data)
+{
+    if (devicePointerNext)
+    {
+        devicePointer = data % deviceSize;
+        devicePointerNext = false;
+    }
+    else
+    {
+        deviceMemory[devicePointer] = data;
+        devicePointer = (devicePointer + 1U) % deviceSize;
+    }
+}
+
+static uint8_t I2C_SIM_DeviceTransmit(void)
+{
+    uint8_t data = deviceMemory[devicePointer];
+
+    devicePointer = (devicePointer + 1U) % deviceSize;
+
+    return data;
+}
+
+static bool I2C_SIM_Device10BitHeaderMatch(uint8_t header)
+{
+    return ((deviceMemory != NULL) && (deviceAddress > 0x7FU) &&
+            ((((uint32_t)header >> 1) & 0x3U) == (((uint32_t)deviceAddress >> 8) & 0x3U)));
+}
+
+/* First byte after a Start, returns true when it is NAK'ed */
+static bool I2C_SIM_AddressReceive(uint8_t data, bool injectedNak)
+{
+    bool nak = true;
+
+    simTarget = I2C_SIM_TARGET_NONE;
+    simPhase = ((data & 1U) != 0U) ? I2C_SIM_PHASE_READ : I2C_SIM_PHASE_WRITE;
+
+    if ((data & 0xF8U) == 0xF0U)
+    {
+        /* 10-bit address header */
+        if ((data & 1U) == 0U)
+        {
+            simHeader = data;
+            simPhase = I2C_SIM_PHASE_ADDRESS_10BIT;
+            device10BitSelected = false;
+            nak = (injectedNak || !I2C_SIM_Device10BitHeaderMatch(data));
+        }
+        else if (!injectedNak && device10BitSelected && I2C_SIM_Device10BitHeaderMatch(data))
+        {
+            /* Read after a Repeated Start, from the device addressed before */
+            simTarget = I2C_SIM_TARGET_DEVICE;
+            nak = false;
+        }
+        else
+        {
+            /* Nobody answers */
+        }
+    }
+    else if (injectedNak)
+    {
+        /* The addressed client is busy */
+    }
+    else if (I2C_SIM_ClientAddressMatch(data))
+    {
+        nak = I2C_SIM_ClientReceive(data, true);
+        simTarget = nak ? I2C_SIM_TARGET_NONE : I2C_SIM_TARGET_CLIENT;
+    }
+    else if ((deviceMemory != NULL) && (deviceAddress <= 0x7FU) && (((uint32_t)data >> 1) == deviceAddress))
+    {
+        simTarget = I2C_SIM_TARGET_DEVICE;
+        devicePointerNext = ((data & 1U) == 0U);
+        nak = false;
+    }
+    else
+    {
+        /* Nobody answers */
+    }
+
+    return nak;
+}
+
+/* Host loses arbitration at the first bit where it sends 1 and the rival 0 */
+static bool I2C_SIM_ArbitrationLost(uint8_t data)
+{
+    volatile I2C_SIM_REGISTERS* host = &i2cSimHostRegs;
+    uint32_t bit = 8U;
+    uint32_t ours = 0U;
+    uint32_t rival = 0U;
+
+    rivalContending = false;
+
+    while (bit > 0U)
+    {
+        bit--;
+        ours = ((uint32_t)data >> bit) & 1U;
+        rival = ((uint32_t)rivalAddressByte >> bit) & 1U;
+
+        if (ours != rival)
+        {
+            break;
+        }
+    }
+
+    if ((ours == rival) || (rival != 0U))
+    {
+        /* The rival lost, or sent the same address, and backs off */
+        return false;
+    }
+
+    I2C_SIM_Clock(8U - bit);
+
+    host->STAT1.bits.BCL = 1U;
+    host->STAT1.bits.TBF = 0U;
+    host->STAT1.bits.TRSTAT = 0U;
+    host->CON1.bits.SEN = 0U;
+    host->CON1.bits.RSEN = 0U;
+    host->CON1.bits.PEN = 0U;
+    host->CON1.bits.RCEN = 0U;
+    host->CON1.bits.ACKEN = 0U;
+    host->IFS.I2C1EIF = 1U;
+
+    simStats.arbitrationLosses++;
+
+    /* Rest of the rival address with its ACK, its data bytes and its Stop */
+    rivalRemainingBits = bit + 1U + (rivalDataBytes * 9U) + 1U;
+    simPhase = I2C_SIM_PHASE_IDLE;
+    simTarget = I2C_SIM_TARGET_NONE;
+
+    return true;
+}
+
+static void I2C_SIM_HostStart(bool isRepeated)
+{
+    volatile I2C_SIM_REGISTERS* host = &i2cSimHostRegs;
+
+    I2C_SIM_Clock(1U);
+
+    if (isRepeated)
+    {
+        host->CON1.bits.RSEN = 0U;
+    }
+    else
+    {
+        host->CON1.bits.SEN = 0U;
+        simByteIndex = 0U;
+        device10BitSelected = false;
+        rivalContending = rivalArmed;
+        rivalArmed = false;
+    }
+
+    host->STAT1.bits.S = 1U;
+    host->STAT1.bits.P = 0U;
+    simPhase = I2C_SIM_PHASE_ADDRESS;
+    simTarget = I2C_SIM_TARGET_NONE;
+
+    I2C_SIM_ClientStart();
+
+    host->IFS.I2C1IF = 1U;
+}
+
+static void I2C_SIM_HostStop(void)
+{
+    volatile I2C_SIM_REGISTERS* host = &i2cSimHostRegs;
+
+    I2C_SIM_Clock(1U);
+
+    host->CON1.bits.PEN = 0U;
+    host->STAT1.bits.S = 0U;
+    host->STAT1.bits.P = 1U;
+    simPhase = I2C_SIM_PHASE_IDLE;
+    simTarget = I2C_SIM_TARGET_NONE;
+
+    injectNackByte = I2C_SIM_BYTE_NONE;
+    injectStretchByte = I2C_SIM_BYTE_NONE;
+
+    I2C_SIM_ClientStop();
+
+    host->IFS.I2C1IF = 1U;
+}
+
+static void I2C_SIM_HostTransmit(uint8_t data)
+{
+    volatile I2C_SIM_REGISTERS* host = &i2cSimHostRegs;
+    bool injectedNak = (simByteIndex == injectNackByte);
+    bool nak = true;
+
+    if (rivalContending && I2C_SIM_ArbitrationLost(data))
+    {
+        return;
+    }
+
+    I2C_SIM_Clock(8U);
+
+    switch (simPhase)
+    {
+        case I2C_SIM_PHASE_ADDRESS:
+            nak = I2C_SIM_AddressReceive(data, injectedNak);
+            break;
+
+        case I2C_SIM_PHASE_ADDRESS_10BIT:
+            simPhase = I2C_SIM_PHASE_WRITE;
+            if (!injectedNak && I2C_SIM_Device10BitHeaderMatch(simHeader) && (data == (uint8_t)deviceAddress))
+            {
+                simTarget = I2C_SIM_TARGET_DEVICE;
+                device10BitSelected = true;
+                devicePointerNext = true;
+                nak = false;
+            }
+            break;
+
+        case I2C_SIM_PHASE_WRITE:
+            if (simTarget == I2C_SIM_TARGET_CLIENT)
+            {
+                nak = I2C_SIM_ClientReceive(data, false);
+            }
+            else if (simTarget == I2C_SIM_TARGET_DEVICE)
+            {
+                I2C_SIM_DeviceReceive(data);
+                nak = false;
+            }
+            else
+            {
+                /* Nobody answers */
+            }
+            nak = (nak || injectedNak);
+            break;
+
+        default:
+            /* Written while receiving, the byte is not acknowledged */
+            break;
+    }
+
+    I2C_SIM_StretchInjected();
+    I2C_SIM_Clock(1U);
+
+    host->STAT1.bits.ACKSTAT = nak ? 1U : 0U;
+    host->STAT1.bits.TBF = 0U;
+    host->STAT1.bits.TRSTAT = 0U;
+    host->IFS.I2C1IF = 1U;
+
+    simStats.bytes++;
+    simStats.nacks += nak ? 1U : 0U;
+    simByteIndex++;
+}
+
+static void I2C_SIM_HostReceive(void)
+{
+    volatile I2C_SIM_REGISTERS* host = &i2cSimHostRegs;
+    uint8_t data = 0xFFU;
+
+    I2C_SIM_Clock(8U);
+
+    if (simPhase == I2C_SIM_PHASE_READ)
+    {
+        if (simTarget == I2C_SIM_TARGET_CLIENT)
+        {
+            data = I2C_SIM_ClientTransmit();
+        }
+        else if (simTarget == I2C_SIM_TARGET_DEVICE)
+        {
+            data = I2C_SIM_DeviceTransmit();
+        }
+        else
+        {
+            /* Nobody drives SDA, the pull-up reads as ones */
+        }
+    }
+
+    I2C_SIM_StretchInjected();
+
+    if (host->STAT1.bits.RBF != 0U)
+    {
+        host->STAT1.bits.I2COV = 1U;
+    }
+    host->RCV = data;
+    host->STAT1.bits.RBF = 1U;
+    host->CON1.bits.RCEN = 0U;
+    host->IFS.I2C1IF = 1U;
+
+    simStats.bytes++;
+    simByteIndex++;
+}
+
+static void I2C_SIM_HostAcknowledge(void)
+{
+    volatile I2C_SIM_REGISTERS* host = &i2cSimHostRegs;
+    bool nak = (host->CON1.bits.ACKDT != 0U);
+
+    I2C_SIM_Clock(1U);
+
+    if (simTarget == I2C_SIM_TARGET_CLIENT)
+    {
+        I2C_SIM_ClientAcknowledge(nak);
+    }
+
+    host->CON1.bits.ACKEN = 0U;
+    host->IFS.I2C1IF = 1U;
+}
+
+static void I2C_SIM_RegistersReset(volatile I2C_SIM_REGISTERS* regs)
+{
+    regs->CON1.reg = 0U;
+    regs->STAT1.reg = 0U;
+    regs->INTC = 0U;
+    regs->HBRG = 0U;
+    regs->LBRG = 0U;
+    regs->ADD = 0U;
+    regs->MSK = 0U;
+    regs->TRN = I2C_SIM_TRN_EMPTY;
+    regs->RCV = 0U;
+    regs->IFS.I2C1IF = 0U;
+    regs->IFS.I2C1EIF = 0U;
+    regs->IEC.I2C1IE = 0U;
+    regs->IEC.I2C1EIE = 0U;
+}
+
+// Section: I2C Bus Simulator Implementation
+
+uint32_t I2C_SIM_ReceiveRead(volatile I2C_SIM_REGISTERS* regs)
+{
+    regs->STAT1.bits.RBF = 0U;
+
+    return regs->RCV;
+}
+
+void I2C_SIM_Initialize(const I2C_SIM_CONFIG* config)
+{
+    simConfig = *config;
+
+    I2C_SIM_RegistersReset(&i2cSimHostRegs);
+    I2C_SIM_RegistersReset(&i2cSimClientRegs);
+
+    simPhase = I2C_SIM_PHASE_IDLE;
+    simTarget = I2C_SIM_TARGET_NONE;
+    simByteIndex = 0U;
+
+    deviceMemory = NULL;
+    device10BitSelected = false;
+
+    injectNackByte = I2C_SIM_BYTE_NONE;
+    injectStretchByte = I2C_SIM_BYTE_NONE;
+    rivalArmed = false;
+    rivalContending = false;
+    rivalRemainingBits = 0U;
+
+    I2C_SIM_StatisticsReset();
+}
+
+bool I2C_SIM_Step(void)
+{
+    volatile I2C_SIM_REGISTERS* host = &i2cSimHostRegs;
+
+    if ((host->IFS.I2C1EIF != 0U) && (host->IEC.I2C1EIE != 0U))
+    {
+        I2C_SIM_HostInterrupt(true);
+    }
+    else if ((host->IFS.I2C1IF != 0U) && (host->IEC.I2C1IE != 0U))
+    {
+        I2C_SIM_HostInterrupt(false);
+    }
+    else if (rivalRemainingBits != 0U)
+    {
+        /* The rival master finishes its transaction */
+        I2C_SIM_Clock(rivalRemainingBits);
+        rivalRemainingBits = 0U;
+        host->STAT1.bits.S = 0U;
+        host->STAT1.bits.P = 1U;
+        injectNackByte = I2C_SIM_BYTE_NONE;
+        injectStretchByte = I2C_SIM_BYTE_NONE;
+        I2C_SIM_ClientStop();
+    }
+    else if (host->CON1.bits.ON == 0U)
+    {
+        return false;
+    }
+    else if (host->CON1.bits.SEN != 0U)
+    {
+        I2C_SIM_HostStart(false);
+    }
+    else if (host->CON1.bits.RSEN != 0U)
+    {
+        I2C_SIM_HostStart(true);
+    }
+    else if (host->CON1.bits.PEN != 0U)
+    {
+        I2C_SIM_HostStop();
+    }
+    else if (host->CON1.bits.RCEN != 0U)
+    {
+        I2C_SIM_HostReceive();
+    }
+    else if (host->CON1.bits.ACKEN != 0U)
+    {
+        I2C_SIM_HostAcknowledge();
+    }
+    else if (host->TRN != I2C_SIM_TRN_EMPTY)
+    {
+        uint8_t data = (uint8_t)host->TRN;
+
+        host->TRN = I2C_SIM_TRN_EMPTY;
+        host->STAT1.bits.TRSTAT = 1U;
+        I2C_SIM_HostTransmit(data);
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+void I2C_SIM_DeviceAttach(uint16_t address, uint8_t* memory, size_t size)
+{
+    deviceAddress = address;
+    deviceMemory = ((address != 0U) && (size != 0U)) ? memory : NULL;
+    deviceSize = (size > 256U) ? 256U : size;
+    devicePointer = 0U;
+    device10BitSelected = false;
+}
+
+void I2C_SIM_NackInject(uint32_t byteIndex)
+{
+    injectNackByte = byteIndex;
+}
+
+void I2C_SIM_StretchInject(uint32_t byteIndex, uint32_t stretchNs)
+{
+    injectStretchByte = byteIndex;
+    injectStretchNs = stretchNs;
+}
+
+void I2C_SIM_ArbitrationInject(uint8_t addressByte, uint32_t dataBytes)
+{
+    rivalAddressByte = addressByte;
+    rivalDataBytes = dataBytes;
+    rivalArmed = true;
+}
+
+void I2C_SIM_StatisticsGet(I2C_SIM_STATISTICS* stats)
+{
+    *stats = simStats;
+}
+
+void I2C_SIM_StatisticsReset(void)
+{
+    (void)memset(&simStats, 0, sizeof(simStats));
+}
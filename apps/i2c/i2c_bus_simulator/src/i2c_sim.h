@@ -0,0 +1,341 @@
+/*******************************************************************************
+  I2C Bus Simulator Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    i2c_sim.h
+
+  Summary:
+    Register model and virtual bus linking an I2C host to an I2C client.
+
+  Description:
+    The I2C1 host and client PLIB sources are built for the build host against
+    a register model of each instance. A virtual bus moves the bytes between
+    both models, dispatches their interrupts and accounts the bus time, with
+    injected NAKs, arbitration loss and clock stretching.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef I2C_SIM_H
+#define I2C_SIM_H
+
+// Section: Included Files
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// Section: Data Types
+
+/* I2C1TRN value while no byte is waiting to be shifted out */
+#define I2C_SIM_TRN_EMPTY       (0xFFFFFFFFUL)
+
+/* No byte selected by an injection */
+#define I2C_SIM_BYTE_NONE       (0xFFFFFFFFUL)
+
+/**
+ @struct   I2C_SIM_CON1
+ @brief    I2CxCON1 register model
+*/
+typedef union
+{
+    struct
+    {
+        uint32_t SEN:1;
+        uint32_t RSEN:1;
+        uint32_t PEN:1;
+        uint32_t RCEN:1;
+        uint32_t ACKEN:1;
+        uint32_t ACKDT:1;
+        uint32_t STREN:1;
+        uint32_t GCEN:1;
+        uint32_t :1;
+        uint32_t DISSLW:1;
+        uint32_t A10M:1;
+        uint32_t :1;
+        uint32_t SCLREL:1;
+        uint32_t :2;
+        uint32_t ON:1;
+        uint32_t SDAHT:1;
+        uint32_t :1;
+        uint32_t SMBEN:2;
+        uint32_t :1;
+        uint32_t SCIE:1;
+        uint32_t PCIE:1;
+        uint32_t :9;
+    } bits;
+
+    uint32_t reg;
+
+} I2C_SIM_CON1;
+
+/**
+ @struct   I2C_SIM_STAT1
+ @brief    I2CxSTAT1 register model
+*/
+typedef union
+{
+    struct
+    {
+        uint32_t TBF:1;
+        uint32_t RBF:1;
+        uint32_t R_W:1;
+        uint32_t S:1;
+        uint32_t P:1;
+        uint32_t D_A:1;
+        uint32_t I2COV:1;
+        uint32_t :3;
+        uint32_t BCL:1;
+        uint32_t :3;
+        uint32_t TRSTAT:1;
+        uint32_t ACKSTAT:1;
+        uint32_t :16;
+    } bits;
+
+    uint32_t reg;
+
+} I2C_SIM_STAT1;
+
+/**
+ @struct   I2C_SIM_REGISTERS
+ @brief    Register model of one I2C1 instance, including its interrupt flag and
+           enable bits. The PLIB sources reach it through the register names
+           defined in sim/device.h.
+*/
+typedef struct
+{
+    I2C_SIM_CON1    CON1;
+
+    I2C_SIM_STAT1   STAT1;
+
+    uint32_t        INTC;
+
+    uint32_t        HBRG;
+
+    uint32_t        LBRG;
+
+    uint32_t        ADD;
+
+    uint32_t        MSK;
+
+    /* I2C_SIM_TRN_EMPTY until software writes a byte */
+    uint32_t        TRN;
+
+    uint32_t        RCV;
+
+    struct
+    {
+        uint32_t I2C1IF:1;
+        uint32_t I2C1EIF:1;
+        uint32_t :30;
+    } IFS;
+
+    struct
+    {
+        uint32_t I2C1IE:1;
+        uint32_t I2C1EIE:1;
+        uint32_t :30;
+    } IEC;
+
+} I2C_SIM_REGISTERS;
+
+/**
+ @struct   I2C_SIM_CONFIG
+ @brief    Electrical and timing parameters of the simulated bus
+*/
+typedef struct
+{
+    /* SCL rise and fall times, added to each SCL period */
+    uint32_t                riseTimeNs;
+
+    uint32_t                fallTimeNs;
+
+    /* CPU time of one host interrupt. The bus waits for the host between operations. */
+    uint32_t                hostIsrNs;
+
+    /* CPU time of one client interrupt. The client holds SCL low while its
+       interrupt runs on an address or data byte. */
+    uint32_t                clientIsrNs;
+
+} I2C_SIM_CONFIG;
+
+/**
+ @struct   I2C_SIM_STATISTICS
+ @brief    Counters of the simulated bus and of the interrupts it dispatched
+*/
+typedef struct
+{
+    /* Simulated time */
+    uint64_t                elapsedNs;
+
+    /* Time SCL was clocked by the host */
+    uint64_t                busBusyNs;
+
+    /* Time SCL was held low by the client or the device */
+    uint64_t                stretchNs;
+
+    /* Address and data bytes clocked on the bus */
+    uint32_t                bytes;
+
+    /* Bytes answered with a NAK */
+    uint32_t                nacks;
+
+    uint32_t                hostInterrupts;
+
+    uint32_t                hostErrorInterrupts;
+
+    uint32_t                clientInterrupts;
+
+    /* Arbitration lost by the host to the injected rival master */
+    uint32_t                arbitrationLosses;
+
+    /* The client left SCL held low, or had no byte loaded when the host read */
+    uint32_t                clockHeldErrors;
+
+    /* Time spent in the interrupt handlers, measured on the build host */
+    uint64_t                hostIsrCpuNs;
+
+    uint64_t                clientIsrCpuNs;
+
+} I2C_SIM_STATISTICS;
+
+// Section: Register Model
+
+extern volatile I2C_SIM_REGISTERS i2cSimHostRegs;
+
+extern volatile I2C_SIM_REGISTERS i2cSimClientRegs;
+
+/**
+ * @brief      Reads I2CxRCV, which clears RBF like the hardware does.
+ * @param[in]  regs - Register model of the instance
+ * @return     Received byte
+ */
+uint32_t I2C_SIM_ReceiveRead(volatile I2C_SIM_REGISTERS* regs);
+
+// Section: Interface Functions
+
+/**
+ * @brief      Resets the bus, the register models, the injections and the
+ *             statistics.
+ * @details    The host and client PLIBs must be initialized after this call,
+ *             as they would be after a device reset.
+ * @param[in]  config - Bus timing
+ * @return     none
+ */
+void I2C_SIM_Initialize(const I2C_SIM_CONFIG* config);
+
+/**
+ * @brief      Runs the next pending bus operation or interrupt.
+ * @details    Pending host interrupts are dispatched first. Otherwise the
+ *             operation requested by the host in I2CxCON1 or I2CxTRN is run on
+ *             the bus, and the client interrupts it causes are dispatched while
+ *             the bus is stretched. The host interrupt is raised at the end of
+ *             every Start, Repeated Start, Stop, byte and ACK sequence.
+ * @return     true  - An operation or an interrupt was run
+ * @return     false - The bus and both instances are idle
+ */
+bool I2C_SIM_Step(void);
+
+/**
+ * @brief      Attaches a memory device to the bus.
+ * @details    The device answers at a 7-bit or, above 0x7F, a 10-bit address.
+ *             The first byte written after the address sets its memory
+ *             pointer, later bytes are written to memory and reads return
+ *             memory from the pointer. It exercises the host without the
+ *             client PLIB, for example with 10-bit addressing.
+ * @param[in]  address - Device address, 0 detaches the device
+ * @param[in]  memory  - Device memory
+ * @param[in]  size    - Size of the memory, up to 256 bytes
+ * @return     none
+ */
+void I2C_SIM_DeviceAttach(uint16_t address, uint8_t* memory, size_t size);
+
+/**
+ * @brief      NAKs one byte of the next transaction.
+ * @details    An address byte NAK'ed this way does not reach the client, as if
+ *             it were busy. A data byte still reaches the client but the host
+ *             reads a NAK. The injection is cleared at the Stop condition.
+ * @param[in]  byteIndex - Byte index from the Start condition, the address is 0
+ * @return     none
+ */
+void I2C_SIM_NackInject(uint32_t byteIndex);
+
+/**
+ * @brief      Holds SCL low after one byte of the next transaction.
+ * @details    The stretch adds to the client interrupt time, it is cleared at
+ *             the Stop condition.
+ * @param[in]  byteIndex - Byte index from the Start condition, the address is 0
+ * @param[in]  stretchNs - Time SCL is held low
+ * @return     none
+ */
+void I2C_SIM_StretchInject(uint32_t byteIndex, uint32_t stretchNs);
+
+/**
+ * @brief      Starts a rival master together with the next host Start condition.
+ * @details    Both masters drive their first address byte and arbitration is
+ *             decided bit by bit: the master sending a 1 where the other sends
+ *             a 0 loses. When the host loses, its bus collision interrupt is
+ *             raised and the bus stays busy until the rival has sent its data
+ *             bytes and its Stop condition. When the rival loses, or sends the
+ *             same address byte, it backs off and the host transfer goes on.
+ *             The rival is assumed not to address the client.
+ * @param[in]  addressByte - First byte sent by the rival, address and R/W bit
+ * @param[in]  dataBytes   - Bytes sent by the rival after its address
+ * @return     none
+ */
+void I2C_SIM_ArbitrationInject(uint8_t addressByte, uint32_t dataBytes);
+
+/**
+ * @brief      Reads the statistics.
+ * @param[out] stats - Statistics since the last reset
+ * @return     none
+ */
+void I2C_SIM_StatisticsGet(I2C_SIM_STATISTICS* stats);
+
+/**
+ * @brief      Clears the statistics.
+ * @return     none
+ */
+void I2C_SIM_StatisticsReset(void);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif // I2C_SIM_H
@@ -0,0 +1,48 @@
+/*******************************************************************************
+  I2C Bus Simulator Host Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    i2c_sim_host.c
+
+  Summary:
+    I2C1 host PLIB instance of the I2C bus simulator.
+
+  Description:
+    Builds the host PLIB of the i2c_eeprom application for the build host.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/* The PLIB source is built unchanged, against the register model of the host */
+
+#define I2C_SIM_REGS            i2cSimHostRegs
+#define I2C_SIM_NAME(name)      HOST_I2C1##name
+
+// Section: Included Files
+
+#include "i2c_sim_names.h"
+#include "../../host/i2c_eeprom/src/config/default/peripheral/i2c/host/plib_i2c1_host.c"
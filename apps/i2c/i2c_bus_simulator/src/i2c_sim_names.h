@@ -0,0 +1,64 @@
+/*******************************************************************************
+  I2C Bus Simulator PLIB Names Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    i2c_sim_names.h
+
+  Summary:
+    Renames the I2C1 PLIB functions per instance.
+
+  Description:
+    Included once before the host and the client PLIB sources or headers.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/* Both PLIBs name their functions I2C1_xxx. Each source or header is included
+   with I2C_SIM_NAME defined to give its functions the HOST_I2C1 or CLIENT_I2C1
+   prefix, so that both instances link into one program. */
+
+#define I2C1_Initialize                I2C_SIM_NAME(_Initialize)
+#define I2C1_Deinitialize              I2C_SIM_NAME(_Deinitialize)
+#define I2C1_CallbackRegister          I2C_SIM_NAME(_CallbackRegister)
+#define I2C1_IsBusy                    I2C_SIM_NAME(_IsBusy)
+#define I2C1_Read                      I2C_SIM_NAME(_Read)
+#define I2C1_Write                     I2C_SIM_NAME(_Write)
+#define I2C1_WriteRead                 I2C_SIM_NAME(_WriteRead)
+#define I2C1_ErrorGet                  I2C_SIM_NAME(_ErrorGet)
+#define I2C1_TransferSetup             I2C_SIM_NAME(_TransferSetup)
+#define I2C1_BusSpeedConfigure         I2C_SIM_NAME(_BusSpeedConfigure)
+#define I2C1_BusSpeedConfigGet         I2C_SIM_NAME(_BusSpeedConfigGet)
+#define I2C1_BusSpeedSet               I2C_SIM_NAME(_BusSpeedSet)
+#define I2C1_ClientBusSpeedSet         I2C_SIM_NAME(_ClientBusSpeedSet)
+#define I2C1_TransferAbort             I2C_SIM_NAME(_TransferAbort)
+#define I2C1_RegMapRegister            I2C_SIM_NAME(_RegMapRegister)
+#define I2C1_ReadByte                  I2C_SIM_NAME(_ReadByte)
+#define I2C1_WriteByte                 I2C_SIM_NAME(_WriteByte)
+#define I2C1_TransferDirGet            I2C_SIM_NAME(_TransferDirGet)
+#define I2C1_LastByteAckStatusGet      I2C_SIM_NAME(_LastByteAckStatusGet)
+#define I2C1_InterruptHandler          I2C_SIM_NAME(_InterruptHandler)
+#define I2C1E_InterruptHandler          I2C_SIM_NAME(E_InterruptHandler)
@@ -0,0 +1,62 @@
+/*******************************************************************************
+  I2C Bus Simulator PLIB Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    i2c_sim_plib.h
+
+  Summary:
+    Interface of the host and client I2C1 PLIB instances.
+
+  Description:
+    Declares the functions of the host PLIB with the HOST_I2C1 prefix and the
+    functions of the client PLIB with the CLIENT_I2C1 prefix.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef I2C_SIM_PLIB_H
+#define I2C_SIM_PLIB_H
+
+// Section: Included Files
+
+#include "i2c_sim_names.h"
+
+#define I2C_SIM_NAME(name)      HOST_I2C1##name
+#include "../../host/i2c_eeprom/src/config/default/peripheral/i2c/host/plib_i2c1_host.h"
+#undef I2C_SIM_NAME
+
+#define I2C_SIM_NAME(name)      CLIENT_I2C1##name
+#include "../../client/i2c_eeprom_emulation/src/config/default/peripheral/i2c/client/plib_i2c1_client.h"
+#undef I2C_SIM_NAME
+
+/* Interrupt handlers, declared by interrupts.h in the firmware */
+void HOST_I2C1_InterruptHandler(void);
+void HOST_I2C1E_InterruptHandler(void);
+void CLIENT_I2C1_InterruptHandler(void);
+void CLIENT_I2C1E_InterruptHandler(void);
+
+#endif // I2C_SIM_PLIB_H
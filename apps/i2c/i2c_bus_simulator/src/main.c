@@ -0,0 +1,451 @@
+/*******************************************************************************
+  I2C Bus Simulator Main Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    main.c
+
+  Summary:
+    Benchmarks the I2C1 host and client PLIBs on the simulated bus.
+
+  Description:
+    Runs EEPROM emulation transfers between the host and the client PLIB at
+    each bus speed, in register map and in per byte callback mode, then with
+    injected NAKs, arbitration loss and clock stretching, and with a 10-bit
+    addressed device. Each scenario prints its interrupt counts per byte and
+    its modeled bus utilisation, and the exit status tells whether all the
+    scenarios passed.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// Section: Included Files
+
+#include <stddef.h>                     // Defines NULL
+#include <stdbool.h>                    // Defines true
+#include <stdlib.h>                     // Defines EXIT_FAILURE
+#include <stdio.h>
+#include <string.h>
+#include "i2c_sim.h"
+#include "i2c_sim_plib.h"
+
+// Section: Main Entry Point
+
+/* Address and geometry of the client, as in the i2c_eeprom_emulation application */
+#define APP_CLIENT_ADDRESS              (0x54U)
+#define APP_CLIENT_SIZE_BYTES           (512U)
+#define APP_CLIENT_PAGE_SIZE_BYTES      (256U)
+
+/* Memory device answering at a 10-bit address */
+#define APP_DEVICE_ADDRESS              (0x2A5U)
+#define APP_DEVICE_SIZE_BYTES           (64U)
+
+#define APP_TRANSFER_SIZE               (16U)
+#define APP_MEMORY_ADDRESS              (0x0120U)
+
+/* Bus operations and interrupts run before a transfer is declared stuck */
+#define APP_STEP_LIMIT                  (100000U)
+
+typedef enum
+{
+    APP_CLIENT_MODE_REGMAP,
+    APP_CLIENT_MODE_CALLBACK,
+
+} APP_CLIENT_MODE;
+
+static const I2C_SIM_CONFIG simConfig =
+{
+    .riseTimeNs     = 100U,
+    .fallTimeNs     = 20U,
+    .hostIsrNs      = 1000U,
+    .clientIsrNs    = 2000U,
+};
+
+static uint8_t clientMemory[APP_CLIENT_SIZE_BYTES];
+static uint8_t deviceMemory[APP_DEVICE_SIZE_BYTES];
+
+static const I2C_CLIENT_REGMAP clientRegMap =
+{
+    .memory         = clientMemory,
+    .size           = APP_CLIENT_SIZE_BYTES,
+    .pageSize       = APP_CLIENT_PAGE_SIZE_BYTES,
+    .addressBytes   = 2,
+    .access         = I2C_CLIENT_REGMAP_ACCESS_READ_WRITE,
+};
+
+/* Register map that denies reads */
+static const I2C_CLIENT_REGMAP clientWriteOnlyRegMap =
+{
+    .memory         = clientMemory,
+    .size           = APP_CLIENT_SIZE_BYTES,
+    .pageSize       = APP_CLIENT_PAGE_SIZE_BYTES,
+    .addressBytes   = 2,
+    .access         = I2C_CLIENT_REGMAP_ACCESS_WRITE,
+};
+
+/* Last transaction reported in register map mode */
+static I2C_CLIENT_REGMAP_TRANSFER clientTransfer;
+
+/* Per byte client state of the callback mode, as in the original EEPROM emulation */
+static uint16_t clientAddrPtr;
+static uint8_t clientAddrIndex;
+
+static volatile bool transferDone;
+static uint32_t failures;
+
+static void APP_HostCallback(uintptr_t context)
+{
+    (void)context;
+
+    transferDone = true;
+}
+
+static void APP_ClientRegMapCallback(const I2C_CLIENT_REGMAP_TRANSFER* transfer, uintptr_t contextHandle)
+{
+    (void)contextHandle;
+
+    clientTransfer = *transfer;
+}
+
+static bool APP_ClientCallback(I2C_CLIENT_TRANSFER_EVENT event, uintptr_t contextHandle)
+{
+    (void)contextHandle;
+
+    switch (event)
+    {
+        case I2C_CLIENT_TRANSFER_EVENT_ADDR_MATCH:
+            /* MSB address is sent first followed by LSB */
+            clientAddrIndex = 2U;
+            break;
+
+        case I2C_CLIENT_TRANSFER_EVENT_RX_READY:
+            if (clientAddrIndex > 0U)
+            {
+                clientAddrIndex--;
+                clientAddrPtr = (uint16_t)((clientAddrPtr & ~(0xFFU << (8U * clientAddrIndex))) |
+                                           ((uint32_t)CLIENT_I2C1_ReadByte() << (8U * clientAddrIndex)));
+            }
+            else
+            {
+                clientMemory[clientAddrPtr++] = CLIENT_I2C1_ReadByte();
+
+                /* If exceeding the page boundary, rollover to the start of the page */
+                if ((clientAddrPtr % APP_CLIENT_PAGE_SIZE_BYTES) == 0U)
+                {
+                    clientAddrPtr -= APP_CLIENT_PAGE_SIZE_BYTES;
+                }
+            }
+            break;
+
+        case I2C_CLIENT_TRANSFER_EVENT_TX_READY:
+            CLIENT_I2C1_WriteByte(clientMemory[clientAddrPtr++]);
+            if (clientAddrPtr >= APP_CLIENT_SIZE_BYTES)
+            {
+                clientAddrPtr = 0U;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    return true;
+}
+
+static void APP_Setup(APP_CLIENT_MODE mode, I2C_BUS_SPEED speed)
+{
+    uint32_t i;
+
+    for (i = 0U; i < APP_CLIENT_SIZE_BYTES; i++)
+    {
+        clientMemory[i] = (uint8_t)i;
+    }
+
+    I2C_SIM_Initialize(&simConfig);
+
+    HOST_I2C1_Initialize();
+    HOST_I2C1_CallbackRegister(APP_HostCallback, 0U);
+    (void)HOST_I2C1_ClientBusSpeedSet(APP_CLIENT_ADDRESS, speed);
+    (void)HOST_I2C1_ClientBusSpeedSet(APP_DEVICE_ADDRESS, speed);
+
+    CLIENT_I2C1_Initialize();
+
+    if (mode == APP_CLIENT_MODE_REGMAP)
+    {
+        (void)CLIENT_I2C1_RegMapRegister(&clientRegMap, NULL, 0U);
+    }
+    else
+    {
+        CLIENT_I2C1_CallbackRegister(APP_ClientCallback, 0U);
+    }
+
+    I2C_SIM_StatisticsReset();
+}
+
+/* Runs the bus until the host reports the end of the transfer */
+static I2C_ERROR APP_TransferWait(bool started)
+{
+    uint32_t steps = 0U;
+
+    if (!started)
+    {
+        return I2C_ERROR_BUS_COLLISION;
+    }
+
+    while (!transferDone && (steps < APP_STEP_LIMIT) && I2C_SIM_Step())
+    {
+        steps++;
+    }
+
+    return transferDone ? HOST_I2C1_ErrorGet() : I2C_ERROR_BUS_COLLISION;
+}
+
+/* Runs the bus until the host may start a transfer */
+static void APP_BusWait(void)
+{
+    uint32_t steps = 0U;
+
+    while (HOST_I2C1_IsBusy() && (steps < APP_STEP_LIMIT) && I2C_SIM_Step())
+    {
+        steps++;
+    }
+}
+
+static I2C_ERROR APP_MemoryWrite(uint16_t address, uint16_t memAddress, const uint8_t* data, size_t size)
+{
+    uint8_t buffer[2U + APP_TRANSFER_SIZE];
+
+    buffer[0] = (uint8_t)(memAddress >> 8);
+    buffer[1] = (uint8_t)memAddress;
+    (void)memcpy(&buffer[2], data, size);
+
+    transferDone = false;
+
+    return APP_TransferWait(HOST_I2C1_Write(address, buffer, 2U + size));
+}
+
+static I2C_ERROR APP_MemoryRead(uint16_t address, uint16_t memAddress, uint8_t* data, size_t size)
+{
+    uint8_t buffer[2];
+
+    buffer[0] = (uint8_t)(memAddress >> 8);
+    buffer[1] = (uint8_t)memAddress;
+
+    transferDone = false;
+
+    return APP_TransferWait(HOST_I2C1_WriteRead(address, buffer, 2U, data, size));
+}
+
+static void APP_Report(const char* name, bool passed)
+{
+    I2C_SIM_STATISTICS stats;
+    double bytes;
+
+    I2C_SIM_StatisticsGet(&stats);
+    bytes = (stats.bytes != 0U) ? (double)stats.bytes : 1.0;
+
+    printf("%-30s %-4s %5u %5u %5.2f %5u %5.2f %8.1f %8.1f %5.1f %7.1f %6.0f %6.0f\n",
+           name, passed ? "ok" : "FAIL", stats.bytes,
+           stats.hostInterrupts + stats.hostErrorInterrupts, (double)(stats.hostInterrupts + stats.hostErrorInterrupts) / bytes,
+           stats.clientInterrupts, (double)stats.clientInterrupts / bytes,
+           (double)stats.busBusyNs / 1000.0, (double)stats.elapsedNs / 1000.0,
+           (stats.elapsedNs != 0U) ? ((double)stats.busBusyNs * 100.0) / (double)stats.elapsedNs : 0.0,
+           (double)stats.stretchNs / 1000.0,
+           (stats.hostInterrupts != 0U) ? (double)stats.hostIsrCpuNs / (double)stats.hostInterrupts : 0.0,
+           (stats.clientInterrupts != 0U) ? (double)stats.clientIsrCpuNs / (double)stats.clientInterrupts : 0.0);
+
+    if ((!passed) || (stats.clockHeldErrors != 0U))
+    {
+        failures++;
+    }
+}
+
+static void APP_Pattern(uint8_t* data, size_t size, uint8_t seed)
+{
+    size_t i;
+
+    for (i = 0U; i < size; i++)
+    {
+        data[i] = (uint8_t)(seed + (i * 7U));
+    }
+}
+
+static void APP_ThroughputRun(APP_CLIENT_MODE mode, I2C_BUS_SPEED speed, const char* name)
+{
+    static const char* const speedNames[I2C_BUS_SPEED_MAX] = { "100k", "400k", "1M" };
+    uint8_t txData[APP_TRANSFER_SIZE];
+    uint8_t rxData[APP_TRANSFER_SIZE];
+    char label[64];
+    bool passed;
+
+    APP_Pattern(txData, sizeof(txData), (uint8_t)(0x30U + (uint32_t)speed));
+
+    APP_Setup(mode, speed);
+    passed = (APP_MemoryWrite(APP_CLIENT_ADDRESS, APP_MEMORY_ADDRESS, txData, sizeof(txData)) == I2C_ERROR_NONE) &&
+             (memcmp(&clientMemory[APP_MEMORY_ADDRESS], txData, sizeof(txData)) == 0);
+    (void)snprintf(label, sizeof(label), "%s write %u B %s", name, APP_TRANSFER_SIZE, speedNames[speed]);
+    APP_Report(label, passed);
+
+    I2C_SIM_StatisticsReset();
+    passed = (APP_MemoryRead(APP_CLIENT_ADDRESS, APP_MEMORY_ADDRESS, rxData, sizeof(rxData)) == I2C_ERROR_NONE) &&
+             (memcmp(rxData, txData, sizeof(rxData)) == 0);
+    (void)snprintf(label, sizeof(label), "%s read %u B %s", name, APP_TRANSFER_SIZE, speedNames[speed]);
+    APP_Report(label, passed);
+}
+
+static void APP_FaultRun(void)
+{
+    uint8_t txData[APP_TRANSFER_SIZE];
+    uint8_t rxData[APP_TRANSFER_SIZE];
+    I2C_SIM_STATISTICS stats;
+    size_t i;
+    bool passed;
+
+    APP_Pattern(txData, sizeof(txData), 0xA0U);
+
+    /* Client busy on the first attempt, as an EEPROM in its write cycle */
+    APP_Setup(APP_CLIENT_MODE_REGMAP, I2C_BUS_SPEED_FAST);
+    I2C_SIM_NackInject(0U);
+    passed = (APP_MemoryWrite(APP_CLIENT_ADDRESS, APP_MEMORY_ADDRESS, txData, sizeof(txData)) == I2C_ERROR_NACK) &&
+             (clientMemory[APP_MEMORY_ADDRESS] == (uint8_t)APP_MEMORY_ADDRESS);
+    APP_BusWait();
+    passed = passed && (APP_MemoryWrite(APP_CLIENT_ADDRESS, APP_MEMORY_ADDRESS, txData, sizeof(txData)) == I2C_ERROR_NONE) &&
+             (memcmp(&clientMemory[APP_MEMORY_ADDRESS], txData, sizeof(txData)) == 0);
+    APP_Report("address NAK, retry", passed);
+
+    /* Second data byte NAK'ed, the host stops after it */
+    APP_Setup(APP_CLIENT_MODE_REGMAP, I2C_BUS_SPEED_FAST);
+    I2C_SIM_NackInject(4U);
+    passed = (APP_MemoryWrite(APP_CLIENT_ADDRESS, APP_MEMORY_ADDRESS, txData, sizeof(txData)) == I2C_ERROR_NACK) &&
+             (memcmp(&clientMemory[APP_MEMORY_ADDRESS], txData, 2U) == 0) &&
+             (clientMemory[APP_MEMORY_ADDRESS + 2U] == (uint8_t)(APP_MEMORY_ADDRESS + 2U));
+    APP_Report("data NAK", passed);
+
+    /* Rival master with a lower address wins, the host retries once the bus is free */
+    APP_Setup(APP_CLIENT_MODE_REGMAP, I2C_BUS_SPEED_FAST);
+    I2C_SIM_ArbitrationInject(0x20U, 4U);
+    passed = (APP_MemoryWrite(APP_CLIENT_ADDRESS, APP_MEMORY_ADDRESS, txData, sizeof(txData)) == I2C_ERROR_BUS_COLLISION);
+    APP_BusWait();
+    passed = passed && (APP_MemoryWrite(APP_CLIENT_ADDRESS, APP_MEMORY_ADDRESS, txData, sizeof(txData)) == I2C_ERROR_NONE) &&
+             (memcmp(&clientMemory[APP_MEMORY_ADDRESS], txData, sizeof(txData)) == 0);
+    I2C_SIM_StatisticsGet(&stats);
+    APP_Report("arbitration lost, retry", passed && (stats.arbitrationLosses == 1U));
+
+    /* Rival master with a higher address backs off */
+    APP_Setup(APP_CLIENT_MODE_REGMAP, I2C_BUS_SPEED_FAST);
+    I2C_SIM_ArbitrationInject(0xB0U, 4U);
+    passed = (APP_MemoryWrite(APP_CLIENT_ADDRESS, APP_MEMORY_ADDRESS, txData, sizeof(txData)) == I2C_ERROR_NONE) &&
+             (memcmp(&clientMemory[APP_MEMORY_ADDRESS], txData, sizeof(txData)) == 0);
+    I2C_SIM_StatisticsGet(&stats);
+    APP_Report("arbitration won", passed && (stats.arbitrationLosses == 0U));
+
+    /* Client holds SCL low for 100 us after the first data byte */
+    APP_Setup(APP_CLIENT_MODE_REGMAP, I2C_BUS_SPEED_FAST);
+    I2C_SIM_StretchInject(3U, 100000U);
+    passed = (APP_MemoryRead(APP_CLIENT_ADDRESS, APP_MEMORY_ADDRESS, rxData, sizeof(rxData)) == I2C_ERROR_NONE) &&
+             (memcmp(rxData, &clientMemory[APP_MEMORY_ADDRESS], sizeof(rxData)) == 0);
+    I2C_SIM_StatisticsGet(&stats);
+    APP_Report("clock stretch 100 us", passed && (stats.stretchNs >= 100000U));
+
+    /* Reads denied, the client sends fill bytes instead of stalling the bus */
+    APP_Setup(APP_CLIENT_MODE_REGMAP, I2C_BUS_SPEED_FAST);
+    (void)CLIENT_I2C1_RegMapRegister(&clientWriteOnlyRegMap, APP_ClientRegMapCallback, 0U);
+    (void)memset(rxData, 0, sizeof(rxData));
+    (void)memset(&clientTransfer, 0, sizeof(clientTransfer));
+    passed = (APP_MemoryRead(APP_CLIENT_ADDRESS, APP_MEMORY_ADDRESS, rxData, sizeof(rxData)) == I2C_ERROR_NONE);
+    APP_BusWait();
+    for (i = 0U; i < sizeof(rxData); i++)
+    {
+        passed = passed && (rxData[i] == I2C_CLIENT_REGMAP_FILL_BYTE);
+    }
+    passed = passed && (clientTransfer.readCount == 0U) && (clientTransfer.accessErrorCount == sizeof(rxData))
+             && (clientTransfer.startAddress == APP_MEMORY_ADDRESS);
+    APP_Report("read denied, fill bytes", passed);
+
+    /* No client at the address */
+    APP_Setup(APP_CLIENT_MODE_REGMAP, I2C_BUS_SPEED_FAST);
+    passed = (APP_MemoryWrite(0x50U, APP_MEMORY_ADDRESS, txData, sizeof(txData)) == I2C_ERROR_NACK);
+    APP_Report("absent client", passed);
+}
+
+static void APP_10BitRun(void)
+{
+    uint8_t buffer[1U + APP_TRANSFER_SIZE];
+    uint8_t rxData[APP_TRANSFER_SIZE];
+    bool passed;
+
+    APP_Setup(APP_CLIENT_MODE_REGMAP, I2C_BUS_SPEED_FAST);
+    (void)memset(deviceMemory, 0, sizeof(deviceMemory));
+    I2C_SIM_DeviceAttach(APP_DEVICE_ADDRESS, deviceMemory, sizeof(deviceMemory));
+
+    buffer[0] = 0x10U;
+    APP_Pattern(&buffer[1], APP_TRANSFER_SIZE, 0x55U);
+    transferDone = false;
+    passed = (APP_TransferWait(HOST_I2C1_Write(APP_DEVICE_ADDRESS, buffer, sizeof(buffer))) == I2C_ERROR_NONE) &&
+             (memcmp(&deviceMemory[0x10], &buffer[1], APP_TRANSFER_SIZE) == 0);
+    APP_Report("10-bit write 16 B 400k", passed);
+
+    I2C_SIM_StatisticsReset();
+    transferDone = false;
+    passed = (APP_TransferWait(HOST_I2C1_WriteRead(APP_DEVICE_ADDRESS, buffer, 1U, rxData, sizeof(rxData))) == I2C_ERROR_NONE) &&
+             (memcmp(rxData, &buffer[1], sizeof(rxData)) == 0);
+    APP_Report("10-bit write-read 16 B 400k", passed);
+
+    /* Reads on from the current device pointer */
+    I2C_SIM_StatisticsReset();
+    transferDone = false;
+    passed = (APP_TransferWait(HOST_I2C1_Read(APP_DEVICE_ADDRESS, rxData, 4U)) == I2C_ERROR_NONE) &&
+             (memcmp(rxData, &deviceMemory[0x20], 4U) == 0);
+    APP_Report("10-bit read 4 B 400k", passed);
+}
+
+int main ( void )
+{
+    I2C_BUS_SPEED speed;
+
+    printf("Host ISR %u ns, client ISR %u ns, SCL rise %u ns, fall %u ns\n\n",
+           simConfig.hostIsrNs, simConfig.clientIsrNs, simConfig.riseTimeNs, simConfig.fallTimeNs);
+    printf("%-30s %-4s %5s %5s %5s %5s %5s %8s %8s %5s %7s %6s %6s\n",
+           "scenario", "", "bytes", "hISR", "/byte", "cISR", "/byte",
+           "bus us", "total us", "use %", "hold us", "hCPUns", "cCPUns");
+
+    for (speed = I2C_BUS_SPEED_STANDARD; speed < I2C_BUS_SPEED_MAX; speed++)
+    {
+        APP_ThroughputRun(APP_CLIENT_MODE_REGMAP, speed, "regmap");
+    }
+
+    for (speed = I2C_BUS_SPEED_STANDARD; speed < I2C_BUS_SPEED_MAX; speed++)
+    {
+        APP_ThroughputRun(APP_CLIENT_MODE_CALLBACK, speed, "callback");
+    }
+
+    APP_FaultRun();
+    APP_10BitRun();
+
+    printf("\n%u scenario(s) failed\n", failures);
+
+    return (failures == 0U) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
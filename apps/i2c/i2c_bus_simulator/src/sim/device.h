@@ -0,0 +1,155 @@
+/*******************************************************************************
+  Simulated Device Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    device.h
+
+  Summary:
+    I2C1 register names of the simulated device.
+
+  Description:
+    Stands in for the device header when the I2C1 PLIB sources are built for
+    the I2C bus simulator.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef DEVICE_H
+#define DEVICE_H
+
+/* Register names used by the I2C1 PLIB sources, mapped to the register model
+   of the instance selected by I2C_SIM_REGS before this file is included. The
+   bit positions are those of the model, sources must only use the names. */
+
+// Section: Included Files
+
+#include "../i2c_sim.h"
+
+#ifndef I2C_SIM_REGS
+#error "I2C_SIM_REGS must select the register model of the instance"
+#endif
+
+// Section: Registers
+
+#define I2C1CON1                (I2C_SIM_REGS.CON1.reg)
+#define I2C1CON1bits            (I2C_SIM_REGS.CON1.bits)
+#define I2C1STAT1               (I2C_SIM_REGS.STAT1.reg)
+#define I2C1STAT1bits           (I2C_SIM_REGS.STAT1.bits)
+#define I2C1INTC                (I2C_SIM_REGS.INTC)
+#define I2C1HBRG                (I2C_SIM_REGS.HBRG)
+#define I2C1LBRG                (I2C_SIM_REGS.LBRG)
+#define I2C1ADD                 (I2C_SIM_REGS.ADD)
+#define I2C1MSK                 (I2C_SIM_REGS.MSK)
+#define I2C1TRN                 (I2C_SIM_REGS.TRN)
+#define I2C1RCV                 (I2C_SIM_ReceiveRead(&I2C_SIM_REGS))
+
+#define IFS2bits                (I2C_SIM_REGS.IFS)
+#define _I2C1IF                 (I2C_SIM_REGS.IFS.I2C1IF)
+#define _I2C1EIF                (I2C_SIM_REGS.IFS.I2C1EIF)
+#define _I2C1IE                 (I2C_SIM_REGS.IEC.I2C1IE)
+#define _I2C1EIE                (I2C_SIM_REGS.IEC.I2C1EIE)
+
+// Section: Register Fields
+
+#define _I2C1CON1_SEN_POSITION       (0x0U)
+#define _I2C1CON1_SEN_MASK           (0x1UL)
+#define _I2C1CON1_RSEN_POSITION      (0x1U)
+#define _I2C1CON1_RSEN_MASK          (0x2UL)
+#define _I2C1CON1_PEN_POSITION       (0x2U)
+#define _I2C1CON1_PEN_MASK           (0x4UL)
+#define _I2C1CON1_RCEN_POSITION      (0x3U)
+#define _I2C1CON1_RCEN_MASK          (0x8UL)
+#define _I2C1CON1_ACKEN_POSITION     (0x4U)
+#define _I2C1CON1_ACKEN_MASK         (0x10UL)
+#define _I2C1CON1_ACKDT_POSITION     (0x5U)
+#define _I2C1CON1_ACKDT_MASK         (0x20UL)
+#define _I2C1CON1_STREN_POSITION     (0x6U)
+#define _I2C1CON1_STREN_MASK         (0x40UL)
+#define _I2C1CON1_GCEN_POSITION      (0x7U)
+#define _I2C1CON1_GCEN_MASK          (0x80UL)
+#define _I2C1CON1_DISSLW_POSITION    (0x9U)
+#define _I2C1CON1_DISSLW_MASK        (0x200UL)
+#define _I2C1CON1_A10M_POSITION      (0xAU)
+#define _I2C1CON1_A10M_MASK          (0x400UL)
+#define _I2C1CON1_SCLREL_POSITION    (0xCU)
+#define _I2C1CON1_SCLREL_MASK        (0x1000UL)
+#define _I2C1CON1_ON_POSITION        (0xFU)
+#define _I2C1CON1_ON_MASK            (0x8000UL)
+#define _I2C1CON1_SDAHT_POSITION     (0x10U)
+#define _I2C1CON1_SDAHT_MASK         (0x10000UL)
+#define _I2C1CON1_SMBEN_POSITION     (0x12U)
+#define _I2C1CON1_SMBEN_MASK         (0xC0000UL)
+#define _I2C1CON1_SCIE_POSITION      (0x15U)
+#define _I2C1CON1_SCIE_MASK          (0x200000UL)
+#define _I2C1CON1_PCIE_POSITION      (0x16U)
+#define _I2C1CON1_PCIE_MASK          (0x400000UL)
+
+#define _I2C1STAT1_TBF_POSITION      (0x0U)
+#define _I2C1STAT1_TBF_MASK          (0x1UL)
+#define _I2C1STAT1_RBF_POSITION      (0x1U)
+#define _I2C1STAT1_RBF_MASK          (0x2UL)
+#define _I2C1STAT1_R_W_POSITION      (0x2U)
+#define _I2C1STAT1_R_W_MASK          (0x4UL)
+#define _I2C1STAT1_S_POSITION        (0x3U)
+#define _I2C1STAT1_S_MASK            (0x8UL)
+#define _I2C1STAT1_P_POSITION        (0x4U)
+#define _I2C1STAT1_P_MASK            (0x10UL)
+#define _I2C1STAT1_D_A_POSITION      (0x5U)
+#define _I2C1STAT1_D_A_MASK          (0x20UL)
+#define _I2C1STAT1_I2COV_POSITION    (0x6U)
+#define _I2C1STAT1_I2COV_MASK        (0x40UL)
+#define _I2C1STAT1_BCL_POSITION      (0xAU)
+#define _I2C1STAT1_BCL_MASK          (0x400UL)
+#define _I2C1STAT1_TRSTAT_POSITION   (0xEU)
+#define _I2C1STAT1_TRSTAT_MASK       (0x4000UL)
+#define _I2C1STAT1_ACKSTAT_POSITION  (0xFU)
+#define _I2C1STAT1_ACKSTAT_MASK      (0x8000UL)
+
+#define _I2C1INTC_CADDRIE_POSITION   (0x0U)
+#define _I2C1INTC_CADDRIE_MASK       (0x1UL)
+#define _I2C1INTC_CDRXIE_POSITION    (0x1U)
+#define _I2C1INTC_CDRXIE_MASK        (0x2UL)
+#define _I2C1INTC_CDTXIE_POSITION    (0x2U)
+#define _I2C1INTC_CDTXIE_MASK        (0x4UL)
+#define _I2C1INTC_CLTIE_POSITION     (0x3U)
+#define _I2C1INTC_CLTIE_MASK         (0x8UL)
+#define _I2C1INTC_HSTIE_POSITION     (0x8U)
+#define _I2C1INTC_HSTIE_MASK         (0x100UL)
+#define _I2C1INTC_HDRXIE_POSITION    (0x9U)
+#define _I2C1INTC_HDRXIE_MASK        (0x200UL)
+#define _I2C1INTC_HDTXIE_POSITION    (0xAU)
+#define _I2C1INTC_HDTXIE_MASK        (0x400UL)
+#define _I2C1INTC_HACKSIE_POSITION   (0xBU)
+#define _I2C1INTC_HACKSIE_MASK       (0x800UL)
+#define _I2C1INTC_HSCIE_POSITION     (0xCU)
+#define _I2C1INTC_HSCIE_MASK         (0x1000UL)
+#define _I2C1INTC_HPCIE_POSITION     (0xDU)
+#define _I2C1INTC_HPCIE_MASK         (0x2000UL)
+#define _I2C1INTC_BCLIE_POSITION     (0x10U)
+#define _I2C1INTC_BCLIE_MASK         (0x10000UL)
+
+#endif // DEVICE_H
@@ -0,0 +1,66 @@
+/*******************************************************************************
+  Simulated Clock Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    plib_clk.h
+
+  Summary:
+    Clock generator frequencies of the simulated device.
+
+  Description:
+    Stands in for the CLK PLIB when the I2C1 PLIB sources are built for the I2C
+    bus simulator.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef PLIB_CLK_H
+#define PLIB_CLK_H
+
+// Section: Included Files
+
+#include <stdint.h>
+
+// Section: Data Types
+
+typedef enum
+{
+    CLOCK_GENERATOR_1 = 1,
+    CLOCK_GENERATOR_2 = 2,
+    CLOCK_GENERATOR_3 = 3,
+
+} CLOCK_GENERATOR;
+
+// Section: Interface Functions
+
+/* Same generator frequencies as the pic32ak_gc_curiosity configurations */
+inline static uint32_t CLOCK_GeneratorFrequencyGet(CLOCK_GENERATOR generator)
+{
+    return (generator == CLOCK_GENERATOR_1) ? 200000000UL : 8000000UL;
+}
+
+#endif // PLIB_CLK_H
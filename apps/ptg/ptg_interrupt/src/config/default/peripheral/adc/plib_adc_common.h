@@ -65,6 +65,30 @@ typedef enum
     ADC_PWM_TRIGGER_2 = 2,     /**< PWM TRIGGER 2 */
 } ADC_PWM_TRIGGERS;
 
+/**
+ @enum     ADC_CHANNEL_MODE
+ @brief    Defines the conversion modes of a channel.
+*/
+typedef enum
+{
+    ADC_CHANNEL_MODE_SINGLE_SAMPLE = 0,     /**< One conversion per trigger */
+    ADC_CHANNEL_MODE_WINDOW = 1,            /**< Conversions are accumulated while the trigger window is open */
+    ADC_CHANNEL_MODE_INTEGRATION = 2,       /**< A fixed number of triggers is accumulated */
+    ADC_CHANNEL_MODE_OVERSAMPLING = 3,      /**< A fixed number of conversions is accumulated per trigger */
+} ADC_CHANNEL_MODE;
+
+/**
+ @enum     ADC_ACCUMULATION_COUNT
+ @brief    Defines the number of conversions accumulated in oversampling mode.
+*/
+typedef enum
+{
+    ADC_ACCUMULATION_4_SAMPLES = 0,
+    ADC_ACCUMULATION_16_SAMPLES = 1,
+    ADC_ACCUMULATION_64_SAMPLES = 2,
+    ADC_ACCUMULATION_256_SAMPLES = 3,
+} ADC_ACCUMULATION_COUNT;
+
 /** 
   @brief    Callback function prototype for ADC Channel conversion complete interrupt
 */
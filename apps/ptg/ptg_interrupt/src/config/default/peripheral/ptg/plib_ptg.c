@@ -102,6 +102,42 @@ volatile static PTG_EVENTS_CALLBACK_OBJECT triggerWdtObj;
 #define PTGCON_PTGDIV_DIVIDE_BY_31    ((uint32_t)(_PTGCON_PTGDIV_MASK & ((uint32_t)(30) <<_PTGCON_PTGDIV_POSITION)))
 #define PTGCON_PTGDIV_DIVIDE_BY_32    ((uint32_t)(_PTGCON_PTGDIV_MASK & ((uint32_t)(31) <<_PTGCON_PTGDIV_POSITION)))
 
+/** 
+  Step Commands, the unused steps are NOPs
+*/
+static const uint8_t ptgDefaultSequence[] =
+{
+    PTGWLO | 0xfU,      //Trigger Input from INT2 PPS
+    PTGCTRL | 0x8U,     //Wait for PTG Timer0 to match PTGT0LIM
+    PTGIRQ | 0x0U,      //Generate PTG Interrupt 0
+    PTGTRIG | 0xcU,     //Trigger for ADC Sample Trigger
+    PTGIRQ | 0x1U,      //Generate PTG Interrupt 1
+};
+
+// Section: Local Functions
+
+/* STEPn is byte n % 4 of PTGQUE(n / 4), each queue register is written once */
+static void PTG_StepQueueWrite(const uint8_t* steps, uint32_t count)
+{
+    volatile uint32_t *PTGQUEx;
+    uint32_t value;
+    uint32_t step;
+    uint32_t index;
+
+    for (step = 0U; step < PTG_STEP_COUNT; step += 4U)
+    {
+        value = 0U;
+        for (index = 0U; index < 4U; index++)
+        {
+            value |= (uint32_t)(((step + index) < count) ? steps[step + index] : PTG_STEP_NOP) << (8U * index);
+        }
+
+        /* The queue registers are consecutive words, 4 steps each */
+        PTGQUEx = (volatile uint32_t *)((uint32_t)&PTGQUE0 + step);
+        *PTGQUEx = value;
+    }
+}
+
 // Section: PTG PLIB Routines
 void PTG_Initialize (void)
 {
@@ -120,42 +156,7 @@ void PTG_Initialize (void)
 	PTGQPTR  = 0x0UL;
 	
 
-  /** 
-   Step Commands 
-  */
-
- 	PTG_STEP0 = PTGWLO | 0xfU; //Trigger Input from INT2 PPS
- 	PTG_STEP1 = PTGCTRL | 0x8U; //Wait for PTG Timer0 to match PTGT0LIM
- 	PTG_STEP2 = PTGIRQ | 0x0U; //Generate PTG Interrupt 0
- 	PTG_STEP3 = PTGTRIG | 0xcU; //Trigger for ADC Sample Trigger
- 	PTG_STEP4 = PTGIRQ | 0x1U; //Generate PTG Interrupt 1
- 	PTG_STEP5 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP6 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP7 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP8 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP9 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP10 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP11 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP12 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP13 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP14 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP15 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP16 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP17 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP18 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP19 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP20 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP21 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP22 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP23 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP24 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP25 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP26 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP27 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP28 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP29 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP30 = PTGCTRL | 0x0U; //NOP
- 	PTG_STEP31 = PTGCTRL | 0x0U; //NOP
+    PTG_StepQueueWrite(ptgDefaultSequence, sizeof(ptgDefaultSequence));
 
 	//Clear  interrupt flag  
     IFS4bits.PTG0IF = 0;
@@ -220,6 +221,52 @@ void PTG_StepSequenceStop (void)
     PTGCONbits.PTGSTRT = 0;
 }   
 
+bool PTG_StepSequenceLoad (const uint8_t* steps, uint32_t count)
+{
+    /* The queue cannot change under a running sequence */
+    if ((count > PTG_STEP_COUNT) || (PTGCONbits.PTGSTRT != 0U))
+    {
+        return false;
+    }
+
+    PTG_StepQueueWrite(steps, count);
+    PTGQPTR = 0x0UL;
+
+    return true;
+}
+
+void PTG_LimitsSet (const PTG_LIMITS* limits, uint32_t mask)
+{
+    if ((mask & PTG_LIMIT_TIMER0) != 0U)
+    {
+        PTGT0LIM = limits->timer0;
+    }
+    if ((mask & PTG_LIMIT_TIMER1) != 0U)
+    {
+        PTGT1LIM = limits->timer1;
+    }
+    if ((mask & PTG_LIMIT_STEP_DELAY) != 0U)
+    {
+        PTGSDLIM = limits->stepDelay;
+    }
+    if ((mask & PTG_LIMIT_COUNTER0) != 0U)
+    {
+        PTGC0LIM = limits->counter0;
+    }
+    if ((mask & PTG_LIMIT_COUNTER1) != 0U)
+    {
+        PTGC1LIM = limits->counter1;
+    }
+    if ((mask & PTG_LIMIT_HOLD) != 0U)
+    {
+        PTGHOLD = limits->hold;
+    }
+    if ((mask & PTG_LIMIT_ADJUST) != 0U)
+    {
+        PTGADJ = limits->adjust;
+    }
+}
+
 void PTG_Disable (void)
 {
     PTGCONbits.ON = 0;
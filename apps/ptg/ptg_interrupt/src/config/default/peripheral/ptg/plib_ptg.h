@@ -78,6 +78,32 @@ typedef struct
     uintptr_t context;
 }PTG_EVENTS_CALLBACK_OBJECT;
 
+/**
+* @brief    Defines the PTG timer, counter and adjustment limits used by a step sequence.
+*/
+typedef struct
+{
+    uint32_t timer0;        /**<PTGT0LIM, PTG Timer0 limit */
+    uint32_t timer1;        /**<PTGT1LIM, PTG Timer1 limit */
+    uint32_t stepDelay;     /**<PTGSDLIM, step delay limit */
+    uint32_t counter0;      /**<PTGC0LIM, PTG Counter0 limit */
+    uint32_t counter1;      /**<PTGC1LIM, PTG Counter1 limit */
+    uint32_t hold;          /**<PTGHOLD, value copied by the PTGCOPY command */
+    uint32_t adjust;        /**<PTGADJ, value added by the PTGADD command */
+}PTG_LIMITS;
+
+/**
+* @brief    Selects the PTG_LIMITS members written by PTG_LimitsSet, one bit per register.
+*/
+#define PTG_LIMIT_TIMER0        (0x01U)
+#define PTG_LIMIT_TIMER1        (0x02U)
+#define PTG_LIMIT_STEP_DELAY    (0x04U)
+#define PTG_LIMIT_COUNTER0      (0x08U)
+#define PTG_LIMIT_COUNTER1      (0x10U)
+#define PTG_LIMIT_HOLD          (0x20U)
+#define PTG_LIMIT_ADJUST        (0x40U)
+#define PTG_LIMIT_ALL           (0x7FU)
+
 // Section: Macro Definitions
 
 /**
@@ -147,6 +173,12 @@ typedef struct
 #define PTGJMPC0  (0xcu << 4u )    //PTGJMPC0 command        
 #define PTGJMPC1  (0xeu << 4u )    //PTGJMPC1 command
 
+/**
+ @brief    Step queue size and the step that pads the unused steps
+*/
+#define PTG_STEP_COUNT  (32U)
+#define PTG_STEP_NOP    (PTGCTRL | 0x0U)
+
 // Section: PTG Module APIs
 
 /**
@@ -358,6 +390,54 @@ bool PTG_WatchdogTimeoutStatusGet(void);
  */
 void PTG_StepSequenceStop(void);
 
+/**
+ * @brief Loads a new step sequence in the PTG step queue.
+ *
+ * @details The steps are written to the step queue, the steps past count are
+ * NOPs, and the queue pointer is reset to step 0. This allows the trigger
+ * sequence to be changed between runs without regenerating the code.
+ *
+ * @pre The step sequence must be stopped with the PTG_StepSequenceStop API.
+ *
+ * @param[in] steps  Step commands, each a command macro ORed with its option
+ * @param[in] count  Number of steps, up to PTG_STEP_COUNT
+ *
+ * @return   true   - Sequence loaded
+ * @return   false  - Too many steps, or the step sequence is running
+ *
+ * @b Example:
+ * @code
+ *    static const uint8_t steps[] = { PTGWLO | 0xfU, PTGTRIG | 0xcU, PTGJMP | 0x0U };
+ *    PTG_StepSequenceStop();
+ *    PTG_StepSequenceLoad(steps, sizeof(steps));
+ *    PTG_StepSequenceStart();
+ * @endcode
+ * @remarks The steps are written as they are, without validation.
+ */
+bool PTG_StepSequenceLoad(const uint8_t* steps, uint32_t count);
+
+/**
+ * @brief Sets the timer, counter and adjustment limits of the step sequence.
+ *
+ * @pre The step sequence should be stopped with the PTG_StepSequenceStop API.
+ *
+ * @param[in] limits  Limits \ref PTG_LIMITS
+ * @param[in] mask    PTG_LIMIT_ bits of the registers to write, the other
+ *                    registers keep their value
+ *
+ * @return None
+ *
+ * @b Example:
+ * @code
+ *    PTG_LIMITS limits = { .timer0 = 0xfa00U, .counter0 = 3U, .hold = 1U, .adjust = 1U };
+ *    PTG_StepSequenceStop();
+ *    PTG_LimitsSet(&limits, PTG_LIMIT_TIMER0 | PTG_LIMIT_COUNTER0);
+ *    PTG_StepSequenceStart();
+ * @endcode
+ * @remarks None
+ */
+void PTG_LimitsSet(const PTG_LIMITS* limits, uint32_t mask);
+
 /**
  * @brief Disables the PTG peripheral of the device.
  *
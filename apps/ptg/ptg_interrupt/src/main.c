@@ -48,6 +48,33 @@
 #include <stdbool.h>                    // Defines true
 #include <stdlib.h>                     // Defines EXIT_FAILURE
 #include "definitions.h"                // SYS function prototypes
+#include "ptg_sequence.h"
+
+/* Set to 1 to build the step sequence at runtime and change the trigger delay
+   after each run */
+#define PTG_SEQUENCE_RELOAD     (0)
+
+#if (PTG_SEQUENCE_RELOAD == 1)
+/* PTG Timer0 delays used in turn, in PTG clocks */
+static const uint32_t triggerDelays[] = { 0xfa00U, 0x7d00U, 0x3e80U };
+static volatile bool runCompleted = false;
+
+/* Same sequence as the generated one, with the trigger delay as a parameter */
+static PTG_SEQUENCE_ERROR sequenceLoad(uint32_t delay)
+{
+    PTG_SEQUENCE sequence;
+
+    PTG_SEQUENCE_Initialize(&sequence);
+    PTG_SEQUENCE_InputWait(&sequence, 0xfU, false);     //Trigger Input from INT2 PPS
+    PTG_SEQUENCE_TimerWait(&sequence, 0U, delay);
+    PTG_SEQUENCE_InterruptGenerate(&sequence, 0U);
+    PTG_SEQUENCE_TriggerGenerate(&sequence, 0xcU);      //Trigger for ADC Sample Trigger
+    PTG_SEQUENCE_InterruptGenerate(&sequence, 1U);
+    PTG_SEQUENCE_Jump(&sequence, 0U);
+
+    return PTG_SEQUENCE_Load(&sequence);
+}
+#endif
 
 static uint16_t adc_count;
 // *****************************************************************************
@@ -64,7 +91,9 @@ void trigger1callback(uintptr_t context){
     adc_count = ADC1_ChannelResultGet(ADC1_CHANNEL0); 
     printf("Post ADC conversion, the result is as follows\n\r");
     printf("ADC Count = 0x%03x", adc_count);
-    
+#if (PTG_SEQUENCE_RELOAD == 1)
+    runCompleted = true;
+#endif
 }
 int main ( void )
 {
@@ -80,11 +109,31 @@ int main ( void )
     PTG_EventCallbackRegister(TRIGGER1, trigger1callback, (uintptr_t) NULL);
     //Enabling PTG
     PTG_Enable();
+#if (PTG_SEQUENCE_RELOAD == 1)
+    (void)sequenceLoad(triggerDelays[0]);
+#endif
     //Starting the Step Sequence
     PTG_StepSequenceStart();
     
     while ( true )
     {
+#if (PTG_SEQUENCE_RELOAD == 1)
+        static uint32_t delayIndex = 0U;
+
+        if (runCompleted)
+        {
+            /* The sequence waits for the next switch press, retune it */
+            runCompleted = false;
+            delayIndex = (delayIndex + 1U) % (sizeof(triggerDelays) / sizeof(triggerDelays[0]));
+
+            PTG_StepSequenceStop();
+            if (sequenceLoad(triggerDelays[delayIndex]) == PTG_SEQUENCE_ERROR_NONE)
+            {
+                printf("\n\rTrigger delay changed to 0x%lx\n\r", (unsigned long)triggerDelays[delayIndex]);
+            }
+            PTG_StepSequenceStart();
+        }
+#endif
         /* Maintain state machines of all polled MPLAB Harmony modules. */
         SYS_Tasks ( );
     }
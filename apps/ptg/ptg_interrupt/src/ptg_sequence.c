@@ -0,0 +1,340 @@
+/*******************************************************************************
+  PTG Sequence Builder Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    ptg_sequence.c
+
+  Summary:
+    Typed construction, validation and runtime loading of PTG step sequences.
+
+  Description:
+    The builder functions record the first error and ignore the following
+    steps, so that a sequence is built without checking each call and
+    validated once.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// Section: Included Files
+
+#include <stddef.h>
+#include "ptg_sequence.h"
+
+// Section: Local Objects
+
+#define PTG_SEQUENCE_COMMAND(step)  ((uint32_t)(step) & 0xF0U)
+#define PTG_SEQUENCE_TARGET(step)   ((uint32_t)(step) & 0x1FU)
+
+// Section: Local Functions
+
+static void PTG_SEQUENCE_ErrorSet(PTG_SEQUENCE* sequence, PTG_SEQUENCE_ERROR error)
+{
+    if (sequence->error == PTG_SEQUENCE_ERROR_NONE)
+    {
+        sequence->error = error;
+        sequence->errorStep = sequence->count;
+    }
+}
+
+static void PTG_SEQUENCE_StepAdd(PTG_SEQUENCE* sequence, uint8_t step)
+{
+    if (sequence->error != PTG_SEQUENCE_ERROR_NONE)
+    {
+        return;
+    }
+
+    if (sequence->count >= PTG_STEP_COUNT)
+    {
+        PTG_SEQUENCE_ErrorSet(sequence, PTG_SEQUENCE_ERROR_FULL);
+        return;
+    }
+
+    sequence->steps[sequence->count] = step;
+    sequence->count++;
+}
+
+/* A limit register is shared by all the steps using it */
+static bool PTG_SEQUENCE_LimitClaim(PTG_SEQUENCE* sequence, uint32_t resource, uint32_t* limit, uint32_t value)
+{
+    if (((sequence->resources & resource) != 0U) && (*limit != value))
+    {
+        PTG_SEQUENCE_ErrorSet(sequence, PTG_SEQUENCE_ERROR_LIMIT);
+        return false;
+    }
+
+    sequence->resources |= resource;
+    *limit = value;
+
+    return true;
+}
+
+static bool PTG_SEQUENCE_StepIsWait(uint8_t step)
+{
+    uint32_t command = PTG_SEQUENCE_COMMAND(step);
+
+    return ((command == PTGWHI) || (command == PTGWLO)
+            || (step == PTG_SEQUENCE_STEP_TIMER0_WAIT) || (step == PTG_SEQUENCE_STEP_TIMER1_WAIT));
+}
+
+static bool PTG_SEQUENCE_StepIsJump(uint8_t step)
+{
+    /* PTGJMP, PTGJMPC0 and PTGJMPC1 use the upper 3 bits only */
+    return (((uint32_t)step & 0xE0U) == PTGJMP) || (((uint32_t)step & 0xE0U) == PTGJMPC0) || (((uint32_t)step & 0xE0U) == PTGJMPC1);
+}
+
+// Section: PTG Sequence Builder Implementation
+
+void PTG_SEQUENCE_Initialize(PTG_SEQUENCE* sequence)
+{
+    sequence->count = 0U;
+    sequence->resources = 0U;
+    sequence->error = PTG_SEQUENCE_ERROR_NONE;
+    sequence->errorStep = 0U;
+
+    sequence->limits.timer0 = 0U;
+    sequence->limits.timer1 = 0U;
+    sequence->limits.stepDelay = 0U;
+    sequence->limits.counter0 = 0U;
+    sequence->limits.counter1 = 0U;
+    sequence->limits.hold = 0U;
+    sequence->limits.adjust = 0U;
+}
+
+uint32_t PTG_SEQUENCE_Label(const PTG_SEQUENCE* sequence)
+{
+    return sequence->count;
+}
+
+void PTG_SEQUENCE_InputWait(PTG_SEQUENCE* sequence, uint32_t input, bool high)
+{
+    if (input > 15U)
+    {
+        PTG_SEQUENCE_ErrorSet(sequence, PTG_SEQUENCE_ERROR_OPERAND);
+        return;
+    }
+
+    PTG_SEQUENCE_StepAdd(sequence, high ? PTG_SEQUENCE_STEP_WAIT_HIGH(input) : PTG_SEQUENCE_STEP_WAIT_LOW(input));
+}
+
+void PTG_SEQUENCE_TimerWait(PTG_SEQUENCE* sequence, uint32_t timer, uint32_t limit)
+{
+    if ((timer > 1U) || (limit == 0U))
+    {
+        PTG_SEQUENCE_ErrorSet(sequence, PTG_SEQUENCE_ERROR_OPERAND);
+        return;
+    }
+
+    if (timer == 0U)
+    {
+        if (PTG_SEQUENCE_LimitClaim(sequence, PTG_LIMIT_TIMER0, &sequence->limits.timer0, limit))
+        {
+            PTG_SEQUENCE_StepAdd(sequence, PTG_SEQUENCE_STEP_TIMER0_WAIT);
+        }
+    }
+    else if (PTG_SEQUENCE_LimitClaim(sequence, PTG_LIMIT_TIMER1, &sequence->limits.timer1, limit))
+    {
+        PTG_SEQUENCE_StepAdd(sequence, PTG_SEQUENCE_STEP_TIMER1_WAIT);
+    }
+    else
+    {
+        /* Limit conflict, recorded */
+    }
+}
+
+void PTG_SEQUENCE_StepDelaySet(PTG_SEQUENCE* sequence, uint32_t delay)
+{
+    if (delay == 0U)
+    {
+        PTG_SEQUENCE_StepAdd(sequence, PTG_SEQUENCE_STEP_STEP_DELAY_DISABLE);
+    }
+    else if (PTG_SEQUENCE_LimitClaim(sequence, PTG_LIMIT_STEP_DELAY, &sequence->limits.stepDelay, delay))
+    {
+        PTG_SEQUENCE_StepAdd(sequence, PTG_SEQUENCE_STEP_STEP_DELAY_ENABLE);
+    }
+    else
+    {
+        /* Limit conflict, recorded */
+    }
+}
+
+void PTG_SEQUENCE_InterruptGenerate(PTG_SEQUENCE* sequence, uint32_t irq)
+{
+    if (irq > 3U)
+    {
+        PTG_SEQUENCE_ErrorSet(sequence, PTG_SEQUENCE_ERROR_OPERAND);
+        return;
+    }
+
+    PTG_SEQUENCE_StepAdd(sequence, PTG_SEQUENCE_STEP_INTERRUPT(irq));
+}
+
+void PTG_SEQUENCE_TriggerGenerate(PTG_SEQUENCE* sequence, uint32_t output)
+{
+    if (output > 31U)
+    {
+        PTG_SEQUENCE_ErrorSet(sequence, PTG_SEQUENCE_ERROR_OPERAND);
+        return;
+    }
+
+    PTG_SEQUENCE_StepAdd(sequence, PTG_SEQUENCE_STEP_TRIGGER(output));
+}
+
+void PTG_SEQUENCE_Jump(PTG_SEQUENCE* sequence, uint32_t step)
+{
+    if (step >= PTG_STEP_COUNT)
+    {
+        PTG_SEQUENCE_ErrorSet(sequence, PTG_SEQUENCE_ERROR_JUMP);
+        return;
+    }
+
+    PTG_SEQUENCE_StepAdd(sequence, PTG_SEQUENCE_STEP_JUMP(step));
+}
+
+void PTG_SEQUENCE_Loop(PTG_SEQUENCE* sequence, uint32_t counter, uint32_t step, uint32_t iterations)
+{
+    if ((counter > 1U) || (iterations == 0U))
+    {
+        PTG_SEQUENCE_ErrorSet(sequence, PTG_SEQUENCE_ERROR_OPERAND);
+        return;
+    }
+    if (step >= PTG_STEP_COUNT)
+    {
+        PTG_SEQUENCE_ErrorSet(sequence, PTG_SEQUENCE_ERROR_JUMP);
+        return;
+    }
+
+    /* The counter jumps back until it reaches its limit, the body runs limit + 1 times */
+    if (counter == 0U)
+    {
+        if (PTG_SEQUENCE_LimitClaim(sequence, PTG_LIMIT_COUNTER0, &sequence->limits.counter0, iterations - 1U))
+        {
+            PTG_SEQUENCE_StepAdd(sequence, PTG_SEQUENCE_STEP_LOOP0(step));
+        }
+    }
+    else if (PTG_SEQUENCE_LimitClaim(sequence, PTG_LIMIT_COUNTER1, &sequence->limits.counter1, iterations - 1U))
+    {
+        PTG_SEQUENCE_StepAdd(sequence, PTG_SEQUENCE_STEP_LOOP1(step));
+    }
+    else
+    {
+        /* Limit conflict, recorded */
+    }
+}
+
+PTG_SEQUENCE_ERROR PTG_SEQUENCE_Validate(const PTG_SEQUENCE* sequence, uint32_t* step)
+{
+    PTG_SEQUENCE_ERROR error = sequence->error;
+    uint32_t errorStep = sequence->errorStep;
+    uint32_t index;
+    uint32_t inner;
+    uint32_t target;
+    uint32_t command;
+    bool hasWait;
+
+    for (index = 0U; (error == PTG_SEQUENCE_ERROR_NONE) && (index < sequence->count); index++)
+    {
+        if (PTG_SEQUENCE_StepIsJump(sequence->steps[index]) == false)
+        {
+            continue;
+        }
+
+        errorStep = index;
+        command = (uint32_t)sequence->steps[index] & 0xE0U;
+        target = PTG_SEQUENCE_TARGET(sequence->steps[index]);
+
+        /* The steps past the sequence are NOPs, a jump there runs off the end */
+        if (target >= sequence->count)
+        {
+            error = PTG_SEQUENCE_ERROR_JUMP;
+        }
+        else if (target <= index)
+        {
+            hasWait = false;
+            for (inner = target; inner < index; inner++)
+            {
+                hasWait = hasWait || PTG_SEQUENCE_StepIsWait(sequence->steps[inner]);
+
+                /* A loop on the same counter inside the loop resets the counter */
+                if ((command != PTGJMP) && (((uint32_t)sequence->steps[inner] & 0xE0U) == command))
+                {
+                    error = PTG_SEQUENCE_ERROR_NESTED_LOOP;
+                }
+            }
+
+            /* A counted loop ends, an unconditional backward jump does not */
+            if ((error == PTG_SEQUENCE_ERROR_NONE) && (command == PTGJMP) && (hasWait == false))
+            {
+                error = PTG_SEQUENCE_ERROR_NO_WAIT;
+            }
+        }
+        else
+        {
+            /* Forward jump */
+        }
+    }
+
+    /* The step queue wraps around after its last step, it must wait somewhere */
+    if (error == PTG_SEQUENCE_ERROR_NONE)
+    {
+        hasWait = false;
+        for (index = 0U; index < sequence->count; index++)
+        {
+            hasWait = hasWait || PTG_SEQUENCE_StepIsWait(sequence->steps[index]);
+        }
+        if (hasWait == false)
+        {
+            error = PTG_SEQUENCE_ERROR_NO_WAIT;
+            errorStep = sequence->count;
+        }
+    }
+
+    if (step != NULL)
+    {
+        *step = errorStep;
+    }
+
+    return error;
+}
+
+PTG_SEQUENCE_ERROR PTG_SEQUENCE_Load(const PTG_SEQUENCE* sequence)
+{
+    PTG_SEQUENCE_ERROR error = PTG_SEQUENCE_Validate(sequence, NULL);
+
+    if (error != PTG_SEQUENCE_ERROR_NONE)
+    {
+        return error;
+    }
+
+    if (PTG_StepSequenceLoad(sequence->steps, sequence->count) == false)
+    {
+        return PTG_SEQUENCE_ERROR_RUNNING;
+    }
+    /* PTGHOLD, PTGADJ and the limits the steps do not use keep their value */
+    PTG_LimitsSet(&sequence->limits, sequence->resources);
+
+    return PTG_SEQUENCE_ERROR_NONE;
+}
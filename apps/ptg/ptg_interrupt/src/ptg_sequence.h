@@ -0,0 +1,272 @@
+/*******************************************************************************
+  PTG Sequence Builder Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    ptg_sequence.h
+
+  Summary:
+    Typed construction, validation and runtime loading of PTG step sequences.
+
+  Description:
+    A sequence is assembled with one function per step command, instead of
+    raw PTG_STEPx assignments. Each function checks its operands, and the
+    timer and counter commands record the limit they need, so that a
+    sequence carries its step queue and its PTG limits together.
+
+    The PTG_SEQUENCE_STEP_xxx macros encode the same steps for constant
+    tables built at compile time.
+
+    PTG_SEQUENCE_Load validates the whole sequence (jump targets, counter
+    loops, waits) and loads it between two runs of the step sequence, so that
+    the ADC and PWM trigger timing can be changed in the field.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef PTG_SEQUENCE_H
+#define PTG_SEQUENCE_H
+
+// Section: Included Files
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "definitions.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// Section: Step Encoding
+
+/* Step commands, the operand ranges are checked by the builder functions */
+#define PTG_SEQUENCE_STEP_NOP                   ((uint8_t)(PTGCTRL | 0x0U))
+#define PTG_SEQUENCE_STEP_STEP_DELAY_DISABLE    ((uint8_t)(PTGCTRL | 0x2U))
+#define PTG_SEQUENCE_STEP_STEP_DELAY_ENABLE     ((uint8_t)(PTGCTRL | 0x6U))
+#define PTG_SEQUENCE_STEP_TIMER0_WAIT           ((uint8_t)(PTGCTRL | 0x8U))
+#define PTG_SEQUENCE_STEP_TIMER1_WAIT           ((uint8_t)(PTGCTRL | 0x9U))
+#define PTG_SEQUENCE_STEP_WAIT_HIGH(input)      ((uint8_t)(PTGWHI | ((input) & 0xFU)))
+#define PTG_SEQUENCE_STEP_WAIT_LOW(input)       ((uint8_t)(PTGWLO | ((input) & 0xFU)))
+#define PTG_SEQUENCE_STEP_INTERRUPT(irq)        ((uint8_t)(PTGIRQ | ((irq) & 0x3U)))
+#define PTG_SEQUENCE_STEP_TRIGGER(output)       ((uint8_t)(PTGTRIG | ((output) & 0x1FU)))
+#define PTG_SEQUENCE_STEP_JUMP(step)            ((uint8_t)(PTGJMP | ((step) & 0x1FU)))
+#define PTG_SEQUENCE_STEP_LOOP0(step)           ((uint8_t)(PTGJMPC0 | ((step) & 0x1FU)))
+#define PTG_SEQUENCE_STEP_LOOP1(step)           ((uint8_t)(PTGJMPC1 | ((step) & 0x1FU)))
+
+// Section: Data Types
+
+/**
+ @enum     PTG_SEQUENCE_ERROR
+ @brief    Sequence errors, the first one is kept
+*/
+typedef enum
+{
+    PTG_SEQUENCE_ERROR_NONE,
+
+    /* More than PTG_STEP_COUNT steps */
+    PTG_SEQUENCE_ERROR_FULL,
+
+    /* Input, interrupt, trigger, timer or counter number out of range, or limit of 0 */
+    PTG_SEQUENCE_ERROR_OPERAND,
+
+    /* Timer or counter already used with another limit */
+    PTG_SEQUENCE_ERROR_LIMIT,
+
+    /* Jump past the last step */
+    PTG_SEQUENCE_ERROR_JUMP,
+
+    /* Counter loop inside a loop on the same counter */
+    PTG_SEQUENCE_ERROR_NESTED_LOOP,
+
+    /* Sequence or endless loop without any wait step, the PTG would spin at full speed */
+    PTG_SEQUENCE_ERROR_NO_WAIT,
+
+    /* The step sequence is running */
+    PTG_SEQUENCE_ERROR_RUNNING
+
+} PTG_SEQUENCE_ERROR;
+
+/**
+ @struct   PTG_SEQUENCE
+ @brief    Sequence under construction. The members are private.
+*/
+typedef struct
+{
+    uint8_t                 steps[PTG_STEP_COUNT];
+
+    uint32_t                count;
+
+    PTG_LIMITS              limits;
+
+    /* Timers and counters used by the steps, PTG_LIMIT_ bits */
+    uint32_t                resources;
+
+    PTG_SEQUENCE_ERROR      error;
+
+    uint32_t                errorStep;
+
+} PTG_SEQUENCE;
+
+// Section: Interface Functions
+
+/**
+ * @brief      Starts an empty sequence.
+ *
+ * @param      sequence - Sequence
+ *
+ * @return     None
+ */
+void PTG_SEQUENCE_Initialize(PTG_SEQUENCE* sequence);
+
+/**
+ * @brief      Returns the index of the next step, the target of a later jump or loop.
+ *
+ * @param      sequence - Sequence
+ *
+ * @return     Step index
+ */
+uint32_t PTG_SEQUENCE_Label(const PTG_SEQUENCE* sequence);
+
+/**
+ * @brief      Adds a wait for a PTG input level.
+ *
+ * @param      sequence - Sequence
+ * @param      input    - PTG input 0 to 15, see the device data sheet
+ * @param      high     - true to wait for a high level, false for a low level
+ *
+ * @return     None
+ */
+void PTG_SEQUENCE_InputWait(PTG_SEQUENCE* sequence, uint32_t input, bool high);
+
+/**
+ * @brief      Adds a wait for a PTG timer to reach its limit.
+ *
+ * @details    Each timer has a single limit, all the waits on a timer must use
+ *             the same limit.
+ *
+ * @param      sequence - Sequence
+ * @param      timer    - PTG timer 0 or 1
+ * @param      limit    - Timer limit in PTG clocks, from 1
+ *
+ * @return     None
+ */
+void PTG_SEQUENCE_TimerWait(PTG_SEQUENCE* sequence, uint32_t timer, uint32_t limit);
+
+/**
+ * @brief      Adds a step that enables or disables the step delay.
+ *
+ * @param      sequence - Sequence
+ * @param      delay    - Delay in PTG clocks inserted after each step, 0 disables the delay
+ *
+ * @return     None
+ */
+void PTG_SEQUENCE_StepDelaySet(PTG_SEQUENCE* sequence, uint32_t delay);
+
+/**
+ * @brief      Adds a PTG interrupt request.
+ *
+ * @param      sequence - Sequence
+ * @param      irq      - PTG interrupt 0 to 3
+ *
+ * @return     None
+ */
+void PTG_SEQUENCE_InterruptGenerate(PTG_SEQUENCE* sequence, uint32_t irq);
+
+/**
+ * @brief      Adds a trigger output pulse, such as an ADC or PWM trigger.
+ *
+ * @param      sequence - Sequence
+ * @param      output   - PTG trigger output 0 to 31, see the device data sheet
+ *
+ * @return     None
+ */
+void PTG_SEQUENCE_TriggerGenerate(PTG_SEQUENCE* sequence, uint32_t output);
+
+/**
+ * @brief      Adds an unconditional jump.
+ *
+ * @param      sequence - Sequence
+ * @param      step     - Target step, from PTG_SEQUENCE_Label
+ *
+ * @return     None
+ */
+void PTG_SEQUENCE_Jump(PTG_SEQUENCE* sequence, uint32_t step);
+
+/**
+ * @brief      Adds the end of a counted loop.
+ *
+ * @details    The steps from step to this one run iterations times, then the
+ *             sequence continues. Each counter has a single limit, all the
+ *             loops on a counter must use the same number of iterations.
+ *
+ * @param      sequence   - Sequence
+ * @param      counter    - PTG counter 0 or 1
+ * @param      step       - First step of the loop, from PTG_SEQUENCE_Label
+ * @param      iterations - Number of runs of the loop, from 1
+ *
+ * @return     None
+ */
+void PTG_SEQUENCE_Loop(PTG_SEQUENCE* sequence, uint32_t counter, uint32_t step, uint32_t iterations);
+
+/**
+ * @brief      Validates the whole sequence.
+ *
+ * @param      sequence - Sequence
+ * @param      step     - Index of the faulty step, can be NULL
+ *
+ * @return     First error \ref PTG_SEQUENCE_ERROR
+ */
+PTG_SEQUENCE_ERROR PTG_SEQUENCE_Validate(const PTG_SEQUENCE* sequence, uint32_t* step);
+
+/**
+ * @brief      Validates a sequence and loads it in the PTG.
+ *
+ * @details    The step queue and the limits are written only when the sequence
+ *             is valid and the step sequence is stopped, the previous sequence
+ *             is kept otherwise. Only the limits of the timers and counters
+ *             used by the steps are written, PTGHOLD and PTGADJ keep the
+ *             values set by PTG_Initialize. PTG_StepSequenceStart runs the
+ *             new sequence.
+ *
+ * @param      sequence - Sequence
+ *
+ * @return     PTG_SEQUENCE_ERROR_NONE when loaded, the error otherwise
+ */
+PTG_SEQUENCE_ERROR PTG_SEQUENCE_Load(const PTG_SEQUENCE* sequence);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif // PTG_SEQUENCE_H
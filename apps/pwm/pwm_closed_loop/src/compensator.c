@@ -0,0 +1,142 @@
+/*******************************************************************************
+  Fixed Point Compensator Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    compensator.c
+
+  Summary:
+    Fixed point PI and 2P2Z compensators for digital control loops.
+
+  Description:
+    This file implements integer PI and two-pole two-zero (2P2Z) compensators.
+    The code has no dependency on the device and can be built on a host to
+    simulate a control loop against a plant model.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// Section: Included Files
+
+#include "compensator.h"
+
+// Section: Local Functions
+
+static int64_t COMPENSATOR_Clamp(int64_t value, int32_t minimum, int32_t maximum)
+{
+    if (value < (int64_t)minimum)
+    {
+        value = (int64_t)minimum;
+    }
+    else if (value > (int64_t)maximum)
+    {
+        value = (int64_t)maximum;
+    }
+    else
+    {
+        /* Within limits */
+    }
+
+    return value;
+}
+
+// Section: Compensator Implementation
+
+void COMPENSATOR_PIInitialize(COMPENSATOR_PI* pi, int32_t kp, int32_t ki, uint32_t shift, int32_t outMin, int32_t outMax)
+{
+    pi->kp = kp;
+    pi->ki = ki;
+    pi->shift = shift;
+    pi->outMin = outMin;
+    pi->outMax = outMax;
+    pi->integrator = 0;
+}
+
+int32_t COMPENSATOR_PIUpdate(COMPENSATOR_PI* pi, int32_t error)
+{
+    int64_t integratorMin = (int64_t)pi->outMin * ((int64_t)1 << pi->shift);
+    int64_t integratorMax = (int64_t)pi->outMax * ((int64_t)1 << pi->shift);
+    int64_t output;
+
+    /* Integrator is kept with the gain fractional bits and limited to the
+       output range so it cannot wind up while the output is saturated */
+    pi->integrator += (int64_t)pi->ki * (int64_t)error;
+
+    if (pi->integrator < integratorMin)
+    {
+        pi->integrator = integratorMin;
+    }
+    else if (pi->integrator > integratorMax)
+    {
+        pi->integrator = integratorMax;
+    }
+    else
+    {
+        /* Within limits */
+    }
+
+    output = ((int64_t)pi->kp * (int64_t)error + pi->integrator) >> pi->shift;
+
+    return (int32_t)COMPENSATOR_Clamp(output, pi->outMin, pi->outMax);
+}
+
+void COMPENSATOR_2P2ZInitialize(COMPENSATOR_2P2Z* cmp, const int32_t b[3], const int32_t a[2], uint32_t shift, int32_t outMin, int32_t outMax)
+{
+    cmp->b[0] = b[0];
+    cmp->b[1] = b[1];
+    cmp->b[2] = b[2];
+    cmp->a[0] = a[0];
+    cmp->a[1] = a[1];
+    cmp->shift = shift;
+    cmp->outMin = outMin;
+    cmp->outMax = outMax;
+    cmp->x[0] = 0;
+    cmp->x[1] = 0;
+    cmp->y[0] = 0;
+    cmp->y[1] = 0;
+}
+
+int32_t COMPENSATOR_2P2ZUpdate(COMPENSATOR_2P2Z* cmp, int32_t error)
+{
+    int64_t accumulator;
+    int32_t output;
+
+    accumulator  = (int64_t)cmp->b[0] * (int64_t)error;
+    accumulator += (int64_t)cmp->b[1] * (int64_t)cmp->x[0];
+    accumulator += (int64_t)cmp->b[2] * (int64_t)cmp->x[1];
+    accumulator += (int64_t)cmp->a[0] * (int64_t)cmp->y[0];
+    accumulator += (int64_t)cmp->a[1] * (int64_t)cmp->y[1];
+
+    output = (int32_t)COMPENSATOR_Clamp(accumulator >> cmp->shift, cmp->outMin, cmp->outMax);
+
+    /* The clamped output is fed back so the history does not wind up */
+    cmp->x[1] = cmp->x[0];
+    cmp->x[0] = error;
+    cmp->y[1] = cmp->y[0];
+    cmp->y[0] = output;
+
+    return output;
+}
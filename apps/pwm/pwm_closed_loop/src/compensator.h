@@ -0,0 +1,157 @@
+/*******************************************************************************
+  Fixed Point Compensator Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    compensator.h
+
+  Summary:
+    Fixed point PI and 2P2Z compensators for digital control loops.
+
+  Description:
+    This file declares integer PI and two-pole two-zero (2P2Z) compensators.
+    The compensators use only integer arithmetic and have no dependency on
+    the device, so the same code can run on the target and on a host.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef COMPENSATOR_H
+#define COMPENSATOR_H
+
+// Section: Included Files
+
+#include <stdint.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// Section: Data Types
+
+/**
+ @struct   COMPENSATOR_PI
+ @brief    PI compensator. The gains are fixed point values with shift fractional
+           bits, for example shift 15 gives Q15 gains. The integrator is clamped
+           to the output limits (anti-windup).
+*/
+typedef struct
+{
+    int32_t                 kp;
+
+    int32_t                 ki;
+
+    uint32_t                shift;
+
+    int32_t                 outMin;
+
+    int32_t                 outMax;
+
+    int64_t                 integrator;
+
+} COMPENSATOR_PI;
+
+/**
+ @struct   COMPENSATOR_2P2Z
+ @brief    Two-pole two-zero compensator
+           y[n] = b0.x[n] + b1.x[n-1] + b2.x[n-2] + a1.y[n-1] + a2.y[n-2]
+           The coefficients are fixed point values with shift fractional bits, and
+           a1, a2 are stored with the sign used in the equation above. The output
+           history holds the clamped output (anti-windup).
+*/
+typedef struct
+{
+    int32_t                 b[3];
+
+    int32_t                 a[2];
+
+    uint32_t                shift;
+
+    int32_t                 outMin;
+
+    int32_t                 outMax;
+
+    int32_t                 x[2];
+
+    int32_t                 y[2];
+
+} COMPENSATOR_2P2Z;
+
+// Section: Interface Functions
+
+/**
+ * @brief      Initializes a PI compensator and clears its integrator.
+ * @param[in]  pi - PI compensator
+ * @param[in]  kp - Proportional gain
+ * @param[in]  ki - Integral gain, per sample
+ * @param[in]  shift - Number of fractional bits of the gains
+ * @param[in]  outMin - Minimum output
+ * @param[in]  outMax - Maximum output
+ * @return     none
+ */
+void COMPENSATOR_PIInitialize(COMPENSATOR_PI* pi, int32_t kp, int32_t ki, uint32_t shift, int32_t outMin, int32_t outMax);
+
+/**
+ * @brief      Runs one step of a PI compensator.
+ * @param[in]  pi - PI compensator
+ * @param[in]  error - Reference minus feedback
+ * @return     Compensator output, within the output limits
+ */
+int32_t COMPENSATOR_PIUpdate(COMPENSATOR_PI* pi, int32_t error);
+
+/**
+ * @brief      Initializes a 2P2Z compensator and clears its history.
+ * @param[in]  cmp - 2P2Z compensator
+ * @param[in]  b - Coefficients b0, b1 and b2
+ * @param[in]  a - Coefficients a1 and a2
+ * @param[in]  shift - Number of fractional bits of the coefficients
+ * @param[in]  outMin - Minimum output
+ * @param[in]  outMax - Maximum output
+ * @return     none
+ */
+void COMPENSATOR_2P2ZInitialize(COMPENSATOR_2P2Z* cmp, const int32_t b[3], const int32_t a[2], uint32_t shift, int32_t outMin, int32_t outMax);
+
+/**
+ * @brief      Runs one step of a 2P2Z compensator.
+ * @param[in]  cmp - 2P2Z compensator
+ * @param[in]  error - Reference minus feedback
+ * @return     Compensator output, within the output limits
+ */
+int32_t COMPENSATOR_2P2ZUpdate(COMPENSATOR_2P2Z* cmp, int32_t error);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif // COMPENSATOR_H
@@ -0,0 +1,110 @@
+/*******************************************************************************
+ System Interrupts File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    interrupt.c
+
+  Summary:
+    Interrupt vectors mapping
+
+  Description:
+    This file maps all the interrupt vectors to their corresponding
+    implementations. If a particular module interrupt is used, then its ISR
+    definition can be found in corresponding PLIB source file. If a module
+    interrupt is not used, then its ISR implementation is mapped to dummy
+    handler.
+ *******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *******************************************************************************/
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include "interrupts.h"
+#include "definitions.h"
+
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: System Interrupt Vector Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/* All the handlers are defined here.  Each will call its PLIB-specific function. */
+// Section: System Interrupt Vector declarations
+
+
+void _PWM1Interrupt (void);
+void _PWM2Interrupt (void);
+void _PWM3Interrupt (void);
+void _PWM4Interrupt (void);
+void _T1Interrupt (void);
+void _AD1CH0Interrupt (void);
+
+// Section: System Interrupt Vector definitions
+
+void __attribute__ (( interrupt, no_auto_psv)) _PWM1Interrupt (void)
+{
+    PWM1_InterruptHandler();
+}
+
+void __attribute__ (( interrupt, no_auto_psv)) _PWM2Interrupt (void)
+{
+    PWM2_InterruptHandler();
+}
+
+void __attribute__ (( interrupt, no_auto_psv)) _PWM3Interrupt (void)
+{
+    PWM3_InterruptHandler();
+}
+
+void __attribute__ (( interrupt, no_auto_psv)) _PWM4Interrupt (void)
+{
+    PWM4_InterruptHandler();
+}
+
+void __attribute__ (( interrupt, no_auto_psv)) _T1Interrupt (void)
+{
+    T1_InterruptHandler();
+}
+
+void __attribute__ (( interrupt, no_auto_psv)) _AD1CH0Interrupt (void)
+{
+    AD1CH0_InterruptHandler();
+}
+
+
+
+
+/*******************************************************************************
+ End of File
+*/
@@ -0,0 +1,1202 @@
+/*******************************************************************************
+  PWM PLIB
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    plib_pwm.c
+
+  Summary:
+    PWM PLIB Source File
+
+  Description:
+    None
+
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// Section: Included Files
+
+
+#include "plib_pwm.h"
+#include "interrupts.h"
+
+//PWM Generator x PCI Termination Polarity options
+#define PG1FPCI_PPS_NON_INVERTED          ((uint32_t)(_PG1FPCI_PPS_MASK & ((uint32_t)(0) << _PG1FPCI_PPS_POSITION))) 
+#define PG1FPCI_PPS_INVERTED          ((uint32_t)(_PG1FPCI_PPS_MASK & ((uint32_t)(1) << _PG1FPCI_PPS_POSITION))) 
+
+//PGxCON MDCSEL bit
+#define PG1CON_MDCSEL_PGxDC          ((uint32_t)(_PG1CON_MDCSEL_MASK & ((uint32_t)(0) << _PG1CON_MDCSEL_POSITION)))
+#define PG1CON_MDCSEL_MDC          ((uint32_t)(_PG1CON_MDCSEL_MASK & ((uint32_t)(1) << _PG1CON_MDCSEL_POSITION)))
+
+//PGxCON MPERSEL bit
+#define PG1CON_MPERSEL_PGxPER          ((uint32_t)(_PG1CON_MPERSEL_MASK & ((uint32_t)(0) << _PG1CON_MPERSEL_POSITION)))
+#define PG1CON_MPERSEL_MPER          ((uint32_t)(_PG1CON_MPERSEL_MASK & ((uint32_t)(1) << _PG1CON_MPERSEL_POSITION)))
+
+//PGxCON MPHSEL bit
+#define PG1CON_MPHSEL_PGxPHASE          ((uint32_t)(_PG1CON_MPHSEL_MASK & ((uint32_t)(0) << _PG1CON_MPHSEL_POSITION)))
+#define PG1CON_MPHSEL_MPHASE          ((uint32_t)(_PG1CON_MPHSEL_MASK & ((uint32_t)(1) << _PG1CON_MPHSEL_POSITION)))
+
+//PGxCON MSTEN bit
+#define PG1CON_MSTEN_DISABLED          ((uint32_t)(_PG1CON_MSTEN_MASK & ((uint32_t)(0) << _PG1CON_MSTEN_POSITION)))
+#define PG1CON_MSTEN_ENABLED          ((uint32_t)(_PG1CON_MSTEN_MASK & ((uint32_t)(1) << _PG1CON_MSTEN_POSITION)))
+
+//PWM Generator x Trigger Mode Selection options
+#define PG1CON_TRGMOD_SINGLE_TRIGGER_MODE            ((uint32_t)(_PG1CON_TRGMOD_MASK & ((uint32_t)(0) << _PG1CON_TRGMOD_POSITION))) 
+#define PG1CON_TRGMOD_RETRIGGRERABLE_MODE            ((uint32_t)(_PG1CON_TRGMOD_MASK & ((uint32_t)(1) << _PG1CON_TRGMOD_POSITION))) 
+
+//PWM Generator x Data Register Update Modes
+#define PG1CON_UPDMOD_SOC            ((uint32_t)(_PG1CON_UPDMOD_MASK & ((uint32_t)(0) << _PG1CON_UPDMOD_POSITION))) 
+#define PG1CON_UPDMOD_IMMEDIATE            ((uint32_t)(_PG1CON_UPDMOD_MASK & ((uint32_t)(1) << _PG1CON_UPDMOD_POSITION))) 
+#define PG1CON_UPDMOD_CLIENT_SOC            ((uint32_t)(_PG1CON_UPDMOD_MASK & ((uint32_t)(2) << _PG1CON_UPDMOD_POSITION))) 
+#define PG1CON_UPDMOD_CLIENT_IMMEDIATE            ((uint32_t)(_PG1CON_UPDMOD_MASK & ((uint32_t)(3) << _PG1CON_UPDMOD_POSITION))) 
+
+//PWM Generator x Start-of-Cycle Selection bits
+#define PG1CON_SOCS_LOCAL_EOC            ((uint32_t)(_PG1CON_SOCS_MASK & ((uint32_t)(0) << _PG1CON_SOCS_POSITION)))
+#define PG1CON_SOCS_TRIG_OP_BY_PG1_OR_PG5            ((uint32_t)(_PG1CON_SOCS_MASK & ((uint32_t)(1) << _PG1CON_SOCS_POSITION)))
+#define PG1CON_SOCS_TRIG_OP_BY_PG2_OR_PG6            ((uint32_t)(_PG1CON_SOCS_MASK & ((uint32_t)(2) << _PG1CON_SOCS_POSITION)))
+#define PG1CON_SOCS_TRIG_OP_BY_PG3_OR_PG7            ((uint32_t)(_PG1CON_SOCS_MASK & ((uint32_t)(3) << _PG1CON_SOCS_POSITION)))
+#define PG1CON_SOCS_TRIG_OP_BY_PG4_OR_PG8            ((uint32_t)(_PG1CON_SOCS_MASK & ((uint32_t)(4) << _PG1CON_SOCS_POSITION)))
+#define PG1CON_SOCS_TRIG_BIT_OR_PCI_SYNC_FN_ONLY            ((uint32_t)(_PG1CON_SOCS_MASK & ((uint32_t)(15) << _PG1CON_SOCS_POSITION)))
+
+//PWM Generator x CLKSEL bits
+#define PG1CON_CLKSEL_NO_CLOCK          ((uint32_t)(_PG1CON_CLKSEL_MASK & ((uint32_t)(0) << _PG1CON_CLKSEL_POSITION)))
+#define PG1CON_CLKSEL_MASTER_CLOCK_BY_MCLKSEL          ((uint32_t)(_PG1CON_CLKSEL_MASK & ((uint32_t)(1) << _PG1CON_CLKSEL_POSITION)))
+#define PG1CON_CLKSEL_MASTER_CLOCK_DIVIDER          ((uint32_t)(_PG1CON_CLKSEL_MASK & ((uint32_t)(2) << _PG1CON_CLKSEL_POSITION)))
+#define PG1CON_CLKSEL_MASTER_CLOCK_FREQ_SCALING          ((uint32_t)(_PG1CON_CLKSEL_MASK & ((uint32_t)(3) << _PG1CON_CLKSEL_POSITION)))
+
+#define PG1CON_MODSEL_INDEPENDENT_EDGE          ((uint32_t)(_PG1CON_MODSEL_MASK & ((uint32_t)(0) << _PG1CON_MODSEL_POSITION)))
+#define PG1CON_MODSEL_VARIABLE_PHASE          ((uint32_t)(_PG1CON_MODSEL_MASK & ((uint32_t)(1) << _PG1CON_MODSEL_POSITION)))
+#define PG1CON_MODSEL_INDEPENDENT_EDGE_DUAL_OUTPUT          ((uint32_t)(_PG1CON_MODSEL_MASK & ((uint32_t)(2) << _PG1CON_MODSEL_POSITION)))
+#define PG1CON_MODSEL_CENTER_ALIGNED          ((uint32_t)(_PG1CON_MODSEL_MASK & ((uint32_t)(4) << _PG1CON_MODSEL_POSITION)))
+#define PG1CON_MODSEL_DOUBLE_UPDATE_CENTER_ALIGNED          ((uint32_t)(_PG1CON_MODSEL_MASK & ((uint32_t)(5) << _PG1CON_MODSEL_POSITION)))
+#define PG1CON_MODSEL_DUALEDGE_CA_ONE_UPDATE_CYCLE          ((uint32_t)(_PG1CON_MODSEL_MASK & ((uint32_t)(6) << _PG1CON_MODSEL_POSITION)))
+#define PG1CON_MODSEL_DUALEDGE_CA_TWO_UPDATE_CYCLE          ((uint32_t)(_PG1CON_MODSEL_MASK & ((uint32_t)(7) << _PG1CON_MODSEL_POSITION)))
+
+//PWM Generator x PMOD bits
+#define PG1IOCON_PMOD_COMPLEMENTARY_MODE          ((uint32_t)(_PG1IOCON_PMOD_MASK & ((uint32_t)(0) << _PG1IOCON_PMOD_POSITION)))
+#define PG1IOCON_PMOD_INDEPENDENT_MODE          ((uint32_t)(_PG1IOCON_PMOD_MASK & ((uint32_t)(1) << _PG1IOCON_PMOD_POSITION)))
+#define PG1IOCON_PMOD_PUSH_PULL_MODE          ((uint32_t)(_PG1IOCON_PMOD_MASK & ((uint32_t)(2) << _PG1IOCON_PMOD_POSITION)))
+#define PG1IOCON_PMOD_RESERVED          ((uint32_t)(_PG1IOCON_PMOD_MASK & ((uint32_t)(3) << _PG1IOCON_PMOD_POSITION)))
+
+//PWM Generator x POLH bit
+#define PG1IOCON_POLH_ACTIVE_HIGH          ((uint32_t)(_PG1IOCON_POLH_MASK & ((uint32_t)(0) << _PG1IOCON_POLH_POSITION)))
+#define PG1IOCON_POLH_ACTIVE_LOW          ((uint32_t)(_PG1IOCON_POLH_MASK & ((uint32_t)(1) << _PG1IOCON_POLH_POSITION)))
+
+//PWM Generator x POLL bit
+#define PG1IOCON_POLL_ACTIVE_HIGH          ((uint32_t)(_PG1IOCON_POLL_MASK & ((uint32_t)(0) << _PG1IOCON_POLL_POSITION)))
+#define PG1IOCON_POLL_ACTIVE_LOW          ((uint32_t)(_PG1IOCON_POLL_MASK & ((uint32_t)(1) << _PG1IOCON_POLL_POSITION)))
+
+//PWM Generator x SWAP bit
+#define PG1IOCON_SWAP_NORMAL_MAPPING          ((uint32_t)(_PG1IOCON_SWAP_MASK & ((uint32_t)(0) << _PG1IOCON_SWAP_POSITION)))
+#define PG1IOCON_SWAP_SWAPPED          ((uint32_t)(_PG1IOCON_SWAP_MASK & ((uint32_t)(1) << _PG1IOCON_SWAP_POSITION)))
+
+#define PG1IOCON_OVRENH_PWM_GENERATOR          ((uint32_t)(_PG1IOCON_OVRENH_MASK & ((uint32_t)(0) << _PG1IOCON_OVRENH_POSITION)))
+#define PG1IOCON_OVRENH_OVRDAT_1          ((uint32_t)(_PG1IOCON_OVRENH_MASK & ((uint32_t)(1) << _PG1IOCON_OVRENH_POSITION)))
+
+//PWM Generator x OVRENL bit
+#define PG1IOCON_OVRENL_PWM_GENERATOR          ((uint32_t)(_PG1IOCON_OVRENL_MASK & ((uint32_t)(0) << _PG1IOCON_OVRENL_POSITION)))
+#define PG1IOCON_OVRENL_OVRDAT_0          ((uint32_t)(_PG1IOCON_OVRENL_MASK & ((uint32_t)(1) << _PG1IOCON_OVRENL_POSITION)))
+
+//PWM Generator x OSYNC[1:0] bits
+#define PG1IOCON_OSYNC_SYNC_TO_LOCAL_PWM_TIMEBASE          ((uint32_t)(_PG1IOCON_OSYNC_MASK & ((uint32_t)(0) << _PG1IOCON_OSYNC_POSITION)))
+#define PG1IOCON_OSYNC_SYNC_IMMEDIATE          ((uint32_t)(_PG1IOCON_OSYNC_MASK & ((uint32_t)(1) << _PG1IOCON_OSYNC_POSITION)))
+#define PG1IOCON_OSYNC_SYNC_TO_UPDMOD          ((uint32_t)(_PG1IOCON_OSYNC_MASK & ((uint32_t)(2) << _PG1IOCON_OSYNC_POSITION)))
+#define PG1IOCON_OSYNC_SYNC_TO_DATA_BUFFER_UPDATE          ((uint32_t)(_PG1IOCON_OSYNC_MASK & ((uint32_t)(3) << _PG1IOCON_OSYNC_POSITION)))
+
+//PGxEVT ADTR2EN3 bit
+#define PG1EVT_ADTR2EN3_DISABLED          ((uint32_t)(_PG1EVT_ADTR2EN3_MASK & ((uint32_t)(0) << _PG1EVT_ADTR2EN3_POSITION)))
+#define PG1EVT_ADTR2EN3_ENABLED          ((uint32_t)(_PG1EVT_ADTR2EN3_MASK & ((uint32_t)(1) << _PG1EVT_ADTR2EN3_POSITION)))
+
+//PGxEVT ADTR2EN2 bit
+#define PG1EVT_ADTR2EN2_DISABLED          ((uint32_t)(_PG1EVT_ADTR2EN2_MASK & ((uint32_t)(0) << _PG1EVT_ADTR2EN2_POSITION)))
+#define PG1EVT_ADTR2EN2_ENABLED          ((uint32_t)(_PG1EVT_ADTR2EN2_MASK & ((uint32_t)(1) << _PG1EVT_ADTR2EN2_POSITION)))
+
+//PGxEVT ADTR2EN1 bit
+#define PG1EVT_ADTR2EN1_DISABLED          ((uint32_t)(_PG1EVT_ADTR2EN1_MASK & ((uint32_t)(0) << _PG1EVT_ADTR2EN1_POSITION)))
+#define PG1EVT_ADTR2EN1_ENABLED          ((uint32_t)(_PG1EVT_ADTR2EN1_MASK & ((uint32_t)(1) << _PG1EVT_ADTR2EN1_POSITION)))
+
+//PGxEVT ADTR1EN3 bit
+#define PG1EVT_ADTR1EN3_DISABLED          ((uint32_t)(_PG1EVT_ADTR1EN3_MASK & ((uint32_t)(0) << _PG1EVT_ADTR1EN3_POSITION)))
+#define PG1EVT_ADTR1EN3_ENABLED          ((uint32_t)(_PG1EVT_ADTR1EN3_MASK & ((uint32_t)(1) << _PG1EVT_ADTR1EN3_POSITION)))
+
+//PGxEVT ADTR1EN2 bit
+#define PG1EVT_ADTR1EN2_DISABLED          ((uint32_t)(_PG1EVT_ADTR1EN2_MASK & ((uint32_t)(0) << _PG1EVT_ADTR1EN2_POSITION)))
+#define PG1EVT_ADTR1EN2_ENABLED          ((uint32_t)(_PG1EVT_ADTR1EN2_MASK & ((uint32_t)(1) << _PG1EVT_ADTR1EN2_POSITION)))
+
+//PGxEVT ADTR1EN1 bit
+#define PG1EVT_ADTR1EN1_DISABLED          ((uint32_t)(_PG1EVT_ADTR1EN1_MASK & ((uint32_t)(0) << _PG1EVT_ADTR1EN1_POSITION)))
+#define PG1EVT_ADTR1EN1_ENABLED          ((uint32_t)(_PG1EVT_ADTR1EN1_MASK & ((uint32_t)(1) << _PG1EVT_ADTR1EN1_POSITION)))
+
+//PGxEVT PWMPCI[2:0] bits
+#define PG1EVT_PWMPCI_PWM_GENERATOR_1          ((uint32_t)(_PG1EVT_PWMPCI_MASK & ((uint32_t)(0) << _PG1EVT_PWMPCI_POSITION)))
+#define PG1EVT_PWMPCI_PWM_GENERATOR_2          ((uint32_t)(_PG1EVT_PWMPCI_MASK & ((uint32_t)(1) << _PG1EVT_PWMPCI_POSITION)))
+#define PG1EVT_PWMPCI_PWM_GENERATOR_3          ((uint32_t)(_PG1EVT_PWMPCI_MASK & ((uint32_t)(2) << _PG1EVT_PWMPCI_POSITION)))
+#define PG1EVT_PWMPCI_PWM_GENERATOR_4          ((uint32_t)(_PG1EVT_PWMPCI_MASK & ((uint32_t)(3) << _PG1EVT_PWMPCI_POSITION)))
+
+//PGxEVT UPDTRG[1:0] bits
+#define PG1EVT_UPDTRG_MANUAL          ((uint32_t)(_PG1EVT_UPDTRG_MASK & ((uint32_t)(0) << _PG1EVT_UPDTRG_POSITION)))
+#define PG1EVT_UPDTRG_PGxDC          ((uint32_t)(_PG1EVT_UPDTRG_MASK & ((uint32_t)(1) << _PG1EVT_UPDTRG_POSITION)))
+#define PG1EVT_UPDTRG_PGxPHASE          ((uint32_t)(_PG1EVT_UPDTRG_MASK & ((uint32_t)(2) << _PG1EVT_UPDTRG_POSITION)))
+#define PG1EVT_UPDTRG_PGxTRIGA          ((uint32_t)(_PG1EVT_UPDTRG_MASK & ((uint32_t)(3) << _PG1EVT_UPDTRG_POSITION)))
+
+//PGxEVT PGTRGSEL[2:0] bits
+#define PG1EVT_PGTRGSEL_EOC          ((uint32_t)(_PG1EVT_PGTRGSEL_MASK & ((uint32_t)(0) << _PG1EVT_PGTRGSEL_POSITION)))
+#define PG1EVT_PGTRGSEL_TRIGA_COMPARE          ((uint32_t)(_PG1EVT_PGTRGSEL_MASK & ((uint32_t)(1) << _PG1EVT_PGTRGSEL_POSITION)))
+#define PG1EVT_PGTRGSEL_TRIGB_COMPARE          ((uint32_t)(_PG1EVT_PGTRGSEL_MASK & ((uint32_t)(2) << _PG1EVT_PGTRGSEL_POSITION)))
+#define PG1EVT_PGTRGSEL_TRIGC_COMPARE          ((uint32_t)(_PG1EVT_PGTRGSEL_MASK & ((uint32_t)(3) << _PG1EVT_PGTRGSEL_POSITION)))
+        
+//PWM Generator x PCI Termination Polarity options
+#define PG2FPCI_PPS_NON_INVERTED          ((uint32_t)(_PG2FPCI_PPS_MASK & ((uint32_t)(0) << _PG2FPCI_PPS_POSITION))) 
+#define PG2FPCI_PPS_INVERTED          ((uint32_t)(_PG2FPCI_PPS_MASK & ((uint32_t)(1) << _PG2FPCI_PPS_POSITION))) 
+
+//PGxCON MDCSEL bit
+#define PG2CON_MDCSEL_PGxDC          ((uint32_t)(_PG2CON_MDCSEL_MASK & ((uint32_t)(0) << _PG2CON_MDCSEL_POSITION)))
+#define PG2CON_MDCSEL_MDC          ((uint32_t)(_PG2CON_MDCSEL_MASK & ((uint32_t)(1) << _PG2CON_MDCSEL_POSITION)))
+
+//PGxCON MPERSEL bit
+#define PG2CON_MPERSEL_PGxPER          ((uint32_t)(_PG2CON_MPERSEL_MASK & ((uint32_t)(0) << _PG2CON_MPERSEL_POSITION)))
+#define PG2CON_MPERSEL_MPER          ((uint32_t)(_PG2CON_MPERSEL_MASK & ((uint32_t)(1) << _PG2CON_MPERSEL_POSITION)))
+
+//PGxCON MPHSEL bit
+#define PG2CON_MPHSEL_PGxPHASE          ((uint32_t)(_PG2CON_MPHSEL_MASK & ((uint32_t)(0) << _PG2CON_MPHSEL_POSITION)))
+#define PG2CON_MPHSEL_MPHASE          ((uint32_t)(_PG2CON_MPHSEL_MASK & ((uint32_t)(1) << _PG2CON_MPHSEL_POSITION)))
+
+//PGxCON MSTEN bit
+#define PG2CON_MSTEN_DISABLED          ((uint32_t)(_PG2CON_MSTEN_MASK & ((uint32_t)(0) << _PG2CON_MSTEN_POSITION)))
+#define PG2CON_MSTEN_ENABLED          ((uint32_t)(_PG2CON_MSTEN_MASK & ((uint32_t)(1) << _PG2CON_MSTEN_POSITION)))
+
+//PWM Generator x Trigger Mode Selection options
+#define PG2CON_TRGMOD_SINGLE_TRIGGER_MODE            ((uint32_t)(_PG2CON_TRGMOD_MASK & ((uint32_t)(0) << _PG2CON_TRGMOD_POSITION))) 
+#define PG2CON_TRGMOD_RETRIGGRERABLE_MODE            ((uint32_t)(_PG2CON_TRGMOD_MASK & ((uint32_t)(1) << _PG2CON_TRGMOD_POSITION))) 
+
+//PWM Generator x Data Register Update Modes
+#define PG2CON_UPDMOD_SOC            ((uint32_t)(_PG2CON_UPDMOD_MASK & ((uint32_t)(0) << _PG2CON_UPDMOD_POSITION))) 
+#define PG2CON_UPDMOD_IMMEDIATE            ((uint32_t)(_PG2CON_UPDMOD_MASK & ((uint32_t)(1) << _PG2CON_UPDMOD_POSITION))) 
+#define PG2CON_UPDMOD_CLIENT_SOC            ((uint32_t)(_PG2CON_UPDMOD_MASK & ((uint32_t)(2) << _PG2CON_UPDMOD_POSITION))) 
+#define PG2CON_UPDMOD_CLIENT_IMMEDIATE            ((uint32_t)(_PG2CON_UPDMOD_MASK & ((uint32_t)(3) << _PG2CON_UPDMOD_POSITION))) 
+
+//PWM Generator x Start-of-Cycle Selection bits
+#define PG2CON_SOCS_LOCAL_EOC            ((uint32_t)(_PG2CON_SOCS_MASK & ((uint32_t)(0) << _PG2CON_SOCS_POSITION)))
+#define PG2CON_SOCS_TRIG_OP_BY_PG1_OR_PG5            ((uint32_t)(_PG2CON_SOCS_MASK & ((uint32_t)(1) << _PG2CON_SOCS_POSITION)))
+#define PG2CON_SOCS_TRIG_OP_BY_PG2_OR_PG6            ((uint32_t)(_PG2CON_SOCS_MASK & ((uint32_t)(2) << _PG2CON_SOCS_POSITION)))
+#define PG2CON_SOCS_TRIG_OP_BY_PG3_OR_PG7            ((uint32_t)(_PG2CON_SOCS_MASK & ((uint32_t)(3) << _PG2CON_SOCS_POSITION)))
+#define PG2CON_SOCS_TRIG_OP_BY_PG4_OR_PG8            ((uint32_t)(_PG2CON_SOCS_MASK & ((uint32_t)(4) << _PG2CON_SOCS_POSITION)))
+#define PG2CON_SOCS_TRIG_BIT_OR_PCI_SYNC_FN_ONLY            ((uint32_t)(_PG2CON_SOCS_MASK & ((uint32_t)(15) << _PG2CON_SOCS_POSITION)))
+
+//PWM Generator x CLKSEL bits
+#define PG2CON_CLKSEL_NO_CLOCK          ((uint32_t)(_PG2CON_CLKSEL_MASK & ((uint32_t)(0) << _PG2CON_CLKSEL_POSITION)))
+#define PG2CON_CLKSEL_MASTER_CLOCK_BY_MCLKSEL          ((uint32_t)(_PG2CON_CLKSEL_MASK & ((uint32_t)(1) << _PG2CON_CLKSEL_POSITION)))
+#define PG2CON_CLKSEL_MASTER_CLOCK_DIVIDER          ((uint32_t)(_PG2CON_CLKSEL_MASK & ((uint32_t)(2) << _PG2CON_CLKSEL_POSITION)))
+#define PG2CON_CLKSEL_MASTER_CLOCK_FREQ_SCALING          ((uint32_t)(_PG2CON_CLKSEL_MASK & ((uint32_t)(3) << _PG2CON_CLKSEL_POSITION)))
+
+#define PG2CON_MODSEL_INDEPENDENT_EDGE          ((uint32_t)(_PG2CON_MODSEL_MASK & ((uint32_t)(0) << _PG2CON_MODSEL_POSITION)))
+#define PG2CON_MODSEL_VARIABLE_PHASE          ((uint32_t)(_PG2CON_MODSEL_MASK & ((uint32_t)(1) << _PG2CON_MODSEL_POSITION)))
+#define PG2CON_MODSEL_INDEPENDENT_EDGE_DUAL_OUTPUT          ((uint32_t)(_PG2CON_MODSEL_MASK & ((uint32_t)(2) << _PG2CON_MODSEL_POSITION)))
+#define PG2CON_MODSEL_CENTER_ALIGNED          ((uint32_t)(_PG2CON_MODSEL_MASK & ((uint32_t)(4) << _PG2CON_MODSEL_POSITION)))
+#define PG2CON_MODSEL_DOUBLE_UPDATE_CENTER_ALIGNED          ((uint32_t)(_PG2CON_MODSEL_MASK & ((uint32_t)(5) << _PG2CON_MODSEL_POSITION)))
+#define PG2CON_MODSEL_DUALEDGE_CA_ONE_UPDATE_CYCLE          ((uint32_t)(_PG2CON_MODSEL_MASK & ((uint32_t)(6) << _PG2CON_MODSEL_POSITION)))
+#define PG2CON_MODSEL_DUALEDGE_CA_TWO_UPDATE_CYCLE          ((uint32_t)(_PG2CON_MODSEL_MASK & ((uint32_t)(7) << _PG2CON_MODSEL_POSITION)))
+
+//PWM Generator x PMOD bits
+#define PG2IOCON_PMOD_COMPLEMENTARY_MODE          ((uint32_t)(_PG2IOCON_PMOD_MASK & ((uint32_t)(0) << _PG2IOCON_PMOD_POSITION)))
+#define PG2IOCON_PMOD_INDEPENDENT_MODE          ((uint32_t)(_PG2IOCON_PMOD_MASK & ((uint32_t)(1) << _PG2IOCON_PMOD_POSITION)))
+#define PG2IOCON_PMOD_PUSH_PULL_MODE          ((uint32_t)(_PG2IOCON_PMOD_MASK & ((uint32_t)(2) << _PG2IOCON_PMOD_POSITION)))
+#define PG2IOCON_PMOD_RESERVED          ((uint32_t)(_PG2IOCON_PMOD_MASK & ((uint32_t)(3) << _PG2IOCON_PMOD_POSITION)))
+
+//PWM Generator x POLH bit
+#define PG2IOCON_POLH_ACTIVE_HIGH          ((uint32_t)(_PG2IOCON_POLH_MASK & ((uint32_t)(0) << _PG2IOCON_POLH_POSITION)))
+#define PG2IOCON_POLH_ACTIVE_LOW          ((uint32_t)(_PG2IOCON_POLH_MASK & ((uint32_t)(1) << _PG2IOCON_POLH_POSITION)))
+
+//PWM Generator x POLL bit
+#define PG2IOCON_POLL_ACTIVE_HIGH          ((uint32_t)(_PG2IOCON_POLL_MASK & ((uint32_t)(0) << _PG2IOCON_POLL_POSITION)))
+#define PG2IOCON_POLL_ACTIVE_LOW          ((uint32_t)(_PG2IOCON_POLL_MASK & ((uint32_t)(1) << _PG2IOCON_POLL_POSITION)))
+
+//PWM Generator x SWAP bit
+#define PG2IOCON_SWAP_NORMAL_MAPPING          ((uint32_t)(_PG2IOCON_SWAP_MASK & ((uint32_t)(0) << _PG2IOCON_SWAP_POSITION)))
+#define PG2IOCON_SWAP_SWAPPED          ((uint32_t)(_PG2IOCON_SWAP_MASK & ((uint32_t)(1) << _PG2IOCON_SWAP_POSITION)))
+
+#define PG2IOCON_OVRENH_PWM_GENERATOR          ((uint32_t)(_PG2IOCON_OVRENH_MASK & ((uint32_t)(0) << _PG2IOCON_OVRENH_POSITION)))
+#define PG2IOCON_OVRENH_OVRDAT_1          ((uint32_t)(_PG2IOCON_OVRENH_MASK & ((uint32_t)(1) << _PG2IOCON_OVRENH_POSITION)))
+
+//PWM Generator x OVRENL bit
+#define PG2IOCON_OVRENL_PWM_GENERATOR          ((uint32_t)(_PG2IOCON_OVRENL_MASK & ((uint32_t)(0) << _PG2IOCON_OVRENL_POSITION)))
+#define PG2IOCON_OVRENL_OVRDAT_0          ((uint32_t)(_PG2IOCON_OVRENL_MASK & ((uint32_t)(1) << _PG2IOCON_OVRENL_POSITION)))
+
+//PWM Generator x OSYNC[1:0] bits
+#define PG2IOCON_OSYNC_SYNC_TO_LOCAL_PWM_TIMEBASE          ((uint32_t)(_PG2IOCON_OSYNC_MASK & ((uint32_t)(0) << _PG2IOCON_OSYNC_POSITION)))
+#define PG2IOCON_OSYNC_SYNC_IMMEDIATE          ((uint32_t)(_PG2IOCON_OSYNC_MASK & ((uint32_t)(1) << _PG2IOCON_OSYNC_POSITION)))
+#define PG2IOCON_OSYNC_SYNC_TO_UPDMOD          ((uint32_t)(_PG2IOCON_OSYNC_MASK & ((uint32_t)(2) << _PG2IOCON_OSYNC_POSITION)))
+#define PG2IOCON_OSYNC_SYNC_TO_DATA_BUFFER_UPDATE          ((uint32_t)(_PG2IOCON_OSYNC_MASK & ((uint32_t)(3) << _PG2IOCON_OSYNC_POSITION)))
+
+//PGxEVT ADTR2EN3 bit
+#define PG2EVT_ADTR2EN3_DISABLED          ((uint32_t)(_PG2EVT_ADTR2EN3_MASK & ((uint32_t)(0) << _PG2EVT_ADTR2EN3_POSITION)))
+#define PG2EVT_ADTR2EN3_ENABLED          ((uint32_t)(_PG2EVT_ADTR2EN3_MASK & ((uint32_t)(1) << _PG2EVT_ADTR2EN3_POSITION)))
+
+//PGxEVT ADTR2EN2 bit
+#define PG2EVT_ADTR2EN2_DISABLED          ((uint32_t)(_PG2EVT_ADTR2EN2_MASK & ((uint32_t)(0) << _PG2EVT_ADTR2EN2_POSITION)))
+#define PG2EVT_ADTR2EN2_ENABLED          ((uint32_t)(_PG2EVT_ADTR2EN2_MASK & ((uint32_t)(1) << _PG2EVT_ADTR2EN2_POSITION)))
+
+//PGxEVT ADTR2EN1 bit
+#define PG2EVT_ADTR2EN1_DISABLED          ((uint32_t)(_PG2EVT_ADTR2EN1_MASK & ((uint32_t)(0) << _PG2EVT_ADTR2EN1_POSITION)))
+#define PG2EVT_ADTR2EN1_ENABLED          ((uint32_t)(_PG2EVT_ADTR2EN1_MASK & ((uint32_t)(1) << _PG2EVT_ADTR2EN1_POSITION)))
+
+//PGxEVT ADTR1EN3 bit
+#define PG2EVT_ADTR1EN3_DISABLED          ((uint32_t)(_PG2EVT_ADTR1EN3_MASK & ((uint32_t)(0) << _PG2EVT_ADTR1EN3_POSITION)))
+#define PG2EVT_ADTR1EN3_ENABLED          ((uint32_t)(_PG2EVT_ADTR1EN3_MASK & ((uint32_t)(1) << _PG2EVT_ADTR1EN3_POSITION)))
+
+//PGxEVT ADTR1EN2 bit
+#define PG2EVT_ADTR1EN2_DISABLED          ((uint32_t)(_PG2EVT_ADTR1EN2_MASK & ((uint32_t)(0) << _PG2EVT_ADTR1EN2_POSITION)))
+#define PG2EVT_ADTR1EN2_ENABLED          ((uint32_t)(_PG2EVT_ADTR1EN2_MASK & ((uint32_t)(1) << _PG2EVT_ADTR1EN2_POSITION)))
+
+//PGxEVT ADTR1EN1 bit
+#define PG2EVT_ADTR1EN1_DISABLED          ((uint32_t)(_PG2EVT_ADTR1EN1_MASK & ((uint32_t)(0) << _PG2EVT_ADTR1EN1_POSITION)))
+#define PG2EVT_ADTR1EN1_ENABLED          ((uint32_t)(_PG2EVT_ADTR1EN1_MASK & ((uint32_t)(1) << _PG2EVT_ADTR1EN1_POSITION)))
+
+//PGxEVT PWMPCI[2:0] bits
+#define PG2EVT_PWMPCI_PWM_GENERATOR_1          ((uint32_t)(_PG2EVT_PWMPCI_MASK & ((uint32_t)(0) << _PG2EVT_PWMPCI_POSITION)))
+#define PG2EVT_PWMPCI_PWM_GENERATOR_2          ((uint32_t)(_PG2EVT_PWMPCI_MASK & ((uint32_t)(1) << _PG2EVT_PWMPCI_POSITION)))
+#define PG2EVT_PWMPCI_PWM_GENERATOR_3          ((uint32_t)(_PG2EVT_PWMPCI_MASK & ((uint32_t)(2) << _PG2EVT_PWMPCI_POSITION)))
+#define PG2EVT_PWMPCI_PWM_GENERATOR_4          ((uint32_t)(_PG2EVT_PWMPCI_MASK & ((uint32_t)(3) << _PG2EVT_PWMPCI_POSITION)))
+
+//PGxEVT UPDTRG[1:0] bits
+#define PG2EVT_UPDTRG_MANUAL          ((uint32_t)(_PG2EVT_UPDTRG_MASK & ((uint32_t)(0) << _PG2EVT_UPDTRG_POSITION)))
+#define PG2EVT_UPDTRG_PGxDC          ((uint32_t)(_PG2EVT_UPDTRG_MASK & ((uint32_t)(1) << _PG2EVT_UPDTRG_POSITION)))
+#define PG2EVT_UPDTRG_PGxPHASE          ((uint32_t)(_PG2EVT_UPDTRG_MASK & ((uint32_t)(2) << _PG2EVT_UPDTRG_POSITION)))
+#define PG2EVT_UPDTRG_PGxTRIGA          ((uint32_t)(_PG2EVT_UPDTRG_MASK & ((uint32_t)(3) << _PG2EVT_UPDTRG_POSITION)))
+
+//PGxEVT PGTRGSEL[2:0] bits
+#define PG2EVT_PGTRGSEL_EOC          ((uint32_t)(_PG2EVT_PGTRGSEL_MASK & ((uint32_t)(0) << _PG2EVT_PGTRGSEL_POSITION)))
+#define PG2EVT_PGTRGSEL_TRIGA_COMPARE          ((uint32_t)(_PG2EVT_PGTRGSEL_MASK & ((uint32_t)(1) << _PG2EVT_PGTRGSEL_POSITION)))
+#define PG2EVT_PGTRGSEL_TRIGB_COMPARE          ((uint32_t)(_PG2EVT_PGTRGSEL_MASK & ((uint32_t)(2) << _PG2EVT_PGTRGSEL_POSITION)))
+#define PG2EVT_PGTRGSEL_TRIGC_COMPARE          ((uint32_t)(_PG2EVT_PGTRGSEL_MASK & ((uint32_t)(3) << _PG2EVT_PGTRGSEL_POSITION)))
+        
+//PWM Generator x PCI Termination Polarity options
+#define PG3FPCI_PPS_NON_INVERTED          ((uint32_t)(_PG3FPCI_PPS_MASK & ((uint32_t)(0) << _PG3FPCI_PPS_POSITION))) 
+#define PG3FPCI_PPS_INVERTED          ((uint32_t)(_PG3FPCI_PPS_MASK & ((uint32_t)(1) << _PG3FPCI_PPS_POSITION))) 
+
+//PGxCON MDCSEL bit
+#define PG3CON_MDCSEL_PGxDC          ((uint32_t)(_PG3CON_MDCSEL_MASK & ((uint32_t)(0) << _PG3CON_MDCSEL_POSITION)))
+#define PG3CON_MDCSEL_MDC          ((uint32_t)(_PG3CON_MDCSEL_MASK & ((uint32_t)(1) << _PG3CON_MDCSEL_POSITION)))
+
+//PGxCON MPERSEL bit
+#define PG3CON_MPERSEL_PGxPER          ((uint32_t)(_PG3CON_MPERSEL_MASK & ((uint32_t)(0) << _PG3CON_MPERSEL_POSITION)))
+#define PG3CON_MPERSEL_MPER          ((uint32_t)(_PG3CON_MPERSEL_MASK & ((uint32_t)(1) << _PG3CON_MPERSEL_POSITION)))
+
+//PGxCON MPHSEL bit
+#define PG3CON_MPHSEL_PGxPHASE          ((uint32_t)(_PG3CON_MPHSEL_MASK & ((uint32_t)(0) << _PG3CON_MPHSEL_POSITION)))
+#define PG3CON_MPHSEL_MPHASE          ((uint32_t)(_PG3CON_MPHSEL_MASK & ((uint32_t)(1) << _PG3CON_MPHSEL_POSITION)))
+
+//PGxCON MSTEN bit
+#define PG3CON_MSTEN_DISABLED          ((uint32_t)(_PG3CON_MSTEN_MASK & ((uint32_t)(0) << _PG3CON_MSTEN_POSITION)))
+#define PG3CON_MSTEN_ENABLED          ((uint32_t)(_PG3CON_MSTEN_MASK & ((uint32_t)(1) << _PG3CON_MSTEN_POSITION)))
+
+//PWM Generator x Trigger Mode Selection options
+#define PG3CON_TRGMOD_SINGLE_TRIGGER_MODE            ((uint32_t)(_PG3CON_TRGMOD_MASK & ((uint32_t)(0) << _PG3CON_TRGMOD_POSITION))) 
+#define PG3CON_TRGMOD_RETRIGGRERABLE_MODE            ((uint32_t)(_PG3CON_TRGMOD_MASK & ((uint32_t)(1) << _PG3CON_TRGMOD_POSITION))) 
+
+//PWM Generator x Data Register Update Modes
+#define PG3CON_UPDMOD_SOC            ((uint32_t)(_PG3CON_UPDMOD_MASK & ((uint32_t)(0) << _PG3CON_UPDMOD_POSITION))) 
+#define PG3CON_UPDMOD_IMMEDIATE            ((uint32_t)(_PG3CON_UPDMOD_MASK & ((uint32_t)(1) << _PG3CON_UPDMOD_POSITION))) 
+#define PG3CON_UPDMOD_CLIENT_SOC            ((uint32_t)(_PG3CON_UPDMOD_MASK & ((uint32_t)(2) << _PG3CON_UPDMOD_POSITION))) 
+#define PG3CON_UPDMOD_CLIENT_IMMEDIATE            ((uint32_t)(_PG3CON_UPDMOD_MASK & ((uint32_t)(3) << _PG3CON_UPDMOD_POSITION))) 
+
+//PWM Generator x Start-of-Cycle Selection bits
+#define PG3CON_SOCS_LOCAL_EOC            ((uint32_t)(_PG3CON_SOCS_MASK & ((uint32_t)(0) << _PG3CON_SOCS_POSITION)))
+#define PG3CON_SOCS_TRIG_OP_BY_PG1_OR_PG5            ((uint32_t)(_PG3CON_SOCS_MASK & ((uint32_t)(1) << _PG3CON_SOCS_POSITION)))
+#define PG3CON_SOCS_TRIG_OP_BY_PG2_OR_PG6            ((uint32_t)(_PG3CON_SOCS_MASK & ((uint32_t)(2) << _PG3CON_SOCS_POSITION)))
+#define PG3CON_SOCS_TRIG_OP_BY_PG3_OR_PG7            ((uint32_t)(_PG3CON_SOCS_MASK & ((uint32_t)(3) << _PG3CON_SOCS_POSITION)))
+#define PG3CON_SOCS_TRIG_OP_BY_PG4_OR_PG8            ((uint32_t)(_PG3CON_SOCS_MASK & ((uint32_t)(4) << _PG3CON_SOCS_POSITION)))
+#define PG3CON_SOCS_TRIG_BIT_OR_PCI_SYNC_FN_ONLY            ((uint32_t)(_PG3CON_SOCS_MASK & ((uint32_t)(15) << _PG3CON_SOCS_POSITION)))
+
+//PWM Generator x CLKSEL bits
+#define PG3CON_CLKSEL_NO_CLOCK          ((uint32_t)(_PG3CON_CLKSEL_MASK & ((uint32_t)(0) << _PG3CON_CLKSEL_POSITION)))
+#define PG3CON_CLKSEL_MASTER_CLOCK_BY_MCLKSEL          ((uint32_t)(_PG3CON_CLKSEL_MASK & ((uint32_t)(1) << _PG3CON_CLKSEL_POSITION)))
+#define PG3CON_CLKSEL_MASTER_CLOCK_DIVIDER          ((uint32_t)(_PG3CON_CLKSEL_MASK & ((uint32_t)(2) << _PG3CON_CLKSEL_POSITION)))
+#define PG3CON_CLKSEL_MASTER_CLOCK_FREQ_SCALING          ((uint32_t)(_PG3CON_CLKSEL_MASK & ((uint32_t)(3) << _PG3CON_CLKSEL_POSITION)))
+
+#define PG3CON_MODSEL_INDEPENDENT_EDGE          ((uint32_t)(_PG3CON_MODSEL_MASK & ((uint32_t)(0) << _PG3CON_MODSEL_POSITION)))
+#define PG3CON_MODSEL_VARIABLE_PHASE          ((uint32_t)(_PG3CON_MODSEL_MASK & ((uint32_t)(1) << _PG3CON_MODSEL_POSITION)))
+#define PG3CON_MODSEL_INDEPENDENT_EDGE_DUAL_OUTPUT          ((uint32_t)(_PG3CON_MODSEL_MASK & ((uint32_t)(2) << _PG3CON_MODSEL_POSITION)))
+#define PG3CON_MODSEL_CENTER_ALIGNED          ((uint32_t)(_PG3CON_MODSEL_MASK & ((uint32_t)(4) << _PG3CON_MODSEL_POSITION)))
+#define PG3CON_MODSEL_DOUBLE_UPDATE_CENTER_ALIGNED          ((uint32_t)(_PG3CON_MODSEL_MASK & ((uint32_t)(5) << _PG3CON_MODSEL_POSITION)))
+#define PG3CON_MODSEL_DUALEDGE_CA_ONE_UPDATE_CYCLE          ((uint32_t)(_PG3CON_MODSEL_MASK & ((uint32_t)(6) << _PG3CON_MODSEL_POSITION)))
+#define PG3CON_MODSEL_DUALEDGE_CA_TWO_UPDATE_CYCLE          ((uint32_t)(_PG3CON_MODSEL_MASK & ((uint32_t)(7) << _PG3CON_MODSEL_POSITION)))
+
+//PWM Generator x PMOD bits
+#define PG3IOCON_PMOD_COMPLEMENTARY_MODE          ((uint32_t)(_PG3IOCON_PMOD_MASK & ((uint32_t)(0) << _PG3IOCON_PMOD_POSITION)))
+#define PG3IOCON_PMOD_INDEPENDENT_MODE          ((uint32_t)(_PG3IOCON_PMOD_MASK & ((uint32_t)(1) << _PG3IOCON_PMOD_POSITION)))
+#define PG3IOCON_PMOD_PUSH_PULL_MODE          ((uint32_t)(_PG3IOCON_PMOD_MASK & ((uint32_t)(2) << _PG3IOCON_PMOD_POSITION)))
+#define PG3IOCON_PMOD_RESERVED          ((uint32_t)(_PG3IOCON_PMOD_MASK & ((uint32_t)(3) << _PG3IOCON_PMOD_POSITION)))
+
+//PWM Generator x POLH bit
+#define PG3IOCON_POLH_ACTIVE_HIGH          ((uint32_t)(_PG3IOCON_POLH_MASK & ((uint32_t)(0) << _PG3IOCON_POLH_POSITION)))
+#define PG3IOCON_POLH_ACTIVE_LOW          ((uint32_t)(_PG3IOCON_POLH_MASK & ((uint32_t)(1) << _PG3IOCON_POLH_POSITION)))
+
+//PWM Generator x POLL bit
+#define PG3IOCON_POLL_ACTIVE_HIGH          ((uint32_t)(_PG3IOCON_POLL_MASK & ((uint32_t)(0) << _PG3IOCON_POLL_POSITION)))
+#define PG3IOCON_POLL_ACTIVE_LOW          ((uint32_t)(_PG3IOCON_POLL_MASK & ((uint32_t)(1) << _PG3IOCON_POLL_POSITION)))
+
+//PWM Generator x SWAP bit
+#define PG3IOCON_SWAP_NORMAL_MAPPING          ((uint32_t)(_PG3IOCON_SWAP_MASK & ((uint32_t)(0) << _PG3IOCON_SWAP_POSITION)))
+#define PG3IOCON_SWAP_SWAPPED          ((uint32_t)(_PG3IOCON_SWAP_MASK & ((uint32_t)(1) << _PG3IOCON_SWAP_POSITION)))
+
+#define PG3IOCON_OVRENH_PWM_GENERATOR          ((uint32_t)(_PG3IOCON_OVRENH_MASK & ((uint32_t)(0) << _PG3IOCON_OVRENH_POSITION)))
+#define PG3IOCON_OVRENH_OVRDAT_1          ((uint32_t)(_PG3IOCON_OVRENH_MASK & ((uint32_t)(1) << _PG3IOCON_OVRENH_POSITION)))
+
+//PWM Generator x OVRENL bit
+#define PG3IOCON_OVRENL_PWM_GENERATOR          ((uint32_t)(_PG3IOCON_OVRENL_MASK & ((uint32_t)(0) << _PG3IOCON_OVRENL_POSITION)))
+#define PG3IOCON_OVRENL_OVRDAT_0          ((uint32_t)(_PG3IOCON_OVRENL_MASK & ((uint32_t)(1) << _PG3IOCON_OVRENL_POSITION)))
+
+//PWM Generator x OSYNC[1:0] bits
+#define PG3IOCON_OSYNC_SYNC_TO_LOCAL_PWM_TIMEBASE          ((uint32_t)(_PG3IOCON_OSYNC_MASK & ((uint32_t)(0) << _PG3IOCON_OSYNC_POSITION)))
+#define PG3IOCON_OSYNC_SYNC_IMMEDIATE          ((uint32_t)(_PG3IOCON_OSYNC_MASK & ((uint32_t)(1) << _PG3IOCON_OSYNC_POSITION)))
+#define PG3IOCON_OSYNC_SYNC_TO_UPDMOD          ((uint32_t)(_PG3IOCON_OSYNC_MASK & ((uint32_t)(2) << _PG3IOCON_OSYNC_POSITION)))
+#define PG3IOCON_OSYNC_SYNC_TO_DATA_BUFFER_UPDATE          ((uint32_t)(_PG3IOCON_OSYNC_MASK & ((uint32_t)(3) << _PG3IOCON_OSYNC_POSITION)))
+
+//PGxEVT ADTR2EN3 bit
+#define PG3EVT_ADTR2EN3_DISABLED          ((uint32_t)(_PG3EVT_ADTR2EN3_MASK & ((uint32_t)(0) << _PG3EVT_ADTR2EN3_POSITION)))
+#define PG3EVT_ADTR2EN3_ENABLED          ((uint32_t)(_PG3EVT_ADTR2EN3_MASK & ((uint32_t)(1) << _PG3EVT_ADTR2EN3_POSITION)))
+
+//PGxEVT ADTR2EN2 bit
+#define PG3EVT_ADTR2EN2_DISABLED          ((uint32_t)(_PG3EVT_ADTR2EN2_MASK & ((uint32_t)(0) << _PG3EVT_ADTR2EN2_POSITION)))
+#define PG3EVT_ADTR2EN2_ENABLED          ((uint32_t)(_PG3EVT_ADTR2EN2_MASK & ((uint32_t)(1) << _PG3EVT_ADTR2EN2_POSITION)))
+
+//PGxEVT ADTR2EN1 bit
+#define PG3EVT_ADTR2EN1_DISABLED          ((uint32_t)(_PG3EVT_ADTR2EN1_MASK & ((uint32_t)(0) << _PG3EVT_ADTR2EN1_POSITION)))
+#define PG3EVT_ADTR2EN1_ENABLED          ((uint32_t)(_PG3EVT_ADTR2EN1_MASK & ((uint32_t)(1) << _PG3EVT_ADTR2EN1_POSITION)))
+
+//PGxEVT ADTR1EN3 bit
+#define PG3EVT_ADTR1EN3_DISABLED          ((uint32_t)(_PG3EVT_ADTR1EN3_MASK & ((uint32_t)(0) << _PG3EVT_ADTR1EN3_POSITION)))
+#define PG3EVT_ADTR1EN3_ENABLED          ((uint32_t)(_PG3EVT_ADTR1EN3_MASK & ((uint32_t)(1) << _PG3EVT_ADTR1EN3_POSITION)))
+
+//PGxEVT ADTR1EN2 bit
+#define PG3EVT_ADTR1EN2_DISABLED          ((uint32_t)(_PG3EVT_ADTR1EN2_MASK & ((uint32_t)(0) << _PG3EVT_ADTR1EN2_POSITION)))
+#define PG3EVT_ADTR1EN2_ENABLED          ((uint32_t)(_PG3EVT_ADTR1EN2_MASK & ((uint32_t)(1) << _PG3EVT_ADTR1EN2_POSITION)))
+
+//PGxEVT ADTR1EN1 bit
+#define PG3EVT_ADTR1EN1_DISABLED          ((uint32_t)(_PG3EVT_ADTR1EN1_MASK & ((uint32_t)(0) << _PG3EVT_ADTR1EN1_POSITION)))
+#define PG3EVT_ADTR1EN1_ENABLED          ((uint32_t)(_PG3EVT_ADTR1EN1_MASK & ((uint32_t)(1) << _PG3EVT_ADTR1EN1_POSITION)))
+
+//PGxEVT PWMPCI[2:0] bits
+#define PG3EVT_PWMPCI_PWM_GENERATOR_1          ((uint32_t)(_PG3EVT_PWMPCI_MASK & ((uint32_t)(0) << _PG3EVT_PWMPCI_POSITION)))
+#define PG3EVT_PWMPCI_PWM_GENERATOR_2          ((uint32_t)(_PG3EVT_PWMPCI_MASK & ((uint32_t)(1) << _PG3EVT_PWMPCI_POSITION)))
+#define PG3EVT_PWMPCI_PWM_GENERATOR_3          ((uint32_t)(_PG3EVT_PWMPCI_MASK & ((uint32_t)(2) << _PG3EVT_PWMPCI_POSITION)))
+#define PG3EVT_PWMPCI_PWM_GENERATOR_4          ((uint32_t)(_PG3EVT_PWMPCI_MASK & ((uint32_t)(3) << _PG3EVT_PWMPCI_POSITION)))
+
+//PGxEVT UPDTRG[1:0] bits
+#define PG3EVT_UPDTRG_MANUAL          ((uint32_t)(_PG3EVT_UPDTRG_MASK & ((uint32_t)(0) << _PG3EVT_UPDTRG_POSITION)))
+#define PG3EVT_UPDTRG_PGxDC          ((uint32_t)(_PG3EVT_UPDTRG_MASK & ((uint32_t)(1) << _PG3EVT_UPDTRG_POSITION)))
+#define PG3EVT_UPDTRG_PGxPHASE          ((uint32_t)(_PG3EVT_UPDTRG_MASK & ((uint32_t)(2) << _PG3EVT_UPDTRG_POSITION)))
+#define PG3EVT_UPDTRG_PGxTRIGA          ((uint32_t)(_PG3EVT_UPDTRG_MASK & ((uint32_t)(3) << _PG3EVT_UPDTRG_POSITION)))
+
+//PGxEVT PGTRGSEL[2:0] bits
+#define PG3EVT_PGTRGSEL_EOC          ((uint32_t)(_PG3EVT_PGTRGSEL_MASK & ((uint32_t)(0) << _PG3EVT_PGTRGSEL_POSITION)))
+#define PG3EVT_PGTRGSEL_TRIGA_COMPARE          ((uint32_t)(_PG3EVT_PGTRGSEL_MASK & ((uint32_t)(1) << _PG3EVT_PGTRGSEL_POSITION)))
+#define PG3EVT_PGTRGSEL_TRIGB_COMPARE          ((uint32_t)(_PG3EVT_PGTRGSEL_MASK & ((uint32_t)(2) << _PG3EVT_PGTRGSEL_POSITION)))
+#define PG3EVT_PGTRGSEL_TRIGC_COMPARE          ((uint32_t)(_PG3EVT_PGTRGSEL_MASK & ((uint32_t)(3) << _PG3EVT_PGTRGSEL_POSITION)))
+        
+//PWM Generator x PCI Termination Polarity options
+#define PG4FPCI_PPS_NON_INVERTED          ((uint32_t)(_PG4FPCI_PPS_MASK & ((uint32_t)(0) << _PG4FPCI_PPS_POSITION))) 
+#define PG4FPCI_PPS_INVERTED          ((uint32_t)(_PG4FPCI_PPS_MASK & ((uint32_t)(1) << _PG4FPCI_PPS_POSITION))) 
+
+//PGxCON MDCSEL bit
+#define PG4CON_MDCSEL_PGxDC          ((uint32_t)(_PG4CON_MDCSEL_MASK & ((uint32_t)(0) << _PG4CON_MDCSEL_POSITION)))
+#define PG4CON_MDCSEL_MDC          ((uint32_t)(_PG4CON_MDCSEL_MASK & ((uint32_t)(1) << _PG4CON_MDCSEL_POSITION)))
+
+//PGxCON MPERSEL bit
+#define PG4CON_MPERSEL_PGxPER          ((uint32_t)(_PG4CON_MPERSEL_MASK & ((uint32_t)(0) << _PG4CON_MPERSEL_POSITION)))
+#define PG4CON_MPERSEL_MPER          ((uint32_t)(_PG4CON_MPERSEL_MASK & ((uint32_t)(1) << _PG4CON_MPERSEL_POSITION)))
+
+//PGxCON MPHSEL bit
+#define PG4CON_MPHSEL_PGxPHASE          ((uint32_t)(_PG4CON_MPHSEL_MASK & ((uint32_t)(0) << _PG4CON_MPHSEL_POSITION)))
+#define PG4CON_MPHSEL_MPHASE          ((uint32_t)(_PG4CON_MPHSEL_MASK & ((uint32_t)(1) << _PG4CON_MPHSEL_POSITION)))
+
+//PGxCON MSTEN bit
+#define PG4CON_MSTEN_DISABLED          ((uint32_t)(_PG4CON_MSTEN_MASK & ((uint32_t)(0) << _PG4CON_MSTEN_POSITION)))
+#define PG4CON_MSTEN_ENABLED          ((uint32_t)(_PG4CON_MSTEN_MASK & ((uint32_t)(1) << _PG4CON_MSTEN_POSITION)))
+
+//PWM Generator x Trigger Mode Selection options
+#define PG4CON_TRGMOD_SINGLE_TRIGGER_MODE            ((uint32_t)(_PG4CON_TRGMOD_MASK & ((uint32_t)(0) << _PG4CON_TRGMOD_POSITION))) 
+#define PG4CON_TRGMOD_RETRIGGRERABLE_MODE            ((uint32_t)(_PG4CON_TRGMOD_MASK & ((uint32_t)(1) << _PG4CON_TRGMOD_POSITION))) 
+
+//PWM Generator x Data Register Update Modes
+#define PG4CON_UPDMOD_SOC            ((uint32_t)(_PG4CON_UPDMOD_MASK & ((uint32_t)(0) << _PG4CON_UPDMOD_POSITION))) 
+#define PG4CON_UPDMOD_IMMEDIATE            ((uint32_t)(_PG4CON_UPDMOD_MASK & ((uint32_t)(1) << _PG4CON_UPDMOD_POSITION))) 
+#define PG4CON_UPDMOD_CLIENT_SOC            ((uint32_t)(_PG4CON_UPDMOD_MASK & ((uint32_t)(2) << _PG4CON_UPDMOD_POSITION))) 
+#define PG4CON_UPDMOD_CLIENT_IMMEDIATE            ((uint32_t)(_PG4CON_UPDMOD_MASK & ((uint32_t)(3) << _PG4CON_UPDMOD_POSITION))) 
+
+//PWM Generator x Start-of-Cycle Selection bits
+#define PG4CON_SOCS_LOCAL_EOC            ((uint32_t)(_PG4CON_SOCS_MASK & ((uint32_t)(0) << _PG4CON_SOCS_POSITION)))
+#define PG4CON_SOCS_TRIG_OP_BY_PG1_OR_PG5            ((uint32_t)(_PG4CON_SOCS_MASK & ((uint32_t)(1) << _PG4CON_SOCS_POSITION)))
+#define PG4CON_SOCS_TRIG_OP_BY_PG2_OR_PG6            ((uint32_t)(_PG4CON_SOCS_MASK & ((uint32_t)(2) << _PG4CON_SOCS_POSITION)))
+#define PG4CON_SOCS_TRIG_OP_BY_PG3_OR_PG7            ((uint32_t)(_PG4CON_SOCS_MASK & ((uint32_t)(3) << _PG4CON_SOCS_POSITION)))
+#define PG4CON_SOCS_TRIG_OP_BY_PG4_OR_PG8            ((uint32_t)(_PG4CON_SOCS_MASK & ((uint32_t)(4) << _PG4CON_SOCS_POSITION)))
+#define PG4CON_SOCS_TRIG_BIT_OR_PCI_SYNC_FN_ONLY            ((uint32_t)(_PG4CON_SOCS_MASK & ((uint32_t)(15) << _PG4CON_SOCS_POSITION)))
+
+//PWM Generator x CLKSEL bits
+#define PG4CON_CLKSEL_NO_CLOCK          ((uint32_t)(_PG4CON_CLKSEL_MASK & ((uint32_t)(0) << _PG4CON_CLKSEL_POSITION)))
+#define PG4CON_CLKSEL_MASTER_CLOCK_BY_MCLKSEL          ((uint32_t)(_PG4CON_CLKSEL_MASK & ((uint32_t)(1) << _PG4CON_CLKSEL_POSITION)))
+#define PG4CON_CLKSEL_MASTER_CLOCK_DIVIDER          ((uint32_t)(_PG4CON_CLKSEL_MASK & ((uint32_t)(2) << _PG4CON_CLKSEL_POSITION)))
+#define PG4CON_CLKSEL_MASTER_CLOCK_FREQ_SCALING          ((uint32_t)(_PG4CON_CLKSEL_MASK & ((uint32_t)(3) << _PG4CON_CLKSEL_POSITION)))
+
+#define PG4CON_MODSEL_INDEPENDENT_EDGE          ((uint32_t)(_PG4CON_MODSEL_MASK & ((uint32_t)(0) << _PG4CON_MODSEL_POSITION)))
+#define PG4CON_MODSEL_VARIABLE_PHASE          ((uint32_t)(_PG4CON_MODSEL_MASK & ((uint32_t)(1) << _PG4CON_MODSEL_POSITION)))
+#define PG4CON_MODSEL_INDEPENDENT_EDGE_DUAL_OUTPUT          ((uint32_t)(_PG4CON_MODSEL_MASK & ((uint32_t)(2) << _PG4CON_MODSEL_POSITION)))
+#define PG4CON_MODSEL_CENTER_ALIGNED          ((uint32_t)(_PG4CON_MODSEL_MASK & ((uint32_t)(4) << _PG4CON_MODSEL_POSITION)))
+#define PG4CON_MODSEL_DOUBLE_UPDATE_CENTER_ALIGNED          ((uint32_t)(_PG4CON_MODSEL_MASK & ((uint32_t)(5) << _PG4CON_MODSEL_POSITION)))
+#define PG4CON_MODSEL_DUALEDGE_CA_ONE_UPDATE_CYCLE          ((uint32_t)(_PG4CON_MODSEL_MASK & ((uint32_t)(6) << _PG4CON_MODSEL_POSITION)))
+#define PG4CON_MODSEL_DUALEDGE_CA_TWO_UPDATE_CYCLE          ((uint32_t)(_PG4CON_MODSEL_MASK & ((uint32_t)(7) << _PG4CON_MODSEL_POSITION)))
+
+//PWM Generator x PMOD bits
+#define PG4IOCON_PMOD_COMPLEMENTARY_MODE          ((uint32_t)(_PG4IOCON_PMOD_MASK & ((uint32_t)(0) << _PG4IOCON_PMOD_POSITION)))
+#define PG4IOCON_PMOD_INDEPENDENT_MODE          ((uint32_t)(_PG4IOCON_PMOD_MASK & ((uint32_t)(1) << _PG4IOCON_PMOD_POSITION)))
+#define PG4IOCON_PMOD_PUSH_PULL_MODE          ((uint32_t)(_PG4IOCON_PMOD_MASK & ((uint32_t)(2) << _PG4IOCON_PMOD_POSITION)))
+#define PG4IOCON_PMOD_RESERVED          ((uint32_t)(_PG4IOCON_PMOD_MASK & ((uint32_t)(3) << _PG4IOCON_PMOD_POSITION)))
+
+//PWM Generator x POLH bit
+#define PG4IOCON_POLH_ACTIVE_HIGH          ((uint32_t)(_PG4IOCON_POLH_MASK & ((uint32_t)(0) << _PG4IOCON_POLH_POSITION)))
+#define PG4IOCON_POLH_ACTIVE_LOW          ((uint32_t)(_PG4IOCON_POLH_MASK & ((uint32_t)(1) << _PG4IOCON_POLH_POSITION)))
+
+//PWM Generator x POLL bit
+#define PG4IOCON_POLL_ACTIVE_HIGH          ((uint32_t)(_PG4IOCON_POLL_MASK & ((uint32_t)(0) << _PG4IOCON_POLL_POSITION)))
+#define PG4IOCON_POLL_ACTIVE_LOW          ((uint32_t)(_PG4IOCON_POLL_MASK & ((uint32_t)(1) << _PG4IOCON_POLL_POSITION)))
+
+//PWM Generator x SWAP bit
+#define PG4IOCON_SWAP_NORMAL_MAPPING          ((uint32_t)(_PG4IOCON_SWAP_MASK & ((uint32_t)(0) << _PG4IOCON_SWAP_POSITION)))
+#define PG4IOCON_SWAP_SWAPPED          ((uint32_t)(_PG4IOCON_SWAP_MASK & ((uint32_t)(1) << _PG4IOCON_SWAP_POSITION)))
+
+#define PG4IOCON_OVRENH_PWM_GENERATOR          ((uint32_t)(_PG4IOCON_OVRENH_MASK & ((uint32_t)(0) << _PG4IOCON_OVRENH_POSITION)))
+#define PG4IOCON_OVRENH_OVRDAT_1          ((uint32_t)(_PG4IOCON_OVRENH_MASK & ((uint32_t)(1) << _PG4IOCON_OVRENH_POSITION)))
+
+//PWM Generator x OVRENL bit
+#define PG4IOCON_OVRENL_PWM_GENERATOR          ((uint32_t)(_PG4IOCON_OVRENL_MASK & ((uint32_t)(0) << _PG4IOCON_OVRENL_POSITION)))
+#define PG4IOCON_OVRENL_OVRDAT_0          ((uint32_t)(_PG4IOCON_OVRENL_MASK & ((uint32_t)(1) << _PG4IOCON_OVRENL_POSITION)))
+
+//PWM Generator x OSYNC[1:0] bits
+#define PG4IOCON_OSYNC_SYNC_TO_LOCAL_PWM_TIMEBASE          ((uint32_t)(_PG4IOCON_OSYNC_MASK & ((uint32_t)(0) << _PG4IOCON_OSYNC_POSITION)))
+#define PG4IOCON_OSYNC_SYNC_IMMEDIATE          ((uint32_t)(_PG4IOCON_OSYNC_MASK & ((uint32_t)(1) << _PG4IOCON_OSYNC_POSITION)))
+#define PG4IOCON_OSYNC_SYNC_TO_UPDMOD          ((uint32_t)(_PG4IOCON_OSYNC_MASK & ((uint32_t)(2) << _PG4IOCON_OSYNC_POSITION)))
+#define PG4IOCON_OSYNC_SYNC_TO_DATA_BUFFER_UPDATE          ((uint32_t)(_PG4IOCON_OSYNC_MASK & ((uint32_t)(3) << _PG4IOCON_OSYNC_POSITION)))
+
+//PGxEVT ADTR2EN3 bit
+#define PG4EVT_ADTR2EN3_DISABLED          ((uint32_t)(_PG4EVT_ADTR2EN3_MASK & ((uint32_t)(0) << _PG4EVT_ADTR2EN3_POSITION)))
+#define PG4EVT_ADTR2EN3_ENABLED          ((uint32_t)(_PG4EVT_ADTR2EN3_MASK & ((uint32_t)(1) << _PG4EVT_ADTR2EN3_POSITION)))
+
+//PGxEVT ADTR2EN2 bit
+#define PG4EVT_ADTR2EN2_DISABLED          ((uint32_t)(_PG4EVT_ADTR2EN2_MASK & ((uint32_t)(0) << _PG4EVT_ADTR2EN2_POSITION)))
+#define PG4EVT_ADTR2EN2_ENABLED          ((uint32_t)(_PG4EVT_ADTR2EN2_MASK & ((uint32_t)(1) << _PG4EVT_ADTR2EN2_POSITION)))
+
+//PGxEVT ADTR2EN1 bit
+#define PG4EVT_ADTR2EN1_DISABLED          ((uint32_t)(_PG4EVT_ADTR2EN1_MASK & ((uint32_t)(0) << _PG4EVT_ADTR2EN1_POSITION)))
+#define PG4EVT_ADTR2EN1_ENABLED          ((uint32_t)(_PG4EVT_ADTR2EN1_MASK & ((uint32_t)(1) << _PG4EVT_ADTR2EN1_POSITION)))
+
+//PGxEVT ADTR1EN3 bit
+#define PG4EVT_ADTR1EN3_DISABLED          ((uint32_t)(_PG4EVT_ADTR1EN3_MASK & ((uint32_t)(0) << _PG4EVT_ADTR1EN3_POSITION)))
+#define PG4EVT_ADTR1EN3_ENABLED          ((uint32_t)(_PG4EVT_ADTR1EN3_MASK & ((uint32_t)(1) << _PG4EVT_ADTR1EN3_POSITION)))
+
+//PGxEVT ADTR1EN2 bit
+#define PG4EVT_ADTR1EN2_DISABLED          ((uint32_t)(_PG4EVT_ADTR1EN2_MASK & ((uint32_t)(0) << _PG4EVT_ADTR1EN2_POSITION)))
+#define PG4EVT_ADTR1EN2_ENABLED          ((uint32_t)(_PG4EVT_ADTR1EN2_MASK & ((uint32_t)(1) << _PG4EVT_ADTR1EN2_POSITION)))
+
+//PGxEVT ADTR1EN1 bit
+#define PG4EVT_ADTR1EN1_DISABLED          ((uint32_t)(_PG4EVT_ADTR1EN1_MASK & ((uint32_t)(0) << _PG4EVT_ADTR1EN1_POSITION)))
+#define PG4EVT_ADTR1EN1_ENABLED          ((uint32_t)(_PG4EVT_ADTR1EN1_MASK & ((uint32_t)(1) << _PG4EVT_ADTR1EN1_POSITION)))
+
+//PGxEVT PWMPCI[2:0] bits
+#define PG4EVT_PWMPCI_PWM_GENERATOR_1          ((uint32_t)(_PG4EVT_PWMPCI_MASK & ((uint32_t)(0) << _PG4EVT_PWMPCI_POSITION)))
+#define PG4EVT_PWMPCI_PWM_GENERATOR_2          ((uint32_t)(_PG4EVT_PWMPCI_MASK & ((uint32_t)(1) << _PG4EVT_PWMPCI_POSITION)))
+#define PG4EVT_PWMPCI_PWM_GENERATOR_3          ((uint32_t)(_PG4EVT_PWMPCI_MASK & ((uint32_t)(2) << _PG4EVT_PWMPCI_POSITION)))
+#define PG4EVT_PWMPCI_PWM_GENERATOR_4          ((uint32_t)(_PG4EVT_PWMPCI_MASK & ((uint32_t)(3) << _PG4EVT_PWMPCI_POSITION)))
+
+//PGxEVT UPDTRG[1:0] bits
+#define PG4EVT_UPDTRG_MANUAL          ((uint32_t)(_PG4EVT_UPDTRG_MASK & ((uint32_t)(0) << _PG4EVT_UPDTRG_POSITION)))
+#define PG4EVT_UPDTRG_PGxDC          ((uint32_t)(_PG4EVT_UPDTRG_MASK & ((uint32_t)(1) << _PG4EVT_UPDTRG_POSITION)))
+#define PG4EVT_UPDTRG_PGxPHASE          ((uint32_t)(_PG4EVT_UPDTRG_MASK & ((uint32_t)(2) << _PG4EVT_UPDTRG_POSITION)))
+#define PG4EVT_UPDTRG_PGxTRIGA          ((uint32_t)(_PG4EVT_UPDTRG_MASK & ((uint32_t)(3) << _PG4EVT_UPDTRG_POSITION)))
+
+//PGxEVT PGTRGSEL[2:0] bits
+#define PG4EVT_PGTRGSEL_EOC          ((uint32_t)(_PG4EVT_PGTRGSEL_MASK & ((uint32_t)(0) << _PG4EVT_PGTRGSEL_POSITION)))
+#define PG4EVT_PGTRGSEL_TRIGA_COMPARE          ((uint32_t)(_PG4EVT_PGTRGSEL_MASK & ((uint32_t)(1) << _PG4EVT_PGTRGSEL_POSITION)))
+#define PG4EVT_PGTRGSEL_TRIGB_COMPARE          ((uint32_t)(_PG4EVT_PGTRGSEL_MASK & ((uint32_t)(2) << _PG4EVT_PGTRGSEL_POSITION)))
+#define PG4EVT_PGTRGSEL_TRIGC_COMPARE          ((uint32_t)(_PG4EVT_PGTRGSEL_MASK & ((uint32_t)(3) << _PG4EVT_PGTRGSEL_POSITION)))
+        
+
+//PWM Clock Divider Selection options
+#define PCLKCON_DIVSEL_1_2          ((uint32_t)(_PCLKCON_DIVSEL_MASK & ((uint32_t)(0) << _PCLKCON_DIVSEL_POSITION))) 
+#define PCLKCON_DIVSEL_1_4          ((uint32_t)(_PCLKCON_DIVSEL_MASK & ((uint32_t)(1) << _PCLKCON_DIVSEL_POSITION))) 
+#define PCLKCON_DIVSEL_1_8          ((uint32_t)(_PCLKCON_DIVSEL_MASK & ((uint32_t)(2) << _PCLKCON_DIVSEL_POSITION))) 
+#define PCLKCON_DIVSEL_1_16          ((uint32_t)(_PCLKCON_DIVSEL_MASK & ((uint32_t)(3) << _PCLKCON_DIVSEL_POSITION))) 
+
+//PWM Master Clock Selection options
+#define PCLKCON_MCLKSEL_UPB_CLOCK           ((uint32_t)(_PCLKCON_MCLKSEL_MASK & ((uint32_t)(0) << _PCLKCON_MCLKSEL_POSITION))) 
+#define PCLKCON_MCLKSEL_CLOCK_GEN_5           ((uint32_t)(_PCLKCON_MCLKSEL_MASK & ((uint32_t)(1) << _PCLKCON_MCLKSEL_POSITION))) 
+
+// Section: File specific functions
+
+volatile static PWM_GEN_OBJ pwmGenObj[PWM_GENERATOR_4];
+
+/* Time base of the interrupt handler duration measurement, none by default */
+static PWM_TIME_BASE_GET pwmTimeBaseGet = NULL;
+static uint32_t pwmTimeBasePeriod = 0U;
+
+/* Data registers of the PWM generators, indexed by genNum - PWM_GENERATOR_1 */
+typedef struct
+{
+    volatile uint32_t* dutyCycle;
+    volatile uint32_t* phase;
+    volatile uint32_t* period;
+    volatile uint32_t* status;
+} PWM_GEN_DATA_REGS;
+
+static const PWM_GEN_DATA_REGS pwmGenDataRegs[PWM_GENERATOR_4] =
+{
+    {&PG1DC, &PG1PHASE, &PG1PER, &PG1STAT},
+    {&PG2DC, &PG2PHASE, &PG2PER, &PG2STAT},
+    {&PG3DC, &PG3PHASE, &PG3PER, &PG3STAT},
+    {&PG4DC, &PG4PHASE, &PG4PER, &PG4STAT},
+};
+
+// Section: PWM Module APIs
+
+void PWM_Initialize (void)
+{
+    uint32_t genIndex;
+
+    PG1CON = (PG1CON_MDCSEL_PGxDC
+            |PG1CON_MPERSEL_PGxPER
+            |PG1CON_MPHSEL_PGxPHASE
+            |PG1CON_MSTEN_ENABLED
+            |PG1CON_UPDMOD_SOC
+            |PG1CON_TRGMOD_SINGLE_TRIGGER_MODE
+            |PG1CON_SOCS_LOCAL_EOC
+            |PG1CON_CLKSEL_MASTER_CLOCK_BY_MCLKSEL
+            |PG1CON_MODSEL_INDEPENDENT_EDGE);
+    
+    PG1IOCON = (PG1IOCON_PMOD_INDEPENDENT_MODE
+            |_PG1IOCON_PPSEN_MASK
+            |_PG1IOCON_PENH_MASK
+            |PG1IOCON_POLH_ACTIVE_HIGH
+            |PG1IOCON_POLL_ACTIVE_HIGH
+            |PG1IOCON_SWAP_NORMAL_MAPPING
+            |PG1IOCON_OVRENH_PWM_GENERATOR
+            |PG1IOCON_OVRENL_PWM_GENERATOR
+            |(uint32_t)0x0 << _PG1IOCON_OVRDAT_POSITION
+            |PG1IOCON_OSYNC_SYNC_TO_LOCAL_PWM_TIMEBASE
+            |(uint32_t)0x0 << _PG1IOCON_FLTDAT_POSITION);
+            
+    PG1EVT = (PG1EVT_ADTR2EN3_DISABLED
+            |PG1EVT_ADTR2EN2_DISABLED
+            |PG1EVT_ADTR2EN1_DISABLED
+            |(uint32_t)0x0 << _PG1EVT_ADTR1OFS_POSITION
+            |(uint32_t)0x0 << _PG1EVT_ADTR1PS_POSITION
+            |PG1EVT_ADTR1EN3_DISABLED
+            |PG1EVT_ADTR1EN2_DISABLED
+            |PG1EVT_ADTR1EN1_DISABLED
+            |PG1EVT_PWMPCI_PWM_GENERATOR_1
+            |PG1EVT_UPDTRG_MANUAL
+            |PG1EVT_PGTRGSEL_EOC);
+            
+    PG1DC = 0x640UL;
+    
+    PG1PER = 0x3e70UL;
+    
+    PG1PHASE = 0x0UL;
+    
+    PG1DT = 0x0UL;
+    
+    PG1FPCI = PG1FPCI_PPS_NON_INVERTED | (uint32_t)0x0 << _PG1FPCI_PSS_POSITION;
+    
+    PG1TRIGA = 0x0UL;
+    
+    PG1TRIGB = 0x0UL;
+    
+    PG1TRIGC = 0x0UL;
+    
+    PG2CON = (PG2CON_MDCSEL_PGxDC
+            |PG2CON_MPERSEL_PGxPER
+            |PG2CON_MPHSEL_PGxPHASE
+            |PG2CON_MSTEN_DISABLED
+            |PG2CON_UPDMOD_CLIENT_SOC
+            |PG2CON_TRGMOD_SINGLE_TRIGGER_MODE
+            |PG2CON_SOCS_LOCAL_EOC
+            |PG2CON_CLKSEL_MASTER_CLOCK_BY_MCLKSEL
+            |PG2CON_MODSEL_INDEPENDENT_EDGE);
+    
+    PG2IOCON = (PG2IOCON_PMOD_INDEPENDENT_MODE
+            |_PG2IOCON_PPSEN_MASK
+            |_PG2IOCON_PENH_MASK
+            |PG2IOCON_POLH_ACTIVE_HIGH
+            |PG2IOCON_POLL_ACTIVE_HIGH
+            |PG2IOCON_SWAP_NORMAL_MAPPING
+            |PG2IOCON_OVRENH_PWM_GENERATOR
+            |PG2IOCON_OVRENL_PWM_GENERATOR
+            |(uint32_t)0x0 << _PG2IOCON_OVRDAT_POSITION
+            |PG2IOCON_OSYNC_SYNC_TO_LOCAL_PWM_TIMEBASE
+            |(uint32_t)0x0 << _PG2IOCON_FLTDAT_POSITION);
+            
+    PG2EVT = (PG2EVT_ADTR2EN3_DISABLED
+            |PG2EVT_ADTR2EN2_DISABLED
+            |PG2EVT_ADTR2EN1_DISABLED
+            |(uint32_t)0x0 << _PG2EVT_ADTR1OFS_POSITION
+            |(uint32_t)0x0 << _PG2EVT_ADTR1PS_POSITION
+            |PG2EVT_ADTR1EN3_DISABLED
+            |PG2EVT_ADTR1EN2_DISABLED
+            |PG2EVT_ADTR1EN1_DISABLED
+            |PG2EVT_PWMPCI_PWM_GENERATOR_1
+            |PG2EVT_UPDTRG_MANUAL
+            |PG2EVT_PGTRGSEL_EOC);
+            
+    PG2DC = 0x640UL;
+    
+    PG2PER = 0x3e70UL;
+    
+    PG2PHASE = 0x0UL;
+    
+    PG2DT = 0x0UL;
+    
+    PG2FPCI = PG2FPCI_PPS_NON_INVERTED | (uint32_t)0x0 << _PG2FPCI_PSS_POSITION;
+    
+    PG2TRIGA = 0x0UL;
+    
+    PG2TRIGB = 0x0UL;
+    
+    PG2TRIGC = 0x0UL;
+    
+    PG3CON = (PG3CON_MDCSEL_PGxDC
+            |PG3CON_MPERSEL_PGxPER
+            |PG3CON_MPHSEL_PGxPHASE
+            |PG3CON_MSTEN_DISABLED
+            |PG3CON_UPDMOD_CLIENT_SOC
+            |PG3CON_TRGMOD_SINGLE_TRIGGER_MODE
+            |PG3CON_SOCS_LOCAL_EOC
+            |PG3CON_CLKSEL_MASTER_CLOCK_BY_MCLKSEL
+            |PG3CON_MODSEL_INDEPENDENT_EDGE);
+    
+    PG3IOCON = (PG3IOCON_PMOD_INDEPENDENT_MODE
+            |_PG3IOCON_PPSEN_MASK
+            |_PG3IOCON_PENH_MASK
+            |PG3IOCON_POLH_ACTIVE_HIGH
+            |PG3IOCON_POLL_ACTIVE_HIGH
+            |PG3IOCON_SWAP_NORMAL_MAPPING
+            |PG3IOCON_OVRENH_PWM_GENERATOR
+            |PG3IOCON_OVRENL_PWM_GENERATOR
+            |(uint32_t)0x0 << _PG3IOCON_OVRDAT_POSITION
+            |PG3IOCON_OSYNC_SYNC_TO_LOCAL_PWM_TIMEBASE
+            |(uint32_t)0x0 << _PG3IOCON_FLTDAT_POSITION);
+            
+    PG3EVT = (PG3EVT_ADTR2EN3_DISABLED
+            |PG3EVT_ADTR2EN2_DISABLED
+            |PG3EVT_ADTR2EN1_DISABLED
+            |(uint32_t)0x0 << _PG3EVT_ADTR1OFS_POSITION
+            |(uint32_t)0x0 << _PG3EVT_ADTR1PS_POSITION
+            |PG3EVT_ADTR1EN3_DISABLED
+            |PG3EVT_ADTR1EN2_DISABLED
+            |PG3EVT_ADTR1EN1_DISABLED
+            |PG3EVT_PWMPCI_PWM_GENERATOR_1
+            |PG3EVT_UPDTRG_MANUAL
+            |PG3EVT_PGTRGSEL_EOC);
+            
+    PG3DC = 0x640UL;
+    
+    PG3PER = 0x3e70UL;
+    
+    PG3PHASE = 0x0UL;
+    
+    PG3DT = 0x0UL;
+    
+    PG3FPCI = PG3FPCI_PPS_NON_INVERTED | (uint32_t)0x0 << _PG3FPCI_PSS_POSITION;
+    
+    PG3TRIGA = 0x0UL;
+    
+    PG3TRIGB = 0x0UL;
+    
+    PG3TRIGC = 0x0UL;
+    
+    PG4CON = (PG4CON_MDCSEL_PGxDC
+            |PG4CON_MPERSEL_PGxPER
+            |PG4CON_MPHSEL_PGxPHASE
+            |PG4CON_MSTEN_DISABLED
+            |PG4CON_UPDMOD_CLIENT_SOC
+            |PG4CON_TRGMOD_SINGLE_TRIGGER_MODE
+            |PG4CON_SOCS_LOCAL_EOC
+            |PG4CON_CLKSEL_MASTER_CLOCK_BY_MCLKSEL
+            |PG4CON_MODSEL_INDEPENDENT_EDGE);
+    
+    PG4IOCON = (PG4IOCON_PMOD_INDEPENDENT_MODE
+            |_PG4IOCON_PPSEN_MASK
+            |_PG4IOCON_PENH_MASK
+            |PG4IOCON_POLH_ACTIVE_HIGH
+            |PG4IOCON_POLL_ACTIVE_HIGH
+            |PG4IOCON_SWAP_NORMAL_MAPPING
+            |PG4IOCON_OVRENH_PWM_GENERATOR
+            |PG4IOCON_OVRENL_PWM_GENERATOR
+            |(uint32_t)0x0 << _PG4IOCON_OVRDAT_POSITION
+            |PG4IOCON_OSYNC_SYNC_TO_LOCAL_PWM_TIMEBASE
+            |(uint32_t)0x0 << _PG4IOCON_FLTDAT_POSITION);
+            
+    PG4EVT = (PG4EVT_ADTR2EN3_DISABLED
+            |PG4EVT_ADTR2EN2_DISABLED
+            |PG4EVT_ADTR2EN1_DISABLED
+            |(uint32_t)0x0 << _PG4EVT_ADTR1OFS_POSITION
+            |(uint32_t)0x0 << _PG4EVT_ADTR1PS_POSITION
+            |PG4EVT_ADTR1EN3_DISABLED
+            |PG4EVT_ADTR1EN2_DISABLED
+            |PG4EVT_ADTR1EN1_DISABLED
+            |PG4EVT_PWMPCI_PWM_GENERATOR_1
+            |PG4EVT_UPDTRG_MANUAL
+            |PG4EVT_PGTRGSEL_EOC);
+            
+    PG4DC = 0x640UL;
+    
+    PG4PER = 0x3e70UL;
+    
+    PG4PHASE = 0x0UL;
+    
+    PG4DT = 0x0UL;
+    
+    PG4FPCI = PG4FPCI_PPS_NON_INVERTED | (uint32_t)0x0 << _PG4FPCI_PSS_POSITION;
+    
+    PG4TRIGA = 0x0UL;
+    
+    PG4TRIGB = 0x0UL;
+    
+    PG4TRIGC = 0x0UL;
+    
+    MDC = 0x0UL;
+    
+    MPER = 0xffff0UL;
+
+    MPHASE = 0x0UL;
+
+    PCLKCON = (PCLKCON_DIVSEL_1_2
+            |PCLKCON_MCLKSEL_UPB_CLOCK);
+    
+    /* Initialize PWM Generator callback objects */
+    for (genIndex = 0U; genIndex < (uint32_t)PWM_GENERATOR_4; genIndex++)
+    {
+        pwmGenObj[genIndex].eocCallback = NULL;
+        pwmGenObj[genIndex].eventCallback = NULL;
+        pwmGenObj[genIndex].interruptEvent = PWM_INTERRUPT_EVENT_EOC;
+        pwmGenObj[genIndex].isrMaxDuration = 0U;
+    }
+
+    IFS1bits.PWM1IF = 0U;
+    IEC1bits.PWM1IE = 1U;
+
+    
+}
+
+void PWM_Deinitialize (void)
+{
+    PG1CONbits.ON = 0U;
+    PG2CONbits.ON = 0U;
+    PG3CONbits.ON = 0U;
+    PG4CONbits.ON = 0U;
+
+    IFS1bits.PWM1IF = 0U;
+    IEC1bits.PWM1IE = 0U;
+    IFS1bits.PWM2IF = 0U;
+    IEC1bits.PWM2IE = 0U;
+    IFS1bits.PWM3IF = 0U;
+    IEC1bits.PWM3IE = 0U;
+    IFS1bits.PWM4IF = 0U;
+    IEC1bits.PWM4IE = 0U;
+
+    MDC = 0x0UL;
+
+    MPER = 0x0UL;
+
+    MPHASE = 0x0UL;
+
+    PCLKCON = 0x0UL;
+
+    PG1CON = 0x0UL;
+    PG1IOCON = 0x0UL;
+    PG1STAT = 0x0UL;
+    PG1EVT = 0x0UL;
+    PG1DC = 0x0UL;
+    PG1PER = 0x0UL;
+    PG1PHASE = 0x0UL;
+    PG1DT = 0x0UL;
+    PG1FPCI = 0x0UL;
+    PG1TRIGA = 0x0UL;
+    PG1TRIGB = 0x0UL;
+    PG1TRIGC = 0x0UL;
+
+    PG2CON = 0x0UL;
+    PG2IOCON = 0x0UL;
+    PG2STAT = 0x0UL;
+    PG2EVT = 0x0UL;
+    PG2DC = 0x0UL;
+    PG2PER = 0x0UL;
+    PG2PHASE = 0x0UL;
+    PG2DT = 0x0UL;
+    PG2FPCI = 0x0UL;
+    PG2TRIGA = 0x0UL;
+    PG2TRIGB = 0x0UL;
+    PG2TRIGC = 0x0UL;
+
+    PG3CON = 0x0UL;
+    PG3IOCON = 0x0UL;
+    PG3STAT = 0x0UL;
+    PG3EVT = 0x0UL;
+    PG3DC = 0x0UL;
+    PG3PER = 0x0UL;
+    PG3PHASE = 0x0UL;
+    PG3DT = 0x0UL;
+    PG3FPCI = 0x0UL;
+    PG3TRIGA = 0x0UL;
+    PG3TRIGB = 0x0UL;
+    PG3TRIGC = 0x0UL;
+
+    PG4CON = 0x0UL;
+    PG4IOCON = 0x0UL;
+    PG4STAT = 0x0UL;
+    PG4EVT = 0x0UL;
+    PG4DC = 0x0UL;
+    PG4PER = 0x0UL;
+    PG4PHASE = 0x0UL;
+    PG4DT = 0x0UL;
+    PG4FPCI = 0x0UL;
+    PG4TRIGA = 0x0UL;
+    PG4TRIGB = 0x0UL;
+    PG4TRIGC = 0x0UL;
+
+
+    
+}
+
+/* PWM generator interrupt is needed while any callback of the generator is registered */
+static void PWM_GeneratorInterruptUpdate(PWM_GENERATOR genNum)
+{
+    volatile PWM_GEN_OBJ* genObj = &pwmGenObj[genNum - PWM_GENERATOR_1];
+    uint8_t enable = ((genObj->eocCallback != NULL) || (genObj->eventCallback != NULL)) ? 1U : 0U;
+
+    switch(genNum) { 
+        case PWM_GENERATOR_1:
+            IEC1bits.PWM1IE = enable;
+            break;
+        case PWM_GENERATOR_2:
+            IEC1bits.PWM2IE = enable;
+            break;
+        case PWM_GENERATOR_3:
+            IEC1bits.PWM3IE = enable;
+            break;
+        case PWM_GENERATOR_4:
+            IEC1bits.PWM4IE = enable;
+            break;
+        default:
+            /* Invalid PWM Generator, do nothing */ 
+            break;
+    }
+}
+
+bool PWM_EOCEventCallbackRegister(
+    PWM_GENERATOR genNum,
+    const PWM_GEN_EOC_EVENT_CALLBACK callback,
+    uintptr_t context
+)
+{
+    bool status = false;
+
+    if ((genNum >= PWM_GENERATOR_1) && (genNum <= PWM_GENERATOR_4))
+    {
+        pwmGenObj[genNum - PWM_GENERATOR_1].eocCallback = callback;
+        pwmGenObj[genNum - PWM_GENERATOR_1].eocContext  = context;
+        PWM_GeneratorInterruptUpdate(genNum);
+        status = true;
+    }
+
+    return status;
+}
+
+bool PWM_GeneratorEventCallbackRegister(
+    PWM_GENERATOR genNum,
+    const PWM_GEN_EVENT_CALLBACK callback,
+    uintptr_t context
+)
+{
+    bool status = false;
+
+    if ((genNum >= PWM_GENERATOR_1) && (genNum <= PWM_GENERATOR_4))
+    {
+        pwmGenObj[genNum - PWM_GENERATOR_1].eventCallback = callback;
+        pwmGenObj[genNum - PWM_GENERATOR_1].eventContext  = context;
+        PWM_GeneratorInterruptUpdate(genNum);
+        status = true;
+    }
+
+    return status;
+}
+
+bool PWM_GeneratorInterruptEventSelect(PWM_GENERATOR genNum, PWM_INTERRUPT_EVENT event)
+{
+    bool status = (event <= PWM_INTERRUPT_EVENT_NONE);
+
+    switch(genNum) { 
+        case PWM_GENERATOR_1:
+            if (status == true)
+            {
+                PG1EVTbits.IEVTSEL = event;
+            }
+            break;
+        case PWM_GENERATOR_2:
+            if (status == true)
+            {
+                PG2EVTbits.IEVTSEL = event;
+            }
+            break;
+        case PWM_GENERATOR_3:
+            if (status == true)
+            {
+                PG3EVTbits.IEVTSEL = event;
+            }
+            break;
+        case PWM_GENERATOR_4:
+            if (status == true)
+            {
+                PG4EVTbits.IEVTSEL = event;
+            }
+            break;
+        default:
+            /* Invalid PWM Generator */
+            status = false;
+            break;
+    }
+
+    if (status == true)
+    {
+        pwmGenObj[genNum - PWM_GENERATOR_1].interruptEvent = event;
+    }
+
+    return status;
+}
+
+uint32_t PWM_ISRMaxDurationGet(PWM_GENERATOR genNum)
+{
+    uint32_t duration = 0U;
+
+    if ((genNum >= PWM_GENERATOR_1) && (genNum <= PWM_GENERATOR_4))
+    {
+        duration = pwmGenObj[genNum - PWM_GENERATOR_1].isrMaxDuration;
+    }
+    return duration;
+}
+
+void PWM_ISRMaxDurationReset(PWM_GENERATOR genNum)
+{
+    if ((genNum >= PWM_GENERATOR_1) && (genNum <= PWM_GENERATOR_4))
+    {
+        pwmGenObj[genNum - PWM_GENERATOR_1].isrMaxDuration = 0U;
+    }
+}
+
+void PWM_ISRTimeBaseSet(PWM_TIME_BASE_GET counterGet, uint32_t counterPeriod)
+{
+    pwmTimeBaseGet = counterGet;
+    pwmTimeBasePeriod = counterPeriod;
+}
+
+static inline uint32_t PWM_TimeBaseRead(void)
+{
+    return (pwmTimeBaseGet != NULL) ? pwmTimeBaseGet() : 0U;
+}
+
+bool PWM_GeneratorsUpdate(const PWM_GENERATOR_UPDATE* updates, uint32_t count, PWM_GENERATOR hostGen)
+{
+    const PWM_GEN_DATA_REGS* regs;
+    uint32_t index;
+    bool status = (hostGen >= PWM_GENERATOR_1) && (hostGen <= PWM_GENERATOR_4);
+
+    for (index = 0U; (index < count) && (status == true); index++)
+    {
+        status = (updates[index].genNum >= PWM_GENERATOR_1) && (updates[index].genNum <= PWM_GENERATOR_4);
+    }
+
+    if (status == true)
+    {
+        /* Do not modify the registers while the previous batch is being applied */
+        status = ((*pwmGenDataRegs[hostGen - PWM_GENERATOR_1].status & _PG1STAT_UPDREQ_MASK) == 0U);
+    }
+
+    if (status == true)
+    {
+        for (index = 0U; index < count; index++)
+        {
+            regs = &pwmGenDataRegs[updates[index].genNum - PWM_GENERATOR_1];
+
+            if ((updates[index].fields & PWM_UPDATE_DUTY_CYCLE) != 0U)
+            {
+                *regs->dutyCycle = updates[index].dutyCycle & 0x000FFFF0UL;
+            }
+            if ((updates[index].fields & PWM_UPDATE_PHASE) != 0U)
+            {
+                *regs->phase = updates[index].phase & 0x000FFFF0UL;
+            }
+            if ((updates[index].fields & PWM_UPDATE_PERIOD) != 0U)
+            {
+                *regs->period = updates[index].period & 0x000FFFF0UL;
+            }
+        }
+
+        *pwmGenDataRegs[hostGen - PWM_GENERATOR_1].status |= _PG1STAT_UPDREQ_MASK;
+    }
+
+    return status;
+}
+
+volatile uint32_t* PWM_DutyCycleAddressGet(PWM_GENERATOR genNum)
+{
+    volatile uint32_t* address = NULL;
+
+    if ((genNum >= PWM_GENERATOR_1) && (genNum <= PWM_GENERATOR_4))
+    {
+        address = pwmGenDataRegs[genNum - PWM_GENERATOR_1].dutyCycle;
+    }
+    return address;
+}
+
+/* PGxSTAT event flags reported to the event callback, in dispatch order */
+static const uint32_t pwmGenEventMask[4] =
+{
+    _PG1STAT_FLTEVT_MASK, _PG1STAT_CLEVT_MASK, _PG1STAT_FFEVT_MASK, _PG1STAT_SEVT_MASK
+};
+
+static const PWM_GENERATOR_INTERRUPT pwmGenEvent[4] =
+{
+    PWM_GENERATOR_INTERRUPT_FAULT, PWM_GENERATOR_INTERRUPT_CURRENT_LIMIT,
+    PWM_GENERATOR_INTERRUPT_FEED_FORWARD, PWM_GENERATOR_INTERRUPT_SYNC
+};
+
+/* Common part of the PWM generator interrupt handlers, called after the interrupt flag is cleared */
+static void PWM_GeneratorEventDispatch(PWM_GENERATOR genNum, uint32_t startTime)
+{
+    volatile PWM_GEN_OBJ* genObj = &pwmGenObj[genNum - PWM_GENERATOR_1];
+    volatile uint32_t* genStatus = pwmGenDataRegs[genNum - PWM_GENERATOR_1].status;
+    uint32_t events;
+    uint32_t duration;
+    uint32_t endTime;
+    uint32_t index;
+
+    events = *genStatus & (_PG1STAT_FLTEVT_MASK | _PG1STAT_CLEVT_MASK | _PG1STAT_FFEVT_MASK | _PG1STAT_SEVT_MASK);
+
+    if (events != 0U)
+    {
+        /* Clear the events before dispatch so that a new event is not lost */
+        *genStatus &= ~events;
+
+        if(genObj->eventCallback != NULL)
+        {
+            for (index = 0U; index < 4U; index++)
+            {
+                if ((events & pwmGenEventMask[index]) != 0U)
+                {
+                    genObj->eventCallback(genNum, pwmGenEvent[index], genObj->eventContext);
+                }
+            }
+        }
+    }
+
+    /* The time base event has no status flag. An interrupt without a pending event
+       is the time base event, and an EOC coinciding with an event must not be lost */
+    switch (genObj->interruptEvent)
+    {
+        case PWM_INTERRUPT_EVENT_EOC:
+            if(genObj->eocCallback != NULL)
+            {
+                genObj->eocCallback(genNum, genObj->eocContext);
+            }
+            break;
+        case PWM_INTERRUPT_EVENT_TRIGGER_A:
+            if ((events == 0U) && (genObj->eventCallback != NULL))
+            {
+                genObj->eventCallback(genNum, PWM_GENERATOR_INTERRUPT_TRIGGER_A, genObj->eventContext);
+            }
+            break;
+        case PWM_INTERRUPT_EVENT_ADC_TRIGGER_1:
+            if ((events == 0U) && (genObj->eventCallback != NULL))
+            {
+                genObj->eventCallback(genNum, PWM_GENERATOR_INTERRUPT_ADC_TRIGGER_1, genObj->eventContext);
+            }
+            break;
+        default:
+            /* No time base event interrupts the CPU */
+            break;
+    }
+
+    if (pwmTimeBaseGet != NULL)
+    {
+        endTime = pwmTimeBaseGet();
+        duration = (endTime >= startTime) ? (endTime - startTime) : ((endTime + pwmTimeBasePeriod + 1U) - startTime);
+        if (duration > genObj->isrMaxDuration)
+        {
+            genObj->isrMaxDuration = duration;
+        }
+    }
+}
+
+/**
+ @brief    Interrupt Handlers for PWM Generators.
+
+ @Note     It is an internal function called from ISR, user should not call it directly.
+ */
+void __attribute__((used)) PWM1_InterruptHandler(void)
+{
+    uint32_t startTime = PWM_TimeBaseRead();
+
+    IFS1bits.PWM1IF = 0U;
+    PWM_GeneratorEventDispatch(PWM_GENERATOR_1, startTime);
+}
+
+void __attribute__((used)) PWM2_InterruptHandler(void)
+{
+    uint32_t startTime = PWM_TimeBaseRead();
+
+    IFS1bits.PWM2IF = 0U;
+    PWM_GeneratorEventDispatch(PWM_GENERATOR_2, startTime);
+}
+
+void __attribute__((used)) PWM3_InterruptHandler(void)
+{
+    uint32_t startTime = PWM_TimeBaseRead();
+
+    IFS1bits.PWM3IF = 0U;
+    PWM_GeneratorEventDispatch(PWM_GENERATOR_3, startTime);
+}
+
+void __attribute__((used)) PWM4_InterruptHandler(void)
+{
+    uint32_t startTime = PWM_TimeBaseRead();
+
+    IFS1bits.PWM4IF = 0U;
+    PWM_GeneratorEventDispatch(PWM_GENERATOR_4, startTime);
+}
+
+
+/**
+ End of File
+*/
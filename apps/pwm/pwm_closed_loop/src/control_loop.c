@@ -0,0 +1,221 @@
+/*******************************************************************************
+  PWM Closed Loop Control Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    control_loop.c
+
+  Summary:
+    Closed loop duty cycle control of a PWM generator from an ADC feedback.
+
+  Description:
+    The compensator runs in the ADC1 channel 0 interrupt and writes the
+    duty cycle used from the next PWM cycle. Its timing is measured with the
+    time base set by CONTROL_LOOP_TimeBaseSet.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// Section: Included Files
+
+#include <stddef.h>
+#include "control_loop.h"
+#include "compensator.h"
+#include "control_loop_tuning.h"
+
+// Section: Configuration
+
+/* Set to 1 to use the 2P2Z compensator instead of the PI compensator */
+#define CONTROL_LOOP_USE_2P2Z   (0)
+
+/* 2P2Z coefficients, b0 b1 b2 and a1 a2 */
+static const int32_t loopB[3] = CONTROL_LOOP_2P2Z_B;
+static const int32_t loopA[2] = CONTROL_LOOP_2P2Z_A;
+
+// Section: Local Objects
+
+static PWM_GENERATOR loopGenerator = PWM_GENERATOR_1;
+static volatile int32_t loopReference = 0;
+static volatile CONTROL_LOOP_TIMING loopTiming;
+static uint32_t loopLastSampleTime = 0U;
+static bool loopFirstSample = true;
+
+/* Time base of the timing measurement, none by default */
+static PWM_TIME_BASE_GET loopTimeBaseGet = NULL;
+static uint32_t loopTimeBasePeriod = 0U;
+
+#if (CONTROL_LOOP_USE_2P2Z == 1)
+static COMPENSATOR_2P2Z loopCompensator;
+#else
+static COMPENSATOR_PI loopCompensator;
+#endif
+
+// Section: Local Functions
+
+static inline uint32_t CONTROL_LOOP_TimeBaseRead(void)
+{
+    return (loopTimeBaseGet != NULL) ? loopTimeBaseGet() : 0U;
+}
+
+/* The time base counts from 0 to loopTimeBasePeriod, a single roll-over is accounted for */
+static uint32_t CONTROL_LOOP_Elapsed(uint32_t startTime, uint32_t endTime)
+{
+    return (endTime >= startTime) ? (endTime - startTime) : ((endTime + loopTimeBasePeriod + 1U) - startTime);
+}
+
+static void CONTROL_LOOP_TimingClear(void)
+{
+    loopTiming.execLast = 0U;
+    loopTiming.execMax = 0U;
+    loopTiming.intervalMin = UINT32_MAX;
+    loopTiming.intervalMax = 0U;
+    loopTiming.samples = 0U;
+    loopFirstSample = true;
+}
+
+/* This function is called from the ADC1 channel 0 interrupt after each conversion */
+static void CONTROL_LOOP_ADCHandler(uint32_t result, uintptr_t context)
+{
+    uint32_t startTime = CONTROL_LOOP_TimeBaseRead();
+    uint32_t interval;
+    int32_t dutyCycle;
+
+    if (loopFirstSample == false)
+    {
+        interval = CONTROL_LOOP_Elapsed(loopLastSampleTime, startTime);
+        if (interval < loopTiming.intervalMin)
+        {
+            loopTiming.intervalMin = interval;
+        }
+        if (interval > loopTiming.intervalMax)
+        {
+            loopTiming.intervalMax = interval;
+        }
+    }
+    loopFirstSample = false;
+    loopLastSampleTime = startTime;
+
+#if (CONTROL_LOOP_USE_2P2Z == 1)
+    dutyCycle = COMPENSATOR_2P2ZUpdate(&loopCompensator, loopReference - (int32_t)result);
+#else
+    dutyCycle = COMPENSATOR_PIUpdate(&loopCompensator, loopReference - (int32_t)result);
+#endif
+
+    /* The duty cycle is applied at the start of the next PWM cycle */
+    PWM_DutyCycleSet(loopGenerator, (uint32_t)dutyCycle);
+    PWM_SoftwareUpdateRequest(loopGenerator);
+
+    loopTiming.execLast = CONTROL_LOOP_Elapsed(startTime, CONTROL_LOOP_TimeBaseRead());
+    if (loopTiming.execLast > loopTiming.execMax)
+    {
+        loopTiming.execMax = loopTiming.execLast;
+    }
+    loopTiming.samples++;
+}
+
+// Section: Control Loop Implementation
+
+void CONTROL_LOOP_Start(PWM_GENERATOR genNum, uint32_t triggerPoint, uint32_t reference)
+{
+    ADC1_PWM_INSTANCE pwmInstance = (ADC1_PWM_INSTANCE)((uint32_t)ADC1_PWM1 + ((uint32_t)genNum - (uint32_t)PWM_GENERATOR_1));
+
+    loopGenerator = genNum;
+    loopReference = (int32_t)reference;
+
+#if (CONTROL_LOOP_USE_2P2Z == 1)
+    COMPENSATOR_2P2ZInitialize(&loopCompensator, loopB, loopA, CONTROL_LOOP_SHIFT, CONTROL_LOOP_DUTY_MIN, CONTROL_LOOP_DUTY_MAX);
+#else
+    COMPENSATOR_PIInitialize(&loopCompensator, CONTROL_LOOP_KP, CONTROL_LOOP_KI, CONTROL_LOOP_SHIFT, CONTROL_LOOP_DUTY_MIN, CONTROL_LOOP_DUTY_MAX);
+#endif
+
+    CONTROL_LOOP_TimingClear();
+
+    ADC1_ChannelCallbackRegister(ADC1_CHANNEL0, CONTROL_LOOP_ADCHandler, (uintptr_t)NULL);
+    ADC1_PWMTriggerSourceSet(ADC1_CHANNEL0, pwmInstance, ADC_PWM_TRIGGER_1);
+
+    PWM_TriggerACompareValueSet(genNum, triggerPoint);
+    PWM_ADCTrigger1Enable(genNum, PWM_TRIGGER_COMPARE_A);
+}
+
+void CONTROL_LOOP_TimeBaseSet(PWM_TIME_BASE_GET counterGet, uint32_t counterPeriod)
+{
+    bool interruptState = (_AD1CH0IE != 0U);
+
+    _AD1CH0IE = 0U;
+
+    loopTimeBaseGet = counterGet;
+    loopTimeBasePeriod = counterPeriod;
+    CONTROL_LOOP_TimingClear();
+
+    if (interruptState)
+    {
+        _AD1CH0IE = 1U;
+    }
+}
+
+void CONTROL_LOOP_Stop(void)
+{
+    PWM_ADCTrigger1Disable(loopGenerator, PWM_TRIGGER_COMPARE_A);
+    ADC1_ChannelCallbackRegister(ADC1_CHANNEL0, NULL, (uintptr_t)NULL);
+}
+
+void CONTROL_LOOP_ReferenceSet(uint32_t reference)
+{
+    loopReference = (int32_t)reference;
+}
+
+void CONTROL_LOOP_TimingGet(CONTROL_LOOP_TIMING* timing)
+{
+    bool interruptState = (_AD1CH0IE != 0U);
+
+    /* The ADC interrupt updates the timing, hold it off while the copy is made */
+    _AD1CH0IE = 0U;
+
+    timing->execLast = loopTiming.execLast;
+    timing->execMax = loopTiming.execMax;
+    timing->intervalMin = loopTiming.intervalMin;
+    timing->intervalMax = loopTiming.intervalMax;
+    timing->samples = loopTiming.samples;
+
+    if (interruptState)
+    {
+        _AD1CH0IE = 1U;
+    }
+}
+
+void CONTROL_LOOP_TimingReset(void)
+{
+    bool interruptState = (_AD1CH0IE != 0U);
+
+    _AD1CH0IE = 0U;
+
+    CONTROL_LOOP_TimingClear();
+
+    if (interruptState)
+    {
+        _AD1CH0IE = 1U;
+    }
+}
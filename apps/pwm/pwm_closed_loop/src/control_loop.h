@@ -0,0 +1,147 @@
+/*******************************************************************************
+  PWM Closed Loop Control Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    control_loop.h
+
+  Summary:
+    Closed loop duty cycle control of a PWM generator from an ADC feedback.
+
+  Description:
+    A trigger compare match of the PWM generator starts the ADC1 channel 0
+    conversion. The ADC channel callback runs a fixed point compensator on
+    the result and writes the next duty cycle of the generator. The execution
+    time of the callback and the interval between two samples are measured
+    with Timer 1.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef CONTROL_LOOP_H
+#define CONTROL_LOOP_H
+
+// Section: Included Files
+
+#include <stdint.h>
+#include "definitions.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// Section: Data Types
+
+/**
+ @struct   CONTROL_LOOP_TIMING
+ @brief    Timing of the control loop in counts of the time base set by
+           \ref CONTROL_LOOP_TimeBaseSet, 0 while no time base is set
+*/
+typedef struct
+{
+    /* Execution time of the last compensator run */
+    uint32_t                execLast;
+
+    /* Longest execution time of the compensator */
+    uint32_t                execMax;
+
+    /* Shortest and longest interval between two samples, the difference is the sampling jitter */
+    uint32_t                intervalMin;
+
+    uint32_t                intervalMax;
+
+    /* Number of samples processed */
+    uint32_t                samples;
+
+} CONTROL_LOOP_TIMING;
+
+// Section: Interface Functions
+
+/**
+ * @brief      Starts the closed loop control of a PWM generator duty cycle.
+ * @details    The trigger A compare match of the generator drives its ADC trigger 1
+ *             output, which is selected as the trigger source of ADC1 channel 0.
+ *             The ADC1 channel 0 callback is owned by the control loop while it runs.
+ * @param[in]  genNum       - PWM generator number, PWM_GENERATOR_1 to PWM_GENERATOR_4
+ * @param[in]  triggerPoint - Trigger A compare value in count, sampling point in the PWM cycle
+ * @param[in]  reference    - Regulation target in ADC counts
+ * @return     none
+ * @remarks    The timing is only measured while a time base is set with
+ *             \ref CONTROL_LOOP_TimeBaseSet.
+ */
+void CONTROL_LOOP_Start(PWM_GENERATOR genNum, uint32_t triggerPoint, uint32_t reference);
+
+/**
+ * @brief      Sets the time base of the control loop timing measurement.
+ * @details    The counter must count up from 0 to counterPeriod and roll over to 0,
+ *             as for \ref PWM_ISRTimeBaseSet. A free running timer with its interrupt
+ *             disabled is sufficient, it must be started by the application.
+ *             The timing is cleared.
+ * @param[in]  counterGet    - Function returning the counter, NULL stops the measurement
+ * @param[in]  counterPeriod - Last count before the counter rolls over
+ * @return     none
+ */
+void CONTROL_LOOP_TimeBaseSet(PWM_TIME_BASE_GET counterGet, uint32_t counterPeriod);
+
+/**
+ * @brief      Stops the closed loop control and releases the ADC1 channel 0 callback.
+ * @return     none
+ */
+void CONTROL_LOOP_Stop(void);
+
+/**
+ * @brief      Sets the regulation target of the control loop.
+ * @param[in]  reference - Regulation target in ADC counts
+ * @return     none
+ */
+void CONTROL_LOOP_ReferenceSet(uint32_t reference);
+
+/**
+ * @brief      Gets a consistent copy of the control loop timing.
+ * @param[out] timing - Timing of the control loop
+ * @return     none
+ */
+void CONTROL_LOOP_TimingGet(CONTROL_LOOP_TIMING* timing);
+
+/**
+ * @brief      Clears the control loop timing.
+ * @return     none
+ */
+void CONTROL_LOOP_TimingReset(void);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif // CONTROL_LOOP_H
@@ -0,0 +1,61 @@
+/*******************************************************************************
+  PWM Closed Loop Tuning Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    control_loop_tuning.h
+
+  Summary:
+    Duty cycle limits, gains and coefficients of the closed loop compensator.
+
+  Description:
+    The tuning has no device dependency, it is shared by control_loop.c and
+    the host simulation of the loop in pwm_closed_loop_simulator.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef CONTROL_LOOP_TUNING_H
+#define CONTROL_LOOP_TUNING_H
+
+// Section: Tuning
+
+/* Duty cycle limits in PWM counts, for the 100kHz period of the demo */
+#define CONTROL_LOOP_DUTY_MIN   (160)
+#define CONTROL_LOOP_DUTY_MAX   (14400)
+
+/* Number of fractional bits of the gains and coefficients */
+#define CONTROL_LOOP_SHIFT      (12U)
+
+/* PI gains, kp = 2.0 and ki = 0.25 per sample */
+#define CONTROL_LOOP_KP         (8192)
+#define CONTROL_LOOP_KI         (1024)
+
+/* 2P2Z coefficients, b0 b1 b2 and a1 a2 */
+#define CONTROL_LOOP_2P2Z_B     {10240, -4096, -2048}
+#define CONTROL_LOOP_2P2Z_A     {4096, 0}
+
+#endif // CONTROL_LOOP_TUNING_H
@@ -0,0 +1,96 @@
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+/*******************************************************************************
+  Main Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    main.c
+
+  Summary:
+    This file contains the "main" function for a project.
+
+  Description:
+    This file contains the "main" function for a project.  The
+    "main" function calls the "SYS_Initialize" function to initialize the state
+    machines of all modules in the system
+ *******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stddef.h>                     // Defines NULL
+#include <stdbool.h>                    // Defines true
+#include <stdlib.h>                     // Defines EXIT_FAILURE
+#include "definitions.h"                // SYS function prototypes
+#include "control_loop.h"               // Closed loop duty cycle control
+
+/***************************************
+ * PWM Generator 1 output PWM1H - RC3 drives an RC filter,
+ * the filter output is measured by ADC1 channel 0
+ ***************************************/
+
+/* Sampling point in the PWM cycle and regulation target (1.65V) of the closed loop */
+#define CONTROL_TRIGGER_POINT   (0x1F30U)
+#define CONTROL_REFERENCE       (2048U)
+
+int main ( void )
+{
+    /* Initialize all modules */
+    SYS_Initialize ( NULL );
+
+    /* The loop runs from the ADC interrupt, the PWM generator interrupt is not needed */
+    (void)PWM_GeneratorInterruptEventSelect(PWM_GENERATOR_1, PWM_INTERRUPT_EVENT_NONE);
+
+    /* Timer 1 runs free with its interrupt disabled as the time base of the loop timing */
+    TMR1_InterruptDisable();
+    CONTROL_LOOP_TimeBaseSet(TMR1_CounterGet, TMR1_PeriodGet());
+    TMR1_Start();
+
+    /* PWM Generator 1 triggers the ADC, the compensator writes the next duty cycle
+       from the ADC interrupt, see CONTROL_LOOP_TimingGet for the loop timing */
+    CONTROL_LOOP_Start(PWM_GENERATOR_1, CONTROL_TRIGGER_POINT, CONTROL_REFERENCE);
+
+    /* Start all synchronous channels by starting generator 1*/
+    PWM_Enable();
+
+    while ( true )
+    {
+        /* Maintain state machines of all polled MPLAB Harmony modules. */
+        SYS_Tasks ( );
+    }
+
+    /* Execution should not come here during normal operation */
+
+    return ( EXIT_FAILURE );
+}
+
+
+/*******************************************************************************
+ End of File
+*/
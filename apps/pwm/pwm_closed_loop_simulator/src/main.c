@@ -0,0 +1,307 @@
+/*******************************************************************************
+  PWM Closed Loop Simulator Main Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    main.c
+
+  Summary:
+    Runs the closed loop compensators of the PWM demo against a plant model.
+
+  Description:
+    Builds compensator.c and the tuning of the pwm_closed_loop
+    application for the build host. Both the PI and the 2P2Z compensator run
+    against an RC filter model of the PWM output, with the one PWM cycle delay
+    of the duty cycle update. Each scenario prints its settling time, overshoot,
+    steady state error and ripple, and the exit status tells whether all the
+    scenarios passed.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/* clock_gettime */
+#define _POSIX_C_SOURCE 199309L
+
+// Section: Included Files
+
+#include <stddef.h>                     // Defines NULL
+#include <stdbool.h>                    // Defines true
+#include <stdlib.h>                     // Defines EXIT_FAILURE
+#include <stdio.h>
+#include <time.h>
+#include "compensator.h"
+#include "control_loop_tuning.h"
+#include "plant.h"
+
+// Section: Main Entry Point
+
+/* PWM period and ADC trigger point of the demo, 100kHz */
+#define APP_PWM_PERIOD                  (0x3E70U)
+#define APP_TRIGGER_POINT               (0x1F30U)
+#define APP_CYCLE_TIME                  (10.0e-6)
+
+/* Regulation target of the demo (1.65V) and second set point */
+#define APP_REFERENCE                   (2048)
+#define APP_REFERENCE_STEP              (3000)
+
+/* Set point above the highest output allowed by CONTROL_LOOP_DUTY_MAX */
+#define APP_REFERENCE_UNREACHABLE       (4000)
+
+/* Cycles run per scenario, and cycles at the end used for the steady state */
+#define APP_SCENARIO_CYCLES             (5000U)
+#define APP_STEADY_CYCLES               (500U)
+
+/* Pass limits: settling time, error band, steady state error and ripple */
+#define APP_SETTLE_LIMIT_CYCLES         (2000U)
+#define APP_SETTLE_BAND                 (20)
+#define APP_ERROR_LIMIT                 (2.0)
+#define APP_RIPPLE_LIMIT                (8U)
+
+#define APP_NS_PER_SECOND               (1000000000ULL)
+
+typedef enum
+{
+    APP_COMPENSATOR_PI,
+    APP_COMPENSATOR_2P2Z,
+
+} APP_COMPENSATOR;
+
+typedef struct
+{
+    uint32_t        settleCycles;
+    int32_t         overshoot;
+    double          error;
+    uint32_t        ripple;
+
+} APP_RESULT;
+
+/* RC filter of 1ms on the PWM1H output, ADC1 with a 3.3V reference */
+static const PLANT_CONFIG plantConfig =
+{
+    .period             = APP_PWM_PERIOD,
+    .triggerPoint       = APP_TRIGGER_POINT,
+    .cycleTime          = APP_CYCLE_TIME,
+    .timeConstant       = 1.0e-3,
+    .outputVoltage      = 3.3,
+    .referenceVoltage   = 3.3,
+    .adcFullScale       = 4095U,
+};
+
+static const int32_t loopB[3] = CONTROL_LOOP_2P2Z_B;
+static const int32_t loopA[2] = CONTROL_LOOP_2P2Z_A;
+
+static APP_COMPENSATOR compensatorType;
+static COMPENSATOR_PI piCompensator;
+static COMPENSATOR_2P2Z compensator2P2Z;
+
+static PLANT plant;
+static uint32_t dutyCycle;
+static uint64_t updateNs;
+static uint32_t updates;
+static uint32_t failures;
+
+static uint64_t APP_TimeNs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * APP_NS_PER_SECOND) + (uint64_t)now.tv_nsec;
+}
+
+/* Same initialization as CONTROL_LOOP_Start */
+static void APP_Setup(APP_COMPENSATOR type)
+{
+    compensatorType = type;
+
+    if (type == APP_COMPENSATOR_2P2Z)
+    {
+        COMPENSATOR_2P2ZInitialize(&compensator2P2Z, loopB, loopA, CONTROL_LOOP_SHIFT, CONTROL_LOOP_DUTY_MIN, CONTROL_LOOP_DUTY_MAX);
+    }
+    else
+    {
+        COMPENSATOR_PIInitialize(&piCompensator, CONTROL_LOOP_KP, CONTROL_LOOP_KI, CONTROL_LOOP_SHIFT, CONTROL_LOOP_DUTY_MIN, CONTROL_LOOP_DUTY_MAX);
+    }
+
+    PLANT_Initialize(&plant, &plantConfig);
+    dutyCycle = (uint32_t)CONTROL_LOOP_DUTY_MIN;
+}
+
+/* One PWM cycle. The result converted in the cycle sets the duty cycle of the
+   next one, as the ADC interrupt of the demo does with an update request. */
+static uint32_t APP_CycleRun(int32_t reference)
+{
+    uint32_t result = PLANT_CycleRun(&plant, dutyCycle);
+    uint64_t startTime = APP_TimeNs();
+    int32_t output;
+
+    if (compensatorType == APP_COMPENSATOR_2P2Z)
+    {
+        output = COMPENSATOR_2P2ZUpdate(&compensator2P2Z, reference - (int32_t)result);
+    }
+    else
+    {
+        output = COMPENSATOR_PIUpdate(&piCompensator, reference - (int32_t)result);
+    }
+
+    updateNs += APP_TimeNs() - startTime;
+    updates++;
+
+    dutyCycle = (uint32_t)output;
+
+    return result;
+}
+
+/* Runs the loop from the current state to a new reference and measures the response */
+static APP_RESULT APP_Response(int32_t reference, int32_t previous)
+{
+    APP_RESULT result = { 0U, 0, 0.0, 0U };
+    uint32_t cycle;
+    uint32_t sample;
+    uint32_t steadyMin = UINT32_MAX;
+    uint32_t steadyMax = 0U;
+    int64_t errorSum = 0;
+    int32_t peak = 0;
+    int32_t deviation;
+    bool rising = (reference >= previous);
+
+    result.settleCycles = UINT32_MAX;
+
+    for (cycle = 0U; cycle < APP_SCENARIO_CYCLES; cycle++)
+    {
+        sample = APP_CycleRun(reference);
+        deviation = (int32_t)sample - reference;
+
+        /* Settled from the first cycle after which the result stays in the band */
+        if ((deviation > APP_SETTLE_BAND) || (deviation < -APP_SETTLE_BAND))
+        {
+            result.settleCycles = UINT32_MAX;
+        }
+        else if (result.settleCycles == UINT32_MAX)
+        {
+            result.settleCycles = cycle;
+        }
+        else
+        {
+            /* Still in the band */
+        }
+
+        if ((rising && (deviation > peak)) || ((!rising) && (-deviation > peak)))
+        {
+            peak = rising ? deviation : -deviation;
+        }
+
+        if (cycle >= (APP_SCENARIO_CYCLES - APP_STEADY_CYCLES))
+        {
+            errorSum += deviation;
+            steadyMin = (sample < steadyMin) ? sample : steadyMin;
+            steadyMax = (sample > steadyMax) ? sample : steadyMax;
+        }
+    }
+
+    result.overshoot = peak;
+    result.error = (double)errorSum / (double)APP_STEADY_CYCLES;
+    result.ripple = steadyMax - steadyMin;
+
+    return result;
+}
+
+static void APP_Report(const char* name, const APP_RESULT* result)
+{
+    bool passed = (result->settleCycles <= APP_SETTLE_LIMIT_CYCLES) &&
+                  (result->error <= APP_ERROR_LIMIT) && (result->error >= -APP_ERROR_LIMIT) &&
+                  (result->ripple <= APP_RIPPLE_LIMIT);
+
+    if (result->settleCycles == UINT32_MAX)
+    {
+        printf("%-34s %-4s %8s %8s %8.2f %6u\n", name, passed ? "ok" : "FAIL",
+               "never", "-", result->error, result->ripple);
+    }
+    else
+    {
+        printf("%-34s %-4s %8.2f %8d %8.2f %6u\n", name, passed ? "ok" : "FAIL",
+               (double)result->settleCycles * APP_CYCLE_TIME * 1000.0, result->overshoot, result->error, result->ripple);
+    }
+
+    if (!passed)
+    {
+        failures++;
+    }
+}
+
+static void APP_CompensatorRun(APP_COMPENSATOR type, const char* name)
+{
+    APP_RESULT result;
+    APP_RESULT reference;
+    char label[64];
+
+    APP_Setup(type);
+    result = APP_Response(APP_REFERENCE, 0);
+    (void)snprintf(label, sizeof(label), "%s start to %d", name, APP_REFERENCE);
+    APP_Report(label, &result);
+
+    result = APP_Response(APP_REFERENCE_STEP, APP_REFERENCE);
+    (void)snprintf(label, sizeof(label), "%s step %d to %d", name, APP_REFERENCE, APP_REFERENCE_STEP);
+    APP_Report(label, &result);
+
+    reference = APP_Response(APP_REFERENCE, APP_REFERENCE_STEP);
+    (void)snprintf(label, sizeof(label), "%s step %d to %d", name, APP_REFERENCE_STEP, APP_REFERENCE);
+    APP_Report(label, &reference);
+
+    /* Supply drop of 10% on the PWM output */
+    PLANT_OutputVoltageSet(&plant, plantConfig.outputVoltage * 0.9);
+    result = APP_Response(APP_REFERENCE, APP_REFERENCE + APP_SETTLE_BAND + 1);
+    (void)snprintf(label, sizeof(label), "%s supply -10%%", name);
+    APP_Report(label, &result);
+    PLANT_OutputVoltageSet(&plant, plantConfig.outputVoltage);
+    (void)APP_Response(APP_REFERENCE, APP_REFERENCE);
+
+    /* The output saturates for the whole scenario, the recovery afterwards must
+       not take much longer than the same step without saturation (anti-windup) */
+    (void)APP_Response(APP_REFERENCE_UNREACHABLE, APP_REFERENCE);
+    result = APP_Response(APP_REFERENCE, APP_REFERENCE_UNREACHABLE);
+    if ((reference.settleCycles != UINT32_MAX) && (result.settleCycles > ((reference.settleCycles * 3U) / 2U) + 50U))
+    {
+        result.settleCycles = UINT32_MAX;
+    }
+    (void)snprintf(label, sizeof(label), "%s saturated, back to %d", name, APP_REFERENCE);
+    APP_Report(label, &result);
+}
+
+int main ( void )
+{
+    printf("PWM period %u counts, trigger %u, RC %.1f ms, band +/-%d LSB\n\n",
+           APP_PWM_PERIOD, APP_TRIGGER_POINT, plantConfig.timeConstant * 1000.0, APP_SETTLE_BAND);
+    printf("%-34s %-4s %8s %8s %8s %6s\n", "scenario", "", "settle ms", "over", "error", "ripple");
+
+    APP_CompensatorRun(APP_COMPENSATOR_PI, "PI");
+    APP_CompensatorRun(APP_COMPENSATOR_2P2Z, "2P2Z");
+
+    printf("\n%.1f ns per compensator update on the build host\n", (updates != 0U) ? (double)updateNs / (double)updates : 0.0);
+    printf("%u scenario(s) failed\n", failures);
+
+    return (failures == 0U) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
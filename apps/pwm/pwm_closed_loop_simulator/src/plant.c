@@ -0,0 +1,113 @@
+/*******************************************************************************
+  PWM Closed Loop Plant Model Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    plant.c
+
+  Summary:
+    Model of the PWM output filter and ADC sampled by the closed loop.
+
+  Description:
+    The RC filter is integrated exactly over each segment of the PWM cycle,
+    the ADC result is the rounded capacitor voltage at the trigger point.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// Section: Included Files
+
+#include <math.h>
+#include "plant.h"
+
+// Section: Local Functions
+
+/* Capacitor voltage after time seconds of charge towards target */
+static double PLANT_Settle(const PLANT* plant, double target, double time)
+{
+    return target + ((plant->capacitorVoltage - target) * exp(-time / plant->config.timeConstant));
+}
+
+/* Runs the filter from start to end counts of the cycle */
+static void PLANT_SegmentRun(PLANT* plant, uint32_t dutyCycle, uint32_t start, uint32_t end)
+{
+    double countTime = plant->config.cycleTime / (double)plant->config.period;
+    uint32_t onEnd = (dutyCycle < end) ? dutyCycle : end;
+
+    if (start < onEnd)
+    {
+        plant->capacitorVoltage = PLANT_Settle(plant, plant->outputVoltage, (double)(onEnd - start) * countTime);
+        start = onEnd;
+    }
+    if (start < end)
+    {
+        plant->capacitorVoltage = PLANT_Settle(plant, 0.0, (double)(end - start) * countTime);
+    }
+}
+
+// Section: Plant Model Implementation
+
+void PLANT_Initialize(PLANT* plant, const PLANT_CONFIG* config)
+{
+    plant->config = *config;
+    plant->outputVoltage = config->outputVoltage;
+    plant->capacitorVoltage = 0.0;
+}
+
+void PLANT_OutputVoltageSet(PLANT* plant, double voltage)
+{
+    plant->outputVoltage = voltage;
+}
+
+uint32_t PLANT_CycleRun(PLANT* plant, uint32_t dutyCycle)
+{
+    double code;
+
+    if (dutyCycle > plant->config.period)
+    {
+        dutyCycle = plant->config.period;
+    }
+
+    PLANT_SegmentRun(plant, dutyCycle, 0U, plant->config.triggerPoint);
+
+    code = floor(((plant->capacitorVoltage * (double)(plant->config.adcFullScale + 1U)) / plant->config.referenceVoltage) + 0.5);
+    if (code < 0.0)
+    {
+        code = 0.0;
+    }
+    else if (code > (double)plant->config.adcFullScale)
+    {
+        code = (double)plant->config.adcFullScale;
+    }
+    else
+    {
+        /* Within the ADC range */
+    }
+
+    PLANT_SegmentRun(plant, dutyCycle, plant->config.triggerPoint, plant->config.period);
+
+    return (uint32_t)code;
+}
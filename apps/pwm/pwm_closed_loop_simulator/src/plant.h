@@ -0,0 +1,133 @@
+/*******************************************************************************
+  PWM Closed Loop Plant Model Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    plant.h
+
+  Summary:
+    Model of the PWM output filter and ADC sampled by the closed loop.
+
+  Description:
+    The PWM Generator 1 output drives an RC low pass filter whose output is
+    converted by ADC1 channel 0 at the trigger point of each PWM cycle. The
+    model integrates the filter exactly over the on and off time of each
+    cycle, so the sampled value includes the PWM ripple.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef PLANT_H
+#define PLANT_H
+
+// Section: Included Files
+
+#include <stdint.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// Section: Data Types
+
+/**
+ @struct   PLANT_CONFIG
+ @brief    Parameters of the PWM output filter and of the ADC.
+*/
+typedef struct
+{
+    /* PWM period and ADC trigger point in PWM counts */
+    uint32_t        period;
+    uint32_t        triggerPoint;
+
+    /* PWM cycle in seconds */
+    double          cycleTime;
+
+    /* RC filter time constant in seconds */
+    double          timeConstant;
+
+    /* PWM output high level and ADC reference in volts */
+    double          outputVoltage;
+    double          referenceVoltage;
+
+    /* ADC full scale code */
+    uint32_t        adcFullScale;
+
+} PLANT_CONFIG;
+
+/**
+ @struct   PLANT
+ @brief    State of the plant model.
+*/
+typedef struct
+{
+    PLANT_CONFIG    config;
+
+    double          outputVoltage;
+
+    double          capacitorVoltage;
+
+} PLANT;
+
+// Section: Interface Functions
+
+/**
+ * @brief      Initializes the plant with a discharged filter.
+ * @param[in]  plant - Plant model
+ * @param[in]  config - Filter and ADC parameters
+ * @return     none
+ */
+void PLANT_Initialize(PLANT* plant, const PLANT_CONFIG* config);
+
+/**
+ * @brief      Changes the PWM output high level, for a supply disturbance.
+ * @param[in]  plant - Plant model
+ * @param[in]  voltage - New output high level in volts
+ * @return     none
+ */
+void PLANT_OutputVoltageSet(PLANT* plant, double voltage);
+
+/**
+ * @brief      Runs one PWM cycle.
+ * @param[in]  plant - Plant model
+ * @param[in]  dutyCycle - Duty cycle of the cycle in PWM counts
+ * @return     ADC result converted at the trigger point of the cycle
+ */
+uint32_t PLANT_CycleRun(PLANT* plant, uint32_t dutyCycle);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif // PLANT_H
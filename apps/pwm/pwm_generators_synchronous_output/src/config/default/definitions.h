@@ -51,7 +51,9 @@
 #include "peripheral/clk/plib_clk.h"
 #include "peripheral/gpio/plib_gpio.h"
 #include "peripheral/intc/plib_intc.h"
+#include "peripheral/dma/plib_dma.h"
 #include "peripheral/pwm/plib_pwm.h"
+#include "peripheral/tmr/plib_tmr1.h"
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
@@ -63,15 +63,45 @@
 // Section: System Interrupt Vector declarations
 
 
+void _DMA0Interrupt (void);
 void _PWM1Interrupt (void);
+void _PWM2Interrupt (void);
+void _PWM3Interrupt (void);
+void _PWM4Interrupt (void);
+void _T1Interrupt (void);
 
 // Section: System Interrupt Vector definitions
 
+void __attribute__ (( interrupt, no_auto_psv)) _DMA0Interrupt (void)
+{
+    DMA0_InterruptHandler();
+}
+
 void __attribute__ (( interrupt, no_auto_psv)) _PWM1Interrupt (void)
 {
     PWM1_InterruptHandler();
 }
 
+void __attribute__ (( interrupt, no_auto_psv)) _PWM2Interrupt (void)
+{
+    PWM2_InterruptHandler();
+}
+
+void __attribute__ (( interrupt, no_auto_psv)) _PWM3Interrupt (void)
+{
+    PWM3_InterruptHandler();
+}
+
+void __attribute__ (( interrupt, no_auto_psv)) _PWM4Interrupt (void)
+{
+    PWM4_InterruptHandler();
+}
+
+void __attribute__ (( interrupt, no_auto_psv)) _T1Interrupt (void)
+{
+    T1_InterruptHandler();
+}
+
 
 
 
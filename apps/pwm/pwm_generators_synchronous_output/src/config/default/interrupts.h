@@ -56,7 +56,12 @@
 // Section: Handler Routines
 // *****************************************************************************
 // *****************************************************************************
+void DMA0_InterruptHandler( void );
 void PWM1_InterruptHandler( void );
+void PWM2_InterruptHandler( void );
+void PWM3_InterruptHandler( void );
+void PWM4_InterruptHandler( void );
+void T1_InterruptHandler( void );
 
 
 
@@ -557,12 +557,35 @@
 
 // Section: File specific functions
 
-volatile static PWM_GEN_EOC_EVENT_CALLBACK_OBJ pwmGen1CbObj;
+volatile static PWM_GEN_OBJ pwmGenObj[PWM_GENERATOR_4];
+
+/* Time base of the interrupt handler duration measurement, none by default */
+static PWM_TIME_BASE_GET pwmTimeBaseGet = NULL;
+static uint32_t pwmTimeBasePeriod = 0U;
+
+/* Data registers of the PWM generators, indexed by genNum - PWM_GENERATOR_1 */
+typedef struct
+{
+    volatile uint32_t* dutyCycle;
+    volatile uint32_t* phase;
+    volatile uint32_t* period;
+    volatile uint32_t* status;
+} PWM_GEN_DATA_REGS;
+
+static const PWM_GEN_DATA_REGS pwmGenDataRegs[PWM_GENERATOR_4] =
+{
+    {&PG1DC, &PG1PHASE, &PG1PER, &PG1STAT},
+    {&PG2DC, &PG2PHASE, &PG2PER, &PG2STAT},
+    {&PG3DC, &PG3PHASE, &PG3PER, &PG3STAT},
+    {&PG4DC, &PG4PHASE, &PG4PER, &PG4STAT},
+};
 
 // Section: PWM Module APIs
 
 void PWM_Initialize (void)
 {
+    uint32_t genIndex;
+
     PG1CON = (PG1CON_MDCSEL_PGxDC
             |PG1CON_MPERSEL_PGxPER
             |PG1CON_MPHSEL_PGxPHASE
@@ -772,8 +795,14 @@ void PWM_Initialize (void)
     PCLKCON = (PCLKCON_DIVSEL_1_2
             |PCLKCON_MCLKSEL_UPB_CLOCK);
     
-    /* Initialize PWM Generator 1 EOC Event callback object */
-    pwmGen1CbObj.callback = NULL;
+    /* Initialize PWM Generator callback objects */
+    for (genIndex = 0U; genIndex < (uint32_t)PWM_GENERATOR_4; genIndex++)
+    {
+        pwmGenObj[genIndex].eocCallback = NULL;
+        pwmGenObj[genIndex].eventCallback = NULL;
+        pwmGenObj[genIndex].interruptEvent = PWM_INTERRUPT_EVENT_EOC;
+        pwmGenObj[genIndex].isrMaxDuration = 0U;
+    }
 
     IFS1bits.PWM1IF = 0U;
     IEC1bits.PWM1IE = 1U;
@@ -790,6 +819,12 @@ void PWM_Deinitialize (void)
 
     IFS1bits.PWM1IF = 0U;
     IEC1bits.PWM1IE = 0U;
+    IFS1bits.PWM2IF = 0U;
+    IEC1bits.PWM2IE = 0U;
+    IFS1bits.PWM3IF = 0U;
+    IEC1bits.PWM3IE = 0U;
+    IFS1bits.PWM4IF = 0U;
+    IEC1bits.PWM4IE = 0U;
 
     MDC = 0x0UL;
 
@@ -855,42 +890,310 @@ void PWM_Deinitialize (void)
     
 }
 
+/* PWM generator interrupt is needed while any callback of the generator is registered */
+static void PWM_GeneratorInterruptUpdate(PWM_GENERATOR genNum)
+{
+    volatile PWM_GEN_OBJ* genObj = &pwmGenObj[genNum - PWM_GENERATOR_1];
+    uint8_t enable = ((genObj->eocCallback != NULL) || (genObj->eventCallback != NULL)) ? 1U : 0U;
+
+    switch(genNum) { 
+        case PWM_GENERATOR_1:
+            IEC1bits.PWM1IE = enable;
+            break;
+        case PWM_GENERATOR_2:
+            IEC1bits.PWM2IE = enable;
+            break;
+        case PWM_GENERATOR_3:
+            IEC1bits.PWM3IE = enable;
+            break;
+        case PWM_GENERATOR_4:
+            IEC1bits.PWM4IE = enable;
+            break;
+        default:
+            /* Invalid PWM Generator, do nothing */ 
+            break;
+    }
+}
+
 bool PWM_EOCEventCallbackRegister(
     PWM_GENERATOR genNum,
     const PWM_GEN_EOC_EVENT_CALLBACK callback,
     uintptr_t context
 )
 {
-    bool status = true;
+    bool status = false;
+
+    if ((genNum >= PWM_GENERATOR_1) && (genNum <= PWM_GENERATOR_4))
+    {
+        pwmGenObj[genNum - PWM_GENERATOR_1].eocCallback = callback;
+        pwmGenObj[genNum - PWM_GENERATOR_1].eocContext  = context;
+        PWM_GeneratorInterruptUpdate(genNum);
+        status = true;
+    }
+
+    return status;
+}
+
+bool PWM_GeneratorEventCallbackRegister(
+    PWM_GENERATOR genNum,
+    const PWM_GEN_EVENT_CALLBACK callback,
+    uintptr_t context
+)
+{
+    bool status = false;
+
+    if ((genNum >= PWM_GENERATOR_1) && (genNum <= PWM_GENERATOR_4))
+    {
+        pwmGenObj[genNum - PWM_GENERATOR_1].eventCallback = callback;
+        pwmGenObj[genNum - PWM_GENERATOR_1].eventContext  = context;
+        PWM_GeneratorInterruptUpdate(genNum);
+        status = true;
+    }
+
+    return status;
+}
+
+bool PWM_GeneratorInterruptEventSelect(PWM_GENERATOR genNum, PWM_INTERRUPT_EVENT event)
+{
+    bool status = (event <= PWM_INTERRUPT_EVENT_NONE);
+
     switch(genNum) { 
         case PWM_GENERATOR_1:
-            pwmGen1CbObj.callback = callback;
-            pwmGen1CbObj.context  = context;
+            if (status == true)
+            {
+                PG1EVTbits.IEVTSEL = event;
+            }
+            break;
+        case PWM_GENERATOR_2:
+            if (status == true)
+            {
+                PG2EVTbits.IEVTSEL = event;
+            }
+            break;
+        case PWM_GENERATOR_3:
+            if (status == true)
+            {
+                PG3EVTbits.IEVTSEL = event;
+            }
+            break;
+        case PWM_GENERATOR_4:
+            if (status == true)
+            {
+                PG4EVTbits.IEVTSEL = event;
+            }
             break;
         default:
+            /* Invalid PWM Generator */
             status = false;
             break;
+    }
+
+    if (status == true)
+    {
+        pwmGenObj[genNum - PWM_GENERATOR_1].interruptEvent = event;
+    }
+
+    return status;
+}
+
+uint32_t PWM_ISRMaxDurationGet(PWM_GENERATOR genNum)
+{
+    uint32_t duration = 0U;
+
+    if ((genNum >= PWM_GENERATOR_1) && (genNum <= PWM_GENERATOR_4))
+    {
+        duration = pwmGenObj[genNum - PWM_GENERATOR_1].isrMaxDuration;
+    }
+    return duration;
+}
+
+void PWM_ISRMaxDurationReset(PWM_GENERATOR genNum)
+{
+    if ((genNum >= PWM_GENERATOR_1) && (genNum <= PWM_GENERATOR_4))
+    {
+        pwmGenObj[genNum - PWM_GENERATOR_1].isrMaxDuration = 0U;
+    }
+}
+
+void PWM_ISRTimeBaseSet(PWM_TIME_BASE_GET counterGet, uint32_t counterPeriod)
+{
+    pwmTimeBaseGet = counterGet;
+    pwmTimeBasePeriod = counterPeriod;
+}
+
+static inline uint32_t PWM_TimeBaseRead(void)
+{
+    return (pwmTimeBaseGet != NULL) ? pwmTimeBaseGet() : 0U;
+}
+
+bool PWM_GeneratorsUpdate(const PWM_GENERATOR_UPDATE* updates, uint32_t count, PWM_GENERATOR hostGen)
+{
+    const PWM_GEN_DATA_REGS* regs;
+    uint32_t index;
+    bool status = (hostGen >= PWM_GENERATOR_1) && (hostGen <= PWM_GENERATOR_4);
+
+    for (index = 0U; (index < count) && (status == true); index++)
+    {
+        status = (updates[index].genNum >= PWM_GENERATOR_1) && (updates[index].genNum <= PWM_GENERATOR_4);
+    }
+
+    if (status == true)
+    {
+        /* Do not modify the registers while the previous batch is being applied */
+        status = ((*pwmGenDataRegs[hostGen - PWM_GENERATOR_1].status & _PG1STAT_UPDREQ_MASK) == 0U);
+    }
+
+    if (status == true)
+    {
+        for (index = 0U; index < count; index++)
+        {
+            regs = &pwmGenDataRegs[updates[index].genNum - PWM_GENERATOR_1];
+
+            if ((updates[index].fields & PWM_UPDATE_DUTY_CYCLE) != 0U)
+            {
+                *regs->dutyCycle = updates[index].dutyCycle & 0x000FFFF0UL;
+            }
+            if ((updates[index].fields & PWM_UPDATE_PHASE) != 0U)
+            {
+                *regs->phase = updates[index].phase & 0x000FFFF0UL;
+            }
+            if ((updates[index].fields & PWM_UPDATE_PERIOD) != 0U)
+            {
+                *regs->period = updates[index].period & 0x000FFFF0UL;
+            }
         }
 
+        *pwmGenDataRegs[hostGen - PWM_GENERATOR_1].status |= _PG1STAT_UPDREQ_MASK;
+    }
+
     return status;
 }
 
+volatile uint32_t* PWM_DutyCycleAddressGet(PWM_GENERATOR genNum)
+{
+    volatile uint32_t* address = NULL;
+
+    if ((genNum >= PWM_GENERATOR_1) && (genNum <= PWM_GENERATOR_4))
+    {
+        address = pwmGenDataRegs[genNum - PWM_GENERATOR_1].dutyCycle;
+    }
+    return address;
+}
+
+/* PGxSTAT event flags reported to the event callback, in dispatch order */
+static const uint32_t pwmGenEventMask[4] =
+{
+    _PG1STAT_FLTEVT_MASK, _PG1STAT_CLEVT_MASK, _PG1STAT_FFEVT_MASK, _PG1STAT_SEVT_MASK
+};
+
+static const PWM_GENERATOR_INTERRUPT pwmGenEvent[4] =
+{
+    PWM_GENERATOR_INTERRUPT_FAULT, PWM_GENERATOR_INTERRUPT_CURRENT_LIMIT,
+    PWM_GENERATOR_INTERRUPT_FEED_FORWARD, PWM_GENERATOR_INTERRUPT_SYNC
+};
+
+/* Common part of the PWM generator interrupt handlers, called after the interrupt flag is cleared */
+static void PWM_GeneratorEventDispatch(PWM_GENERATOR genNum, uint32_t startTime)
+{
+    volatile PWM_GEN_OBJ* genObj = &pwmGenObj[genNum - PWM_GENERATOR_1];
+    volatile uint32_t* genStatus = pwmGenDataRegs[genNum - PWM_GENERATOR_1].status;
+    uint32_t events;
+    uint32_t duration;
+    uint32_t endTime;
+    uint32_t index;
+
+    events = *genStatus & (_PG1STAT_FLTEVT_MASK | _PG1STAT_CLEVT_MASK | _PG1STAT_FFEVT_MASK | _PG1STAT_SEVT_MASK);
+
+    if (events != 0U)
+    {
+        /* Clear the events before dispatch so that a new event is not lost */
+        *genStatus &= ~events;
+
+        if(genObj->eventCallback != NULL)
+        {
+            for (index = 0U; index < 4U; index++)
+            {
+                if ((events & pwmGenEventMask[index]) != 0U)
+                {
+                    genObj->eventCallback(genNum, pwmGenEvent[index], genObj->eventContext);
+                }
+            }
+        }
+    }
+
+    /* The time base event has no status flag. An interrupt without a pending event
+       is the time base event, and an EOC coinciding with an event must not be lost */
+    switch (genObj->interruptEvent)
+    {
+        case PWM_INTERRUPT_EVENT_EOC:
+            if(genObj->eocCallback != NULL)
+            {
+                genObj->eocCallback(genNum, genObj->eocContext);
+            }
+            break;
+        case PWM_INTERRUPT_EVENT_TRIGGER_A:
+            if ((events == 0U) && (genObj->eventCallback != NULL))
+            {
+                genObj->eventCallback(genNum, PWM_GENERATOR_INTERRUPT_TRIGGER_A, genObj->eventContext);
+            }
+            break;
+        case PWM_INTERRUPT_EVENT_ADC_TRIGGER_1:
+            if ((events == 0U) && (genObj->eventCallback != NULL))
+            {
+                genObj->eventCallback(genNum, PWM_GENERATOR_INTERRUPT_ADC_TRIGGER_1, genObj->eventContext);
+            }
+            break;
+        default:
+            /* No time base event interrupts the CPU */
+            break;
+    }
+
+    if (pwmTimeBaseGet != NULL)
+    {
+        endTime = pwmTimeBaseGet();
+        duration = (endTime >= startTime) ? (endTime - startTime) : ((endTime + pwmTimeBasePeriod + 1U) - startTime);
+        if (duration > genObj->isrMaxDuration)
+        {
+            genObj->isrMaxDuration = duration;
+        }
+    }
+}
+
 /**
- @brief    Interrupt Handler for PWM Generator 1.
+ @brief    Interrupt Handlers for PWM Generators.
 
  @Note     It is an internal function called from ISR, user should not call it directly.
  */
 void __attribute__((used)) PWM1_InterruptHandler(void)
 {
-    PWM_GENERATOR intGen = PWM_GENERATOR_1;
-    uintptr_t context_var;
-    if(pwmGen1CbObj.callback != NULL)
-    {
-        context_var = pwmGen1CbObj.context;
-        pwmGen1CbObj.callback (intGen, context_var);
-    }
-    
+    uint32_t startTime = PWM_TimeBaseRead();
+
     IFS1bits.PWM1IF = 0U;
+    PWM_GeneratorEventDispatch(PWM_GENERATOR_1, startTime);
+}
+
+void __attribute__((used)) PWM2_InterruptHandler(void)
+{
+    uint32_t startTime = PWM_TimeBaseRead();
+
+    IFS1bits.PWM2IF = 0U;
+    PWM_GeneratorEventDispatch(PWM_GENERATOR_2, startTime);
+}
+
+void __attribute__((used)) PWM3_InterruptHandler(void)
+{
+    uint32_t startTime = PWM_TimeBaseRead();
+
+    IFS1bits.PWM3IF = 0U;
+    PWM_GeneratorEventDispatch(PWM_GENERATOR_3, startTime);
+}
+
+void __attribute__((used)) PWM4_InterruptHandler(void)
+{
+    uint32_t startTime = PWM_TimeBaseRead();
+
+    IFS1bits.PWM4IF = 0U;
+    PWM_GeneratorEventDispatch(PWM_GENERATOR_4, startTime);
 }
 
 
@@ -80,9 +80,25 @@ typedef uint32_t PWM_GENERATOR;
 #define    PWM_GENERATOR_INTERRUPT_CURRENT_LIMIT   2U      /**< PWM Generator Current Limit Interrupt */
 #define    PWM_GENERATOR_INTERRUPT_FEED_FORWARD    3U      /**< PWM Generator Feed Forward Interrupt */
 #define    PWM_GENERATOR_INTERRUPT_SYNC            4U      /**< PWM Generator Sync Interrupt */
+#define    PWM_GENERATOR_INTERRUPT_TRIGGER_A       5U      /**< PWM Generator Trigger A Compare Interrupt */
+#define    PWM_GENERATOR_INTERRUPT_ADC_TRIGGER_1   6U      /**< PWM Generator ADC Trigger 1 Interrupt */
 
 typedef uint32_t PWM_GENERATOR_INTERRUPT;
 
+/**
+ @brief    Defines the time base event that interrupts the CPU, selected with
+           \ref PWM_GeneratorInterruptEventSelect.
+ @details  The PWM generator interrupts the CPU at one time base event, in addition to
+           the fault, current limit, feed forward and sync events. The Trigger B and
+           Trigger C compare events cannot interrupt the CPU.
+*/
+#define    PWM_INTERRUPT_EVENT_EOC                 0U      /**< Interrupt at the end of the PWM cycle */
+#define    PWM_INTERRUPT_EVENT_TRIGGER_A           1U      /**< Interrupt at the Trigger A compare event */
+#define    PWM_INTERRUPT_EVENT_ADC_TRIGGER_1       2U      /**< Interrupt at the ADC Trigger 1 event */
+#define    PWM_INTERRUPT_EVENT_NONE                3U      /**< No time base event interrupts the CPU */
+
+typedef uint32_t PWM_INTERRUPT_EVENT;
+
 /**
  @brief    Defines the PWM generator Trigger Compare registers 
            that are available for the module to use.
@@ -137,6 +153,16 @@ typedef uint32_t PWM_OUTPUT_MODES;
 
 typedef uint32_t PWM_SOURCE_SELECT;
 
+/**
+ * @brief    Defines the events that set the update request of a PWM generator.
+ */
+#define    PWM_UPDATE_TRIGGER_MANUAL        0U         /**< Update requested by software only */
+#define    PWM_UPDATE_TRIGGER_DUTY_CYCLE    1U         /**< Write to the duty cycle register requests the update */
+#define    PWM_UPDATE_TRIGGER_PHASE         2U         /**< Write to the phase register requests the update */
+#define    PWM_UPDATE_TRIGGER_TRIGA         3U         /**< Write to the trigger A register requests the update */
+
+typedef uint32_t PWM_UPDATE_TRIGGER;
+
 /**
  * @brief    Callback function type for  PWM generator End of Conversion (EOC) event.
  * 
@@ -175,6 +201,71 @@ typedef struct
     
 }PWM_GEN_EOC_EVENT_CALLBACK_OBJ;
 
+/**
+ * @brief    Callback function type for PWM generator fault, current limit, feed forward,
+ *           sync (PCI trigger), Trigger A compare and ADC Trigger 1 events.
+ * @details  The callback is called once for each event enabled with
+ *           \ref PWM_GeneratorInterruptEnable that is pending when the PWM generator
+ *           interrupt is serviced. The event status is cleared before the callback is called.
+ *           The Trigger A compare and ADC Trigger 1 events are reported when they are
+ *           selected with \ref PWM_GeneratorInterruptEventSelect.
+ */
+typedef  void (*PWM_GEN_EVENT_CALLBACK) (PWM_GENERATOR genNum, PWM_GENERATOR_INTERRUPT interrupt, uintptr_t context);
+
+/**
+ * @brief    Function type returning the counter of the time base of the interrupt
+ *           handler duration measurement, for example TMR1_CounterGet.
+ */
+typedef  uint32_t (*PWM_TIME_BASE_GET) (void);
+
+// /cond IGNORE_THIS
+// Section: Local Objects **** Do Not Use ****
+
+typedef struct
+{
+    PWM_GEN_EOC_EVENT_CALLBACK          eocCallback;
+
+    uintptr_t                           eocContext;
+
+    PWM_GEN_EVENT_CALLBACK              eventCallback;
+
+    uintptr_t                           eventContext;
+
+    PWM_INTERRUPT_EVENT                 interruptEvent;
+
+    uint32_t                            isrMaxDuration;
+
+}PWM_GEN_OBJ;
+
+// /endcond
+
+/**
+ * @brief    Data registers written by \ref PWM_GeneratorsUpdate.
+ */
+#define    PWM_UPDATE_DUTY_CYCLE    0x1U        /**< Write the duty cycle */
+#define    PWM_UPDATE_PHASE         0x2U        /**< Write the phase */
+#define    PWM_UPDATE_PERIOD        0x4U        /**< Write the period */
+
+typedef uint32_t PWM_UPDATE_FIELDS;
+
+/**
+ @struct   PWM_GENERATOR_UPDATE
+ @brief    New data register values of one PWM generator, written by \ref PWM_GeneratorsUpdate.
+*/
+typedef struct
+{
+    PWM_GENERATOR                       genNum;
+
+    PWM_UPDATE_FIELDS                   fields;
+
+    uint32_t                            dutyCycle;
+
+    uint32_t                            phase;
+
+    uint32_t                            period;
+
+}PWM_GENERATOR_UPDATE;
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: PWM Peripheral APIs
@@ -1417,6 +1508,233 @@ inline static void PWM_TriggerCCompareValueSet(PWM_GENERATOR genNum,uint32_t tri
 }
 
 
+/**
+ * @brief      This inline function makes a trigger compare match of a PWM generator drive its ADC trigger 1 output.
+ * @details    The trigger compare value is set with \ref PWM_TriggerACompareValueSet,
+ *             \ref PWM_TriggerBCompareValueSet or \ref PWM_TriggerCCompareValueSet. The
+ *             ADC selects the PWM generator ADC trigger 1 as the trigger source of a
+ *             channel with ADC1_PWMTriggerSourceSet.
+ * @param[in]  genNum  - PWM generator number
+ * @param[in]  compare - Trigger compare register
+ * @return     none  
+ */
+inline static void PWM_ADCTrigger1Enable(PWM_GENERATOR genNum, PWM_TRIGGER_COMPARE compare)
+{
+    switch(genNum) { 
+        case PWM_GENERATOR_1:
+                switch(compare) { 
+                        case PWM_TRIGGER_COMPARE_A:
+                                        PG1EVTbits.ADTR1EN1 = 1U;
+                                        break;
+                        case PWM_TRIGGER_COMPARE_B:
+                                        PG1EVTbits.ADTR1EN2 = 1U;
+                                        break;
+                        case PWM_TRIGGER_COMPARE_C:
+                                        PG1EVTbits.ADTR1EN3 = 1U;
+                                        break;
+                        default:
+                            /* Invalid trigger compare register, do nothing */  
+                            break;  
+                }
+                break;   
+        case PWM_GENERATOR_2:
+                switch(compare) { 
+                        case PWM_TRIGGER_COMPARE_A:
+                                        PG2EVTbits.ADTR1EN1 = 1U;
+                                        break;
+                        case PWM_TRIGGER_COMPARE_B:
+                                        PG2EVTbits.ADTR1EN2 = 1U;
+                                        break;
+                        case PWM_TRIGGER_COMPARE_C:
+                                        PG2EVTbits.ADTR1EN3 = 1U;
+                                        break;
+                        default:
+                            /* Invalid trigger compare register, do nothing */  
+                            break;  
+                }
+                break;   
+        case PWM_GENERATOR_3:
+                switch(compare) { 
+                        case PWM_TRIGGER_COMPARE_A:
+                                        PG3EVTbits.ADTR1EN1 = 1U;
+                                        break;
+                        case PWM_TRIGGER_COMPARE_B:
+                                        PG3EVTbits.ADTR1EN2 = 1U;
+                                        break;
+                        case PWM_TRIGGER_COMPARE_C:
+                                        PG3EVTbits.ADTR1EN3 = 1U;
+                                        break;
+                        default:
+                            /* Invalid trigger compare register, do nothing */  
+                            break;  
+                }
+                break;   
+        case PWM_GENERATOR_4:
+                switch(compare) { 
+                        case PWM_TRIGGER_COMPARE_A:
+                                        PG4EVTbits.ADTR1EN1 = 1U;
+                                        break;
+                        case PWM_TRIGGER_COMPARE_B:
+                                        PG4EVTbits.ADTR1EN2 = 1U;
+                                        break;
+                        case PWM_TRIGGER_COMPARE_C:
+                                        PG4EVTbits.ADTR1EN3 = 1U;
+                                        break;
+                        default:
+                            /* Invalid trigger compare register, do nothing */  
+                            break;  
+                }
+                break;   
+        default:
+            /* Invalid PWM Generator, do nothing */ 
+            break;
+    }
+}
+
+/**
+ * @brief      This inline function stops a trigger compare match of a PWM generator from driving its ADC trigger 1 output.
+ * @details    The trigger compare value is set with \ref PWM_TriggerACompareValueSet,
+ *             \ref PWM_TriggerBCompareValueSet or \ref PWM_TriggerCCompareValueSet. The
+ *             ADC selects the PWM generator ADC trigger 1 as the trigger source of a
+ *             channel with ADC1_PWMTriggerSourceSet.
+ * @param[in]  genNum  - PWM generator number
+ * @param[in]  compare - Trigger compare register
+ * @return     none  
+ */
+inline static void PWM_ADCTrigger1Disable(PWM_GENERATOR genNum, PWM_TRIGGER_COMPARE compare)
+{
+    switch(genNum) { 
+        case PWM_GENERATOR_1:
+                switch(compare) { 
+                        case PWM_TRIGGER_COMPARE_A:
+                                        PG1EVTbits.ADTR1EN1 = 0U;
+                                        break;
+                        case PWM_TRIGGER_COMPARE_B:
+                                        PG1EVTbits.ADTR1EN2 = 0U;
+                                        break;
+                        case PWM_TRIGGER_COMPARE_C:
+                                        PG1EVTbits.ADTR1EN3 = 0U;
+                                        break;
+                        default:
+                            /* Invalid trigger compare register, do nothing */  
+                            break;  
+                }
+                break;   
+        case PWM_GENERATOR_2:
+                switch(compare) { 
+                        case PWM_TRIGGER_COMPARE_A:
+                                        PG2EVTbits.ADTR1EN1 = 0U;
+                                        break;
+                        case PWM_TRIGGER_COMPARE_B:
+                                        PG2EVTbits.ADTR1EN2 = 0U;
+                                        break;
+                        case PWM_TRIGGER_COMPARE_C:
+                                        PG2EVTbits.ADTR1EN3 = 0U;
+                                        break;
+                        default:
+                            /* Invalid trigger compare register, do nothing */  
+                            break;  
+                }
+                break;   
+        case PWM_GENERATOR_3:
+                switch(compare) { 
+                        case PWM_TRIGGER_COMPARE_A:
+                                        PG3EVTbits.ADTR1EN1 = 0U;
+                                        break;
+                        case PWM_TRIGGER_COMPARE_B:
+                                        PG3EVTbits.ADTR1EN2 = 0U;
+                                        break;
+                        case PWM_TRIGGER_COMPARE_C:
+                                        PG3EVTbits.ADTR1EN3 = 0U;
+                                        break;
+                        default:
+                            /* Invalid trigger compare register, do nothing */  
+                            break;  
+                }
+                break;   
+        case PWM_GENERATOR_4:
+                switch(compare) { 
+                        case PWM_TRIGGER_COMPARE_A:
+                                        PG4EVTbits.ADTR1EN1 = 0U;
+                                        break;
+                        case PWM_TRIGGER_COMPARE_B:
+                                        PG4EVTbits.ADTR1EN2 = 0U;
+                                        break;
+                        case PWM_TRIGGER_COMPARE_C:
+                                        PG4EVTbits.ADTR1EN3 = 0U;
+                                        break;
+                        default:
+                            /* Invalid trigger compare register, do nothing */  
+                            break;  
+                }
+                break;   
+        default:
+            /* Invalid PWM Generator, do nothing */ 
+            break;
+    }
+}
+
+/**
+ * @brief      Selects the register write that requests the update of a PWM generator.
+ * @details    With \ref PWM_UPDATE_TRIGGER_DUTY_CYCLE, a write to the duty cycle register
+ *             applies the new duty cycle at the next start of cycle without a software
+ *             update request. This allows the duty cycle register to be written by DMA.
+ * @param[in]  genNum  - PWM generator number
+ * @param[in]  trigger - Update trigger
+ * @return     none
+ * @remarks    none
+ */
+inline static void PWM_UpdateTriggerSet(PWM_GENERATOR genNum, PWM_UPDATE_TRIGGER trigger)
+{
+    switch(genNum) { 
+        case PWM_GENERATOR_1:
+                PG1EVTbits.UPDTRG = (uint8_t)trigger;
+                break;
+        case PWM_GENERATOR_2:
+                PG2EVTbits.UPDTRG = (uint8_t)trigger;
+                break;
+        case PWM_GENERATOR_3:
+                PG3EVTbits.UPDTRG = (uint8_t)trigger;
+                break;
+        case PWM_GENERATOR_4:
+                PG4EVTbits.UPDTRG = (uint8_t)trigger;
+                break;
+        default:
+            /* Invalid PWM Generator, do nothing */ 
+            break;
+    }
+}
+
+/**
+ * @brief      Returns the address of the duty cycle register of a PWM generator.
+ * @details    The address can be used as the destination of a DMA transfer that plays
+ *             back a table of duty cycle values. The table entries must be formatted
+ *             as written by \ref PWM_DutyCycleSet (the four least significant bits
+ *             are not used).
+ * @param[in]  genNum - PWM generator number
+ * @return     Address of the duty cycle register, NULL for an invalid generator
+ * @remarks    none
+ */
+volatile uint32_t* PWM_DutyCycleAddressGet(PWM_GENERATOR genNum);
+
+/**
+ * @brief      Writes the data registers of several PWM generators and commits them with
+ *             one update request.
+ * @details    The duty cycle, phase and period registers selected by the fields of each
+ *             entry are written through a constant register table, without a switch per
+ *             register. The update request is then set on the host generator only, so
+ *             all the client generators configured to update with the host (client SOC
+ *             update mode) apply their new values in the same PWM cycle.
+ * @param[in]  updates - Array of generator updates
+ * @param[in]  count   - Number of entries in updates
+ * @param[in]  hostGen - Generator whose update request commits the batch
+ * @return     true  - The registers are written and the update is requested
+ * @return     false - An entry selects an invalid generator, or the previous update
+ *                     of the host generator is still pending. No register is written.
+ * @remarks    This function can be called from the EOC callback of the host generator.
+ */
+bool PWM_GeneratorsUpdate(const PWM_GENERATOR_UPDATE* updates, uint32_t count, PWM_GENERATOR hostGen);
+
 /**
  * @brief Registers a callback function for PWM EOC event.
  *
@@ -1442,12 +1760,87 @@ inline static void PWM_TriggerCCompareValueSet(PWM_GENERATOR genNum,uint32_t tri
  *
  * @return None.
  *
- * @remarks None.
+ * @remarks The callback is only called while the EOC is selected with
+ *          \ref PWM_GeneratorInterruptEventSelect, which is the case after initialization.
  */
 bool PWM_EOCEventCallbackRegister(
     PWM_GENERATOR genNum,
     const PWM_GEN_EOC_EVENT_CALLBACK callback,
     uintptr_t context );
 
+/**
+ * @brief      Registers a callback function for the fault, current limit, feed forward
+ *             and sync events of a PWM generator.
+ * @details    The events are enabled with \ref PWM_GeneratorInterruptEnable. The event
+ *             status is cleared before the callback is called, so an event that occurs
+ *             while the callback runs is not lost.
+ * @pre        The `PWM_Initialize()` function must have been called.
+ * @param[in]  genNum   - PWM generator number
+ * @param[in]  callback - Pointer to the callback function, NULL disables the callback
+ * @param[in]  context  - A value (usually a pointer) passed into the callback function
+ * @return     true  - Callback is registered
+ * @return     false - Invalid PWM generator
+ * @remarks    The PWM generator interrupt is enabled while an EOC or event callback is registered.
+ *             The time base event selected with \ref PWM_GeneratorInterruptEventSelect has
+ *             no status flag. An interrupt without a pending fault, current limit, feed
+ *             forward or sync event is reported as the selected time base event. An interrupt
+ *             with a pending event is also reported as an EOC when the EOC is selected, so that
+ *             an EOC coinciding with an event is not lost, but not as a Trigger A or ADC
+ *             Trigger 1 event. The events are reported to the event callback first.
+ */
+bool PWM_GeneratorEventCallbackRegister(
+    PWM_GENERATOR genNum,
+    const PWM_GEN_EVENT_CALLBACK callback,
+    uintptr_t context );
+
+/**
+ * @brief      Selects the time base event that interrupts the CPU for a PWM generator.
+ * @details    The EOC is reported to the EOC callback, the Trigger A compare and ADC
+ *             Trigger 1 events are reported to the event callback as
+ *             \ref PWM_GENERATOR_INTERRUPT_TRIGGER_A and \ref PWM_GENERATOR_INTERRUPT_ADC_TRIGGER_1.
+ *             The Trigger B and Trigger C compare events cannot interrupt the CPU, use
+ *             them to trigger the ADC instead.
+ * @pre        The `PWM_Initialize()` function must have been called.
+ * @param[in]  genNum - PWM generator number
+ * @param[in]  event  - Time base event, PWM_INTERRUPT_EVENT_EOC after initialization
+ * @return     true  - Event is selected
+ * @return     false - Invalid PWM generator or event
+ * @remarks    none
+ */
+bool PWM_GeneratorInterruptEventSelect(PWM_GENERATOR genNum, PWM_INTERRUPT_EVENT event);
+
+/**
+ * @brief      Returns the longest execution time of the interrupt handler of a PWM generator.
+ * @details    The time is measured from the entry of the handler to the return of the
+ *             callbacks, with the time base set by \ref PWM_ISRTimeBaseSet.
+ * @param[in]  genNum - PWM generator number
+ * @return     Worst case duration in time base counts, 0 for an invalid PWM generator
+ *             or when no time base is set
+ * @remarks    none
+ */
+uint32_t PWM_ISRMaxDurationGet(PWM_GENERATOR genNum);
+
+/**
+ * @brief      Clears the worst case interrupt handler duration of a PWM generator.
+ * @param[in]  genNum - PWM generator number
+ * @return     none
+ * @remarks    none
+ */
+void PWM_ISRMaxDurationReset(PWM_GENERATOR genNum);
+
+/**
+ * @brief      Sets the time base of the interrupt handler duration measurement.
+ * @details    The counter must count up from 0 to counterPeriod and roll over to 0,
+ *             a single roll-over during a handler is accounted for. A free running
+ *             timer with its interrupt disabled is sufficient, it must be started by
+ *             the application.
+ * @pre        The `PWM_Initialize()` function must have been called.
+ * @param[in]  counterGet    - Function returning the counter, NULL stops the measurement
+ * @param[in]  counterPeriod - Last count before the counter rolls over
+ * @return     none
+ * @remarks    Call this function before the PWM generator interrupts are enabled.
+ */
+void PWM_ISRTimeBaseSet(PWM_TIME_BASE_GET counterGet, uint32_t counterPeriod);
+
 #endif //PWM_H
 
@@ -0,0 +1,253 @@
+/*******************************************************************************
+  Interrupt Priority Planner Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    irq_planner.c
+
+  Summary:
+    Assigns the interrupt priorities from the rates and deadlines of the sources.
+
+  Description:
+    The response time of a source is the smallest fixed point of
+    R = B + C + sum(ceil(R / Tj) * Cj) over the sources j that can delay it,
+    found by iteration from R = C. Without nesting, the handler itself is not
+    preempted once started, so the analysis is done on its start time instead.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// Section: Included Files
+
+#include <stddef.h>
+#include "definitions.h"
+#include "irq_planner.h"
+
+// Section: Local Functions
+
+static uint32_t IRQ_PLANNER_Deadline(const IRQ_PLANNER_SOURCE* source)
+{
+    return (source->deadline < source->period) ? source->deadline : source->period;
+}
+
+/* Worst case response time, or 0xFFFFFFFF when it exceeds the deadline */
+static uint32_t IRQ_PLANNER_ResponseTime(const IRQ_PLANNER_SOURCE* sources, uint32_t count, uint32_t index, bool nesting)
+{
+    const IRQ_PLANNER_SOURCE* analysed = &sources[index];
+    uint32_t deadline = IRQ_PLANNER_Deadline(analysed);
+    uint64_t blocking = 0U;
+    uint64_t response;
+    uint64_t next;
+    uint32_t other;
+
+    /* Without nesting, a lower priority handler just started runs to completion */
+    if (!nesting)
+    {
+        for (other = 0U; other < count; other++)
+        {
+            if ((sources[other].priority < analysed->priority) && (sources[other].executionTime > blocking))
+            {
+                blocking = sources[other].executionTime;
+            }
+        }
+    }
+
+    /* With nesting R is the end of the handler, without nesting the start */
+    response = nesting ? (blocking + analysed->executionTime) : blocking;
+
+    while (true)
+    {
+        next = nesting ? (blocking + analysed->executionTime) : blocking;
+
+        for (other = 0U; other < count; other++)
+        {
+            if ((other == index) || (sources[other].priority < analysed->priority))
+            {
+                continue;
+            }
+
+            if (nesting)
+            {
+                next += ((response + sources[other].period - 1U) / sources[other].period) * sources[other].executionTime;
+            }
+            else
+            {
+                /* The requests up to and including the start instant get ahead */
+                next += ((response / sources[other].period) + 1U) * sources[other].executionTime;
+            }
+        }
+
+        if ((next + (nesting ? 0U : analysed->executionTime)) > deadline)
+        {
+            return 0xFFFFFFFFU;
+        }
+
+        if (next == response)
+        {
+            break;
+        }
+        response = next;
+    }
+
+    return (uint32_t)(nesting ? response : (response + analysed->executionTime));
+}
+
+/* Checks that every enabled interrupt source is in the plan */
+static bool IRQ_PLANNER_IsComplete(const IRQ_PLANNER_SOURCE* sources, uint32_t count)
+{
+    INT_SOURCE source;
+    uint32_t index;
+    bool listed;
+
+    for (source = 0U; source <= IRQ_PLANNER_SOURCE_LAST; source++)
+    {
+        if (INTC_SourceIsEnabled(source))
+        {
+            listed = false;
+            for (index = 0U; (index < count) && !listed; index++)
+            {
+                listed = (sources[index].source == source);
+            }
+
+            if (!listed)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Section: Interrupt Priority Planner Implementation
+
+IRQ_PLANNER_RESULT IRQ_PLANNER_Plan(IRQ_PLANNER_SOURCE* sources, uint32_t count, bool nesting)
+{
+    uint8_t order[IRQ_PLANNER_SOURCES_MAX];
+    IRQ_PLANNER_RESULT result = IRQ_PLANNER_SCHEDULABLE;
+    uint64_t utilization = 0U;
+    uint32_t index;
+    uint32_t rank;
+    uint32_t levels;
+    uint8_t moved;
+
+    if ((count == 0U) || (count > IRQ_PLANNER_SOURCES_MAX))
+    {
+        return IRQ_PLANNER_INVALID;
+    }
+
+    for (index = 0U; index < count; index++)
+    {
+        if (sources[index].period == 0U)
+        {
+            return IRQ_PLANNER_INVALID;
+        }
+        order[index] = (uint8_t)index;
+    }
+
+    /* Rate monotonic order, the shorter deadline first between equal rates */
+    for (index = 1U; index < count; index++)
+    {
+        moved = order[index];
+        rank = index;
+
+        while ((rank > 0U) &&
+               ((sources[order[rank - 1U]].period > sources[moved].period) ||
+                ((sources[order[rank - 1U]].period == sources[moved].period) &&
+                 (IRQ_PLANNER_Deadline(&sources[order[rank - 1U]]) > IRQ_PLANNER_Deadline(&sources[moved])))))
+        {
+            order[rank] = order[rank - 1U];
+            rank--;
+        }
+        order[rank] = moved;
+    }
+
+    /* Spread the sources over the levels, from the highest priority down */
+    levels = (count < INTC_PRIORITY_MAX) ? count : INTC_PRIORITY_MAX;
+
+    for (rank = 0U; rank < count; rank++)
+    {
+        sources[order[rank]].priority = INTC_PRIORITY_MAX - ((rank * levels) / count);
+    }
+
+    for (index = 0U; index < count; index++)
+    {
+        utilization += ((uint64_t)sources[index].executionTime << 16) / sources[index].period;
+    }
+
+    for (index = 0U; index < count; index++)
+    {
+        sources[index].responseTime = IRQ_PLANNER_ResponseTime(sources, count, index, nesting);
+
+        if (sources[index].responseTime == 0xFFFFFFFFU)
+        {
+            result = IRQ_PLANNER_DEADLINE_MISSED;
+        }
+    }
+
+    /* Above 100 % the requests cannot all be served in the long run */
+    if (utilization > (1UL << 16))
+    {
+        result = IRQ_PLANNER_OVERLOADED;
+    }
+
+    return result;
+}
+
+IRQ_PLANNER_RESULT IRQ_PLANNER_Apply(IRQ_PLANNER_SOURCE* sources, uint32_t count, bool nesting)
+{
+    IRQ_PLANNER_RESULT result = IRQ_PLANNER_Plan(sources, count, nesting);
+    uint32_t index;
+    bool interruptState;
+
+    if ((result != IRQ_PLANNER_INVALID) && !IRQ_PLANNER_IsComplete(sources, count))
+    {
+        result = IRQ_PLANNER_INCOMPLETE;
+    }
+
+    if ((result != IRQ_PLANNER_INVALID) && (result != IRQ_PLANNER_INCOMPLETE))
+    {
+        interruptState = INTC_Disable();
+
+        for (index = 0U; index < count; index++)
+        {
+            INTC_SourcePrioritySet(sources[index].source, sources[index].priority);
+        }
+
+        if (nesting)
+        {
+            INTC_NestingEnable();
+        }
+        else
+        {
+            INTC_NestingDisable();
+        }
+
+        INTC_Restore(interruptState);
+    }
+
+    return result;
+}
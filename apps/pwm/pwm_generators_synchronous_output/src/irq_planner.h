@@ -0,0 +1,164 @@
+/*******************************************************************************
+  Interrupt Priority Planner Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    irq_planner.h
+
+  Summary:
+    Assigns the interrupt priorities from the rates and deadlines of the sources.
+
+  Description:
+    The application describes each interrupt source by its shortest interval
+    between two requests, its deadline and the worst case execution time of
+    its handler. The planner assigns the priorities in rate monotonic order,
+    the shortest interval getting the highest priority, and checks that every
+    source meets its deadline with a worst case response time analysis.
+
+    When there are more sources than priority levels, neighbouring sources
+    share a level and are analysed as if they could delay each other.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef IRQ_PLANNER_H
+#define IRQ_PLANNER_H
+
+// Section: Included Files
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "definitions.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// Section: Data Types
+
+/* Largest number of sources in a plan */
+#define IRQ_PLANNER_SOURCES_MAX     (16U)
+
+/* Highest interrupt source checked for a missing entry by IRQ_PLANNER_Apply */
+#define IRQ_PLANNER_SOURCE_LAST     (INT_SOURCE_CLC4N)
+
+/**
+ @struct   IRQ_PLANNER_SOURCE
+ @brief    Interrupt source of a plan, times in nanoseconds
+*/
+typedef struct
+{
+    INT_SOURCE              source;
+
+    /* Shortest interval between two interrupt requests */
+    uint32_t                period;
+
+    /* Longest time allowed from the request to the end of the handler, for
+       instance the time to fill the receive FIFO. As the interrupt flag holds
+       one request, a deadline above the period is taken as the period. */
+    uint32_t                deadline;
+
+    /* Worst case execution time of the handler, including the entry and exit */
+    uint32_t                executionTime;
+
+    /* Set by the planner: priority level, 1 to INTC_PRIORITY_MAX */
+    uint32_t                priority;
+
+    /* Set by the planner: worst case response time, 0xFFFFFFFF when the
+       deadline is missed */
+    uint32_t                responseTime;
+
+} IRQ_PLANNER_SOURCE;
+
+/**
+ @enum     IRQ_PLANNER_RESULT
+ @brief    Outcome of the schedulability analysis
+*/
+typedef enum
+{
+    /* All the sources meet their deadline */
+    IRQ_PLANNER_SCHEDULABLE = 0,
+
+    /* At least one source misses its deadline */
+    IRQ_PLANNER_DEADLINE_MISSED,
+
+    /* The handlers need more than the whole CPU time */
+    IRQ_PLANNER_OVERLOADED,
+
+    /* Empty plan, too many sources, or a null period */
+    IRQ_PLANNER_INVALID,
+
+    /* An enabled interrupt source is not in the plan */
+    IRQ_PLANNER_INCOMPLETE
+
+} IRQ_PLANNER_RESULT;
+
+// Section: Interface Functions
+
+/**
+ * @brief      Assigns the priorities and analyses the plan.
+ * @details    The priority and responseTime members of each source are set.
+ *             With nesting, a source is delayed by the sources of a higher
+ *             or of the same priority. Without nesting, a handler also runs
+ *             to completion, so a source is blocked by the longest handler of
+ *             a lower priority as well.
+ * @param[in,out] sources - Interrupt sources
+ * @param[in]  count   - Number of sources, up to IRQ_PLANNER_SOURCES_MAX
+ * @param[in]  nesting - true when the higher priorities preempt the handlers
+ * @return     Outcome of the analysis
+ */
+IRQ_PLANNER_RESULT IRQ_PLANNER_Plan(IRQ_PLANNER_SOURCE* sources, uint32_t count, bool nesting);
+
+/**
+ * @brief      Plans the sources and programs the interrupt controller.
+ * @details    The priorities and the nesting policy are written with
+ *             interrupts disabled, unless the plan is invalid or incomplete.
+ *             They are written even when a deadline is missed, the closest to
+ *             the requirements that the hardware allows. A plan is incomplete
+ *             when an interrupt source enabled at the time of the call is not
+ *             in it, as the analysis would not account for its handler.
+ * @param[in,out] sources - Interrupt sources
+ * @param[in]  count   - Number of sources, up to IRQ_PLANNER_SOURCES_MAX
+ * @param[in]  nesting - true to let the higher priorities preempt the handlers
+ * @return     Outcome of the analysis, IRQ_PLANNER_INCOMPLETE when an enabled
+ *             source is missing
+ * @remarks    Call this function once all the interrupt sources are enabled.
+ */
+IRQ_PLANNER_RESULT IRQ_PLANNER_Apply(IRQ_PLANNER_SOURCE* sources, uint32_t count, bool nesting);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif // IRQ_PLANNER_H
@@ -48,6 +48,7 @@
 #include <stdbool.h>                    // Defines true
 #include <stdlib.h>                     // Defines EXIT_FAILURE
 #include "definitions.h"                // SYS function prototypes
+#include "irq_planner.h"                // Interrupt priorities from deadlines
 
 /***************************************
  * Check PWM outputs on pins
@@ -63,41 +64,132 @@
 /* Initial PWM Generator 1 period for 100kHz */
 #define PWM_PERIOD          (0x3E70U)
 
-/* This function is called after PWM Generator 1 EOC event */
-void PWM_EOCEventHandler(PWM_GENERATOR genNum, uintptr_t context)
+/* Set to 1 to play back the duty cycle tables on PWM Generator 1 with DMA
+   instead of updating the duty cycles from the EOC callback. Timer 1 paces the
+   playback at 10kHz: each duty cycle is applied at the next PWM cycle boundary,
+   but the playback rate is not locked to the 100kHz PWM. The DMA trigger
+   sources of the PWM EOC and ADC trigger events are not part of this
+   configuration, so the DMA cannot be triggered by the PWM itself. */
+#define PWM_DUTY_PLAYBACK   (0)
+
+/* Set to 1 to measure the PWM interrupt handler durations with Timer 1,
+   see PWM_ISRMaxDurationGet */
+#define PWM_ISR_TIMING      (0)
+
+/* Set to 1 to assign the interrupt priorities from the rates and deadlines below */
+#define INTERRUPT_PLANNING  (0)
+
+#if (PWM_DUTY_PLAYBACK == 1)
+
+/* Number of entries of a duty cycle table, played back at the Timer 1 rate */
+#define PLAYBACK_TABLE_SIZE     (32U)
+
+/* Number of complete table playbacks before switching to the other table */
+#define PLAYBACK_TABLE_REPEAT   (1000U)
+
+/* Duty cycle tables */
+static const uint32_t sineDutyTable[PLAYBACK_TABLE_SIZE] =
 {
-    if(genNum == PWM_GENERATOR_1)
+    8000U, 9360U, 10672U, 11888U, 12944U, 13808U, 14464U, 14864U,
+    14992U, 14864U, 14464U, 13808U, 12944U, 11888U, 10672U, 9360U,
+    8000U, 6624U, 5312U, 4096U, 3040U, 2176U, 1520U, 1120U,
+    992U, 1120U, 1520U, 2176U, 3040U, 4096U, 5312U, 6624U
+};
+
+static const uint32_t triangleDutyTable[PLAYBACK_TABLE_SIZE] =
+{
+    992U, 1872U, 2736U, 3616U, 4496U, 5360U, 6240U, 7120U,
+    8000U, 8864U, 9744U, 10624U, 11488U, 12368U, 13248U, 14112U,
+    14992U, 14112U, 13248U, 12368U, 11488U, 10624U, 9744U, 8864U,
+    8000U, 7120U, 6240U, 5360U, 4496U, 3616U, 2736U, 1872U
+};
+
+/* Buffer played back by DMA, the source address is reloaded by the channel at
+   the end of each playback so that no Timer 1 trigger is missed at the wrap */
+static uint32_t playbackTable[PLAYBACK_TABLE_SIZE];
+
+static void PWM_PlaybackTableLoad(const uint32_t* table)
+{
+    uint32_t index;
+
+    for (index = 0U; index < PLAYBACK_TABLE_SIZE; index++)
+    {
+        playbackTable[index] = table[index];
+    }
+}
+
+/* This function is called by DMA each time a table has been played back */
+void PWM_PlaybackHandler(DMA_TRANSFER_EVENT event, uintptr_t context)
+{
+    static uint32_t playCount = 0U;
+    static const uint32_t* table = sineDutyTable;
+
+    if (event == DMA_TRANSFER_EVENT_COMPLETE)
     {
-        if(!PWM_SoftwareUpdatePending(PWM_GENERATOR_1)) 
+        playCount++;
+        if (playCount >= PLAYBACK_TABLE_REPEAT)
         {
-            /* duty cycle values */
-            static uint32_t duty0 = 3200U;
-            static uint32_t duty1 = 3200U;
-            static uint32_t duty2 = 3200U;
-            static uint32_t duty3 = 3200U;
+            playCount = 0U;
+            table = (table == sineDutyTable) ? triangleDutyTable : sineDutyTable;
+
+            /* The first entry is transferred on the next Timer 1 trigger, one
+               Timer 1 period after the wrap, the copy completes well before */
+            PWM_PlaybackTableLoad(table);
+        }
+    }
+}
 
-            PWM_DutyCycleSet(PWM_GENERATOR_1, duty0);
-            PWM_DutyCycleSet(PWM_GENERATOR_2, duty1);
-            PWM_DutyCycleSet(PWM_GENERATOR_3, duty2);
-            PWM_DutyCycleSet(PWM_GENERATOR_4, duty3);
+#endif
 
-            /* Updates the Duty Cycle 10% to All PWM Generators but Set update Request to only Host PWM generator(PG1) */
-            PWM_SoftwareUpdateRequest(PWM_GENERATOR_1);
+#if (INTERRUPT_PLANNING == 1)
 
+/* Interrupt rates, deadlines and handler times in ns at 100kHz PWM. All the
+   enabled sources must be listed, IRQ_PLANNER_Apply refuses an incomplete plan. */
+static IRQ_PLANNER_SOURCE interruptPlan[] =
+{
+#if (PWM_DUTY_PLAYBACK == 1)
+    /* A new table must be loaded before the next Timer 1 trigger */
+    {INT_SOURCE_T1,     100000U,  100000U, 500U,  0U, 0U},
+    {INT_SOURCE_DMA0,   3200000U, 100000U, 2000U, 0U, 0U},
+#else
+    {INT_SOURCE_PWM1,   10000U,   10000U,  1500U, 0U, 0U},
+#endif
+};
+
+/* Outcome of the plan, the response times are in interruptPlan */
+static volatile IRQ_PLANNER_RESULT interruptPlanResult;
+
+#endif
+
+/* New duty cycles of all the generators, committed with one update request */
+static PWM_GENERATOR_UPDATE dutyUpdates[] =
+{
+    {PWM_GENERATOR_1, PWM_UPDATE_DUTY_CYCLE, 3200U, 0U, 0U},
+    {PWM_GENERATOR_2, PWM_UPDATE_DUTY_CYCLE, 3200U, 0U, 0U},
+    {PWM_GENERATOR_3, PWM_UPDATE_DUTY_CYCLE, 3200U, 0U, 0U},
+    {PWM_GENERATOR_4, PWM_UPDATE_DUTY_CYCLE, 3200U, 0U, 0U},
+};
+
+#define PWM_GENERATOR_COUNT (sizeof(dutyUpdates) / sizeof(dutyUpdates[0]))
+
+/* This function is called after PWM Generator 1 EOC event */
+void PWM_EOCEventHandler(PWM_GENERATOR genNum, uintptr_t context)
+{
+    uint32_t index;
+
+    if(genNum == PWM_GENERATOR_1)
+    {
+        /* Updates the Duty Cycle 10% to All PWM Generators but Set update Request to only Host PWM generator(PG1) */
+        if(PWM_GeneratorsUpdate(dutyUpdates, PWM_GENERATOR_COUNT, PWM_GENERATOR_1))
+        {
             /* Increment duty cycle values */
-            duty0 += DUTY_INCREMENT;
-            duty1 += DUTY_INCREMENT;
-            duty2 += DUTY_INCREMENT;
-            duty3 += DUTY_INCREMENT;
-
-            if (duty0 > PWM_PERIOD)
-                duty0 = 0U;
-            if (duty1 > PWM_PERIOD)
-                duty1 = 0U;
-            if (duty2 > PWM_PERIOD)
-                duty2 = 0U;
-            if (duty3 > PWM_PERIOD)
-                duty3 = 0U;      
+            for(index = 0U; index < PWM_GENERATOR_COUNT; index++)
+            {
+                dutyUpdates[index].dutyCycle += DUTY_INCREMENT;
+
+                if (dutyUpdates[index].dutyCycle > PWM_PERIOD)
+                    dutyUpdates[index].dutyCycle = 0U;
+            }
         }
     }
 }
@@ -106,9 +198,49 @@ int main ( void )
 {
     /* Initialize all modules */
     SYS_Initialize ( NULL );
-    
+
+#if (PWM_DUTY_PLAYBACK == 1) || (PWM_ISR_TIMING == 1)
+    /* Timer 1 is only set up for the options that use it */
+    TMR1_Initialize();
+#endif
+
+#if (PWM_DUTY_PLAYBACK == 1)
+    /* DMA channel 0 is only set up for the playback, it is triggered by Timer 1 */
+    DMA_Initialize();
+
+    /* No callback of PWM Generator 1 is registered, its interrupt is not needed */
+    INTC_SourceDisable(INT_SOURCE_PWM1);
+
+    /* Every DMA write to PG1DC requests the update, the new duty cycle is applied at the next PWM cycle */
+    PWM_UpdateTriggerSet(PWM_GENERATOR_1, PWM_UPDATE_TRIGGER_DUTY_CYCLE);
+
+    /* DMA channel 0 runs in repeated one-shot mode with source reload, it is
+       armed once and then plays the buffer back without CPU involvement */
+    PWM_PlaybackTableLoad(sineDutyTable);
+    DMA_ChannelCallbackRegister(DMA_CHANNEL_0, PWM_PlaybackHandler, (uintptr_t)NULL);
+    (void)DMA_ChannelTransfer(DMA_CHANNEL_0, playbackTable, (void*)PWM_DutyCycleAddressGet(PWM_GENERATOR_1), PLAYBACK_TABLE_SIZE);
+
+    /* Timer 1 triggers the DMA transfer of one table entry */
+    TMR1_Start();
+#else
     PWM_EOCEventCallbackRegister(PWM_GENERATOR_1, PWM_EOCEventHandler, (uintptr_t)NULL);
+#endif
+
+#if (PWM_ISR_TIMING == 1)
+    /* Timer 1 runs free, its counter is read on entry and exit of the PWM interrupt */
+#if (PWM_DUTY_PLAYBACK == 0)
+    TMR1_InterruptDisable();
+#endif
+    PWM_ISRTimeBaseSet(TMR1_CounterGet, TMR1_PeriodGet());
+    TMR1_Start();
+#endif
     
+#if (INTERRUPT_PLANNING == 1)
+    /* Replaces the generated priorities once all the sources are enabled, the
+       handlers are preempted by shorter deadlines */
+    interruptPlanResult = IRQ_PLANNER_Apply(interruptPlan, sizeof(interruptPlan) / sizeof(interruptPlan[0]), true);
+#endif
+
     /* Start all synchronous channels by starting generator 1*/
     PWM_Enable();
 
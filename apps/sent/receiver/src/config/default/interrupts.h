@@ -56,6 +56,8 @@
 // Section: Handler Routines
 // *****************************************************************************
 // *****************************************************************************
+void SENT2_InterruptHandler( void );
+void SENT2E_InterruptHandler( void );
 
 
 
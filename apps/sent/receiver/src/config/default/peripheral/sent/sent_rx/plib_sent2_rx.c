@@ -45,7 +45,17 @@
 #include "device.h"
 #include "plib_sent2_rx.h"
 
-static volatile bool bDataReceived = false;
+/* Receive queue, written by the receive interrupt and read by the application */
+static volatile SENT_RECEIVE_FRAME sent2Queue[SENT2_RECEIVE_QUEUE_SIZE];
+static volatile uint32_t sent2WriteIndex = 0U;
+static volatile uint32_t sent2ReadIndex = 0U;
+
+static volatile SENT_RECEIVE_COUNTERS sent2Counters;
+static volatile SENT_ERROR_CODE sent2LastError = NO_ERROR;
+
+static SENT_TIMESTAMP_SOURCE sent2TimestampSource = NULL;
+static SENT_RECEIVE_CALLBACK sent2Callback = NULL;
+static uintptr_t sent2Context = 0U;
 
 
 #define SENT2CON1_NIBCNT_ONE      ((uint32_t)(_SENT2CON1_NIBCNT_MASK & ((uint32_t)(1) << _SENT2CON1_NIBCNT_POSITION))) 
@@ -55,6 +65,25 @@ static volatile bool bDataReceived = false;
 #define SENT2CON1_NIBCNT_FIVE      ((uint32_t)(_SENT2CON1_NIBCNT_MASK & ((uint32_t)(5) << _SENT2CON1_NIBCNT_POSITION))) 
 #define SENT2CON1_NIBCNT_SIX      ((uint32_t)(_SENT2CON1_NIBCNT_MASK & ((uint32_t)(6) << _SENT2CON1_NIBCNT_POSITION))) 
 
+#define SENT2DAT_FIELD(value, field)    (((value) & _SENT2DAT_##field##_MASK) >> _SENT2DAT_##field##_POSITION)
+
+// Section: Local Functions
+
+static uint32_t SENT2_InterruptSave(void)
+{
+    uint32_t interruptState = IEC3 & (_IEC3_SENT2IE_MASK | _IEC3_SENT2EIE_MASK);
+
+    IEC3bits.SENT2IE = 0U;
+    IEC3bits.SENT2EIE = 0U;
+
+    return interruptState;
+}
+
+static void SENT2_InterruptRestore(uint32_t interruptState)
+{
+    IEC3 |= interruptState;
+}
+
 // Section: SENT2 Module APIs
 
 void SENT2_Initialize(void)
@@ -67,7 +96,16 @@ void SENT2_Initialize(void)
 	SENT2CON2 = 0x73UL;
 	/* SYNC MIN */
 	SENT2CON3 = 0x4dUL;
-	
+
+    sent2WriteIndex = 0U;
+    sent2ReadIndex = 0U;
+    SENT2_ReceiveCountersClear();
+
+    /* Frames and errors are collected by the interrupts */
+    IFS3bits.SENT2IF = 0U;
+    IFS3bits.SENT2EIF = 0U;
+    IEC3bits.SENT2IE = 1U;
+    IEC3bits.SENT2EIE = 1U;
 }
 
 void SENT2_Deinitialize(void)
@@ -98,20 +136,89 @@ void SENT2_Disable(void)
 
 SENT_DATA_RECEIVE SENT2_Receive(void)
 {
-    SENT_DATA_RECEIVE sentData = {0};
-    sentData.status =   SENT2DATbits.STAT;
-    sentData.data1  =   SENT2DATbits.DATA1;
-    sentData.data2  =   SENT2DATbits.DATA2;
-    return sentData;
+    SENT_RECEIVE_FRAME frame = {0};
+
+    (void)SENT2_FrameRead(&frame);
+
+    return frame.data;
 }
 
 bool SENT2_IsDataReceived(void)
 {
-   while(IFS3bits.SENT2IF == 0U)
-   {
-   }
-   IFS3bits.SENT2IF = 0U;
-   return true;
+    return (sent2WriteIndex != sent2ReadIndex);
+}
+
+bool SENT2_FrameRead(SENT_RECEIVE_FRAME* frame)
+{
+    uint32_t readIndex = sent2ReadIndex;
+    volatile SENT_RECEIVE_FRAME* entry;
+
+    if (readIndex == sent2WriteIndex)
+    {
+        return false;
+    }
+
+    entry = &sent2Queue[readIndex & (SENT2_RECEIVE_QUEUE_SIZE - 1U)];
+    frame->data = entry->data;
+    frame->timestamp = entry->timestamp;
+    frame->sequence = entry->sequence;
+
+    /* Release the entry only once it has been copied */
+    sent2ReadIndex = readIndex + 1U;
+
+    return true;
+}
+
+uint32_t SENT2_FrameCountGet(void)
+{
+    return (sent2WriteIndex - sent2ReadIndex);
+}
+
+void SENT2_ReceiveQueueFlush(void)
+{
+    sent2ReadIndex = sent2WriteIndex;
+}
+
+void SENT2_ReceiveCountersGet(SENT_RECEIVE_COUNTERS* counters)
+{
+    uint32_t interruptState = SENT2_InterruptSave();
+
+    counters->frames = sent2Counters.frames;
+    counters->crcErrors = sent2Counters.crcErrors;
+    counters->frameErrors = sent2Counters.frameErrors;
+    counters->idleErrors = sent2Counters.idleErrors;
+    counters->overruns = sent2Counters.overruns;
+
+    SENT2_InterruptRestore(interruptState);
+}
+
+void SENT2_ReceiveCountersClear(void)
+{
+    uint32_t interruptState = SENT2_InterruptSave();
+
+    sent2Counters.frames = 0U;
+    sent2Counters.crcErrors = 0U;
+    sent2Counters.frameErrors = 0U;
+    sent2Counters.idleErrors = 0U;
+    sent2Counters.overruns = 0U;
+    sent2LastError = NO_ERROR;
+
+    SENT2_InterruptRestore(interruptState);
+}
+
+void SENT2_TimestampSourceRegister(SENT_TIMESTAMP_SOURCE source)
+{
+    sent2TimestampSource = source;
+}
+
+void SENT2_CallbackRegister(SENT_RECEIVE_CALLBACK callback, uintptr_t context)
+{
+    uint32_t interruptState = SENT2_InterruptSave();
+
+    sent2Callback = callback;
+    sent2Context = context;
+
+    SENT2_InterruptRestore(interruptState);
 }
 
 SENT_RECEIVE_STATUS SENT2_ReceiveStatusGet(void)
@@ -121,36 +228,82 @@ SENT_RECEIVE_STATUS SENT2_ReceiveStatusGet(void)
 
 SENT_ERROR_CODE ReceiveErrorGet(void)
 {
-	if(IFS3bits.SENT2EIF == 0x1)
-	{
-		SENT_ERROR_CODE errorCode = NO_ERROR;
-		
-		if(SENT1STATbits.CRCERR == 0x1)
-		{
-			SENT1STATbits.CRCERR = 0;
-			errorCode = CRC_ERROR;
-		}
-		else if(SENT1STATbits.FRMERR == 0x1)
-		{
-			SENT1STATbits.FRMERR = 0;
-			errorCode = FRAME_ERROR;
-		}
-		else if(SENT1STATbits.RXIDLE == 0x1)
-		{
-			SENT1STATbits.RXIDLE = 0;
-			errorCode = RX_IDLE_ERROR;
-		}
-		else
-		{
-			//Nothing to process
-		}
-		IFS3bits.SENT2EIF = 0;
-		return errorCode;
-	}
-	return NO_ERROR;
+    uint32_t interruptState = SENT2_InterruptSave();
+    SENT_ERROR_CODE errorCode = sent2LastError;
+
+    sent2LastError = NO_ERROR;
+
+    SENT2_InterruptRestore(interruptState);
+
+    return errorCode;
+}
+
+void SENT2_InterruptHandler(void)
+{
+    /* A single read, the next frame can overwrite the register at any time */
+    uint32_t value = SENT2DAT;
+    uint32_t writeIndex = sent2WriteIndex;
+    volatile SENT_RECEIVE_FRAME* entry;
+
+    IFS3bits.SENT2IF = 0U;
+
+    if ((writeIndex - sent2ReadIndex) < SENT2_RECEIVE_QUEUE_SIZE)
+    {
+        entry = &sent2Queue[writeIndex & (SENT2_RECEIVE_QUEUE_SIZE - 1U)];
+        entry->data.status = SENT2DAT_FIELD(value, STAT);
+        entry->data.data1 = SENT2DAT_FIELD(value, DATA1);
+        entry->data.data2 = SENT2DAT_FIELD(value, DATA2);
+        entry->data.data3 = SENT2DAT_FIELD(value, DATA3);
+        entry->data.data4 = SENT2DAT_FIELD(value, DATA4);
+        entry->data.data5 = SENT2DAT_FIELD(value, DATA5);
+        entry->data.data6 = SENT2DAT_FIELD(value, DATA6);
+        entry->data.crc = SENT2DAT_FIELD(value, CRC);
+        entry->timestamp = (sent2TimestampSource != NULL) ? sent2TimestampSource() : 0U;
+        entry->sequence = sent2Counters.frames;
+
+        sent2WriteIndex = writeIndex + 1U;
+    }
+    else
+    {
+        /* The newest frame is dropped, the sequence gap shows it to the reader */
+        sent2Counters.overruns++;
+    }
+    sent2Counters.frames++;
+
+    if (sent2Callback != NULL)
+    {
+        sent2Callback(sent2Context);
+    }
+}
+
+void SENT2E_InterruptHandler(void)
+{
+    uint32_t status = SENT2STAT;
+
+    /* Every error is counted, the most severe one is reported by ReceiveErrorGet */
+    if ((status & _SENT2STAT_RXIDLE_MASK) != 0U)
+    {
+        SENT2STATbits.RXIDLE = 0U;
+        sent2Counters.idleErrors++;
+        sent2LastError = RX_IDLE_ERROR;
+    }
+    if ((status & _SENT2STAT_FRMERR_MASK) != 0U)
+    {
+        SENT2STATbits.FRMERR = 0U;
+        sent2Counters.frameErrors++;
+        sent2LastError = FRAME_ERROR;
+    }
+    if ((status & _SENT2STAT_CRCERR_MASK) != 0U)
+    {
+        SENT2STATbits.CRCERR = 0U;
+        sent2Counters.crcErrors++;
+        sent2LastError = CRC_ERROR;
+    }
+
+    IFS3bits.SENT2EIF = 0U;
 }
-			
+
 
 /**
  End of File
-*/
\ No newline at end of file
+*/
@@ -58,6 +58,11 @@
 #include <stdint.h>
 #include "plib_sent_rx_common.h"
 
+// Section: Macro Definitions
+
+/* Depth of the receive queue in frames, a power of 2 */
+#define SENT2_RECEIVE_QUEUE_SIZE    (16U)
+
 // Section: SENT2 PLIB Routines
  
 /**
@@ -172,9 +177,9 @@ void SENT2_Disable(void);
  *
  * @brief    Reads the received data from transmitter
  *
- * @details  This function is responsible for receiving data transmitted for the
- * specified SENT instance. The function will handle the reception process and return the
- * received data.
+ * @details  This function removes the oldest frame from the receive queue and
+ * returns its data. It does not wait, the returned data is all zero when the
+ * queue is empty. SENT2_FrameRead also returns the frame timestamp and sequence.
  *
  * @pre  The SENT2 peripheral must have been initialized using the SENT2_Initialize API.
  * The peripheral should be enabled using the SENT2_Enable() API.
@@ -197,7 +202,8 @@ SENT_DATA_RECEIVE SENT2_Receive(void);
  * @brief     Checks if data has been received for SENT Peripheral.
  *
  * @details   The function returns a boolean value indicating whether new data has been successfully
- * received and is available for processing. 
+ * received and is available for processing. It does not wait, the frames are
+ * queued by the SENT2 receive interrupt.
  *
  * @pre   The SENT2 peripheral must have been initialized using the SENT2_Initialize API.
  * The peripheral should be enabled using the SENT2_Enable() API.
@@ -244,7 +250,9 @@ SENT_RECEIVE_STATUS SENT2_ReceiveStatusGet(void);
 
 /** 
  * @brief    Returns the type of reception error
- * @details  This function returns the most recent error code that was recorded during reception.
+ * @details  This function returns the most recent error code that was recorded during reception
+ * by the SENT2 error interrupt, and clears it. When several errors are flagged together,
+ * a CRC error takes precedence over a framing error and a framing error over an idle bus.
  *
  * @param    none
  * @return   Returns the SENT2 module reception error \ref SENT_ERROR_CODE
@@ -263,6 +271,101 @@ SENT_RECEIVE_STATUS SENT2_ReceiveStatusGet(void);
  */
  SENT_ERROR_CODE ReceiveErrorGet(void);
 
+/**
+ * @brief    Reads the oldest frame of the receive queue.
+ *
+ * @details  The SENT2 receive interrupt queues every frame with its timestamp
+ * and sequence number. The function does not wait. When the queue is full,
+ * the new frames are dropped and counted as overruns, so a gap in the sequence
+ * numbers tells the reader how many frames were lost.
+ *
+ * @pre  The SENT2 peripheral must have been initialized using the SENT2_Initialize API.
+ *
+ * @param    frame - Pointer to the frame read
+ * @return   true   - A frame was read
+ * @return   false  - The receive queue is empty
+ *
+ * @b Example:
+ * @code
+ *    SENT_RECEIVE_FRAME frame;
+ *    while (SENT2_FrameRead(&frame))
+ *    {
+ *        // Process frame.data
+ *    }
+ * @endcode
+ * @remarks None
+ */
+bool SENT2_FrameRead(SENT_RECEIVE_FRAME* frame);
+
+/**
+ * @brief    Returns the number of frames waiting in the receive queue.
+ *
+ * @param    none
+ * @return   Number of frames, up to SENT2_RECEIVE_QUEUE_SIZE
+ * @remarks None
+ */
+uint32_t SENT2_FrameCountGet(void);
+
+/**
+ * @brief    Discards the frames waiting in the receive queue.
+ *
+ * @param    none
+ * @return   none
+ * @remarks None
+ */
+void SENT2_ReceiveQueueFlush(void);
+
+/**
+ * @brief    Reads the receive counters of the SENT2 channel.
+ *
+ * @details  The frame counter and the CRC, framing, idle and overrun error
+ * counters are updated by the SENT2 interrupts and read together.
+ *
+ * @param    counters - Pointer to the counters read
+ * @return   none
+ * @remarks None
+ */
+void SENT2_ReceiveCountersGet(SENT_RECEIVE_COUNTERS* counters);
+
+/**
+ * @brief    Clears the receive counters and the last error code.
+ *
+ * @details  The sequence numbers of the next frames restart from 0.
+ *
+ * @param    none
+ * @return   none
+ * @remarks None
+ */
+void SENT2_ReceiveCountersClear(void);
+
+/**
+ * @brief    Registers the function that timestamps the received frames.
+ *
+ * @details  The function is called from the SENT2 receive interrupt, it would
+ * typically return a free running timer count. The timestamps are 0 when no
+ * function is registered.
+ *
+ * @param    source - Timestamp function, or NULL
+ * @return   none
+ * @remarks None
+ */
+void SENT2_TimestampSourceRegister(SENT_TIMESTAMP_SOURCE source);
+
+/**
+ * @brief    Registers the function called from the SENT2 receive interrupt
+ *           after a frame is queued.
+ *
+ * @param    callback - Callback function, or NULL
+ * @param    context  - Value passed to the callback
+ * @return   none
+ * @remarks None
+ */
+void SENT2_CallbackRegister(SENT_RECEIVE_CALLBACK callback, uintptr_t context);
+
+void SENT2_InterruptHandler(void);
+
+void SENT2E_InterruptHandler(void);
+
 
 // /cond IGNORE_THIS
 /* Provide C++ Compatibility */
@@ -107,6 +107,38 @@ typedef enum
 	
 }SENT_ERROR_CODE;
 
+/**
+ @brief    Defines a frame read from the receive queue
+*/
+typedef struct
+{
+    SENT_DATA_RECEIVE data;     /**< Received frame */
+    uint32_t timestamp;         /**< Timestamp source value when the frame was received, 0 without a source */
+    uint32_t sequence;          /**< Frame number since the counters were cleared, a gap tells lost frames */
+}SENT_RECEIVE_FRAME;
+
+/**
+ @brief    Defines the receive counters of a SENT channel
+*/
+typedef struct
+{
+    uint32_t frames;            /**< Frames received, including the dropped ones */
+    uint32_t crcErrors;         /**< Frames received with a CRC error */
+    uint32_t frameErrors;       /**< Frames received with a nibble out of the 12 to 27 ticks range */
+    uint32_t idleErrors;        /**< Bus idle periods of SYNCMAX or longer */
+    uint32_t overruns;          /**< Frames dropped because the receive queue was full */
+}SENT_RECEIVE_COUNTERS;
+
+/**
+ @brief    Function returning the timestamp of a received frame, called from the receive interrupt
+*/
+typedef uint32_t (*SENT_TIMESTAMP_SOURCE)(void);
+
+/**
+ @brief    Function called from the receive interrupt after a frame is queued
+*/
+typedef void (*SENT_RECEIVE_CALLBACK)(uintptr_t context);
+
 
 /* Provide C++ Compatibility */
 #ifdef __cplusplus
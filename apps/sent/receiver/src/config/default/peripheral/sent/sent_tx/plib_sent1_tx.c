@@ -56,6 +56,8 @@ static volatile bool bDataTransmitted = true;
 #define SENT1CON1_NIBCNT_FIVE      ((uint32_t)(_SENT1CON1_NIBCNT_MASK & ((uint32_t)(5) << _SENT1CON1_NIBCNT_POSITION))) 
 #define SENT1CON1_NIBCNT_SIX      ((uint32_t)(_SENT1CON1_NIBCNT_MASK & ((uint32_t)(6) << _SENT1CON1_NIBCNT_POSITION))) 
 
+#define SENT1DAT_FIELD(value, field)    (((uint32_t)(value) << _SENT1DAT_##field##_POSITION) & _SENT1DAT_##field##_MASK)
+
 // Section: SENT1 Module APIs
 
 void SENT1_Initialize(void)
@@ -102,9 +104,15 @@ void SENT1_TransmitModeSet(SENT_TRANSMIT_MODE mode)
 
 void SENT1_Transmit(const SENT_DATA_TRANSMIT *sentData)
 {
-    SENT1DATbits.STAT = sentData->status;
-    SENT1DATbits.DATA1 = sentData->data1;
-    SENT1DATbits.DATA2 = sentData->data2;
+    /* All the nibbles in one write instead of a read-modify-write per field */
+    SENT1DAT = (SENT1DAT_FIELD(sentData->status, STAT)
+                | SENT1DAT_FIELD(sentData->data1, DATA1)
+                | SENT1DAT_FIELD(sentData->data2, DATA2)
+                | SENT1DAT_FIELD(sentData->data3, DATA3)
+                | SENT1DAT_FIELD(sentData->data4, DATA4)
+                | SENT1DAT_FIELD(sentData->data5, DATA5)
+                | SENT1DAT_FIELD(sentData->data6, DATA6)
+                | SENT1DAT_FIELD(sentData->crc, CRC));
     if(SENT1CON1bits.TXM == 1U)
     {
         SENT1STATbits.SYNCTXEN = 1U;
@@ -48,6 +48,11 @@
 #include <stdbool.h>                    // Defines true
 #include <stdlib.h>                     // Defines EXIT_FAILURE
 #include "definitions.h"                // SYS function prototypes
+#include "sent_serial.h"
+
+/* Set to 1 to send a short serial message in the status nibble of 16 frames
+   and decode it from the SENT2 receive queue */
+#define SENT_SERIAL_DECODING    (0)
 
 
 // *****************************************************************************
@@ -81,6 +86,51 @@ bool compare(SENT_DATA_TRANSMIT *txdata, SENT_DATA_RECEIVE *rxdata)
     return status;
 }
 
+#if (SENT_SERIAL_DECODING == 1)
+/* Message ID 0x3, data 0xA5 and CRC4 0xA, sent most significant bit first */
+#define SERIAL_MESSAGE_ID       (0x3U)
+#define SERIAL_MESSAGE_DATA     (0xA5U)
+#define SERIAL_MESSAGE_BITS     (0x3A5AU)
+
+static bool serialMessageTest(void)
+{
+    SENT_SERIAL_DECODER decoder;
+    SENT_SERIAL_MESSAGE message;
+    SENT_RECEIVE_FRAME frame;
+    SENT_DATA_TRANSMIT data = sentDataTransmit;
+    bool decoded = false;
+    uint32_t frames = 0U;
+    uint32_t index;
+
+    SENT_SERIAL_Initialize(&decoder);
+    SENT2_ReceiveQueueFlush();
+    SENT2_ReceiveCountersClear();
+
+    for (index = 16U; index > 0U; index--)
+    {
+        /* Bit 3 marks the first frame, bit 2 carries the message */
+        data.status = ((index == 16U) ? 0x8U : 0x0U) | (((SERIAL_MESSAGE_BITS >> (index - 1U)) & 1U) << 2);
+        SENT1_Transmit(&data);
+        while (SENT1_IsTransmissionComplete() == false);
+    }
+
+    /* The receive interrupt queued the frames, wait for the last one */
+    while (frames < 16U)
+    {
+        if (SENT2_FrameRead(&frame))
+        {
+            frames++;
+            if (SENT_SERIAL_FrameProcess(&decoder, &frame, &message))
+            {
+                decoded = (message.id == SERIAL_MESSAGE_ID) && (message.data == SERIAL_MESSAGE_DATA);
+            }
+        }
+    }
+
+    return decoded;
+}
+#endif
+
 int main ( void )
 {
     /* Initialize all modules */
@@ -96,7 +146,11 @@ int main ( void )
     //Storing received data
     sentDataReceive = SENT2_Receive();
     //Comparing transmitted and received data
-    if(compare(&sentDataTransmit, &sentDataReceive)){
+    if(compare(&sentDataTransmit, &sentDataReceive)
+#if (SENT_SERIAL_DECODING == 1)
+        && serialMessageTest()
+#endif
+    ){
         //LED4 on the curiosity board
         LED2_Set();
     }
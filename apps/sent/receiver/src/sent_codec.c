@@ -0,0 +1,287 @@
+/*******************************************************************************
+  SENT Codec Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sent_codec.c
+
+  Summary:
+    Portable SAE J2716 SENT frame codec and timing model.
+
+  Description:
+    Integer arithmetic only, the tick lengths use 16 fractional bits.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// Section: Included Files
+
+#include "sent_codec.h"
+
+// Section: Local Objects
+
+#define SENT_CODEC_CRC4_SEED        (0x5U)
+
+/* Decoder states besides the nibble indexes */
+#define SENT_CODEC_STATE_SYNC       (0U)
+
+/* CRC4 of the previous remainder followed by a zero nibble, x^4 + x^3 + x^2 + 1 */
+static const uint8_t sentCodecCrc4Table[16] =
+{
+    0U, 13U, 7U, 10U, 14U, 3U, 9U, 4U, 1U, 12U, 6U, 11U, 15U, 2U, 8U, 5U
+};
+
+// Section: Local Functions
+
+/* Longest frame without pause pulse, all the nibbles at 15 */
+static uint32_t SENT_CODEC_FrameTicksMax(uint32_t nibbles)
+{
+    return SENT_CODEC_SYNC_TICKS + ((nibbles + 2U) * SENT_CODEC_NIBBLE_TICKS_MAX);
+}
+
+static bool SENT_CODEC_FormatIsValid(const SENT_CODEC_FORMAT* format)
+{
+    if ((format->nibbles == 0U) || (format->nibbles > SENT_CODEC_DATA_NIBBLES_MAX))
+    {
+        return false;
+    }
+
+    return ((format->frameTicks == 0U)
+            || (format->frameTicks >= (SENT_CODEC_FrameTicksMax(format->nibbles) + SENT_CODEC_PAUSE_TICKS_MIN)));
+}
+
+// Section: SENT Codec Implementation
+
+uint8_t SENT_CODEC_Crc4(const uint8_t* nibbles, uint32_t count, SENT_CODEC_CRC_MODE mode)
+{
+    uint8_t crc = SENT_CODEC_CRC4_SEED;
+    uint32_t index;
+
+    for (index = 0U; index < count; index++)
+    {
+        crc = (uint8_t)((nibbles[index] & 0xFU) ^ sentCodecCrc4Table[crc]);
+    }
+
+    if (mode == SENT_CODEC_CRC_RECOMMENDED)
+    {
+        crc = sentCodecCrc4Table[crc];
+    }
+
+    return crc;
+}
+
+uint32_t SENT_CODEC_FrameEncode(const SENT_CODEC_FORMAT* format, SENT_CODEC_FRAME* frame, uint16_t* ticks)
+{
+    uint32_t frameTicks = SENT_CODEC_SYNC_TICKS;
+    uint32_t count = 0U;
+    uint32_t index;
+
+    if (SENT_CODEC_FormatIsValid(format) == false)
+    {
+        return 0U;
+    }
+
+    frame->crc = SENT_CODEC_Crc4(frame->data, format->nibbles, format->crcMode);
+
+    ticks[count++] = (uint16_t)SENT_CODEC_SYNC_TICKS;
+    ticks[count++] = (uint16_t)(SENT_CODEC_NIBBLE_TICKS_MIN + (frame->status & 0xFU));
+    for (index = 0U; index < format->nibbles; index++)
+    {
+        ticks[count++] = (uint16_t)(SENT_CODEC_NIBBLE_TICKS_MIN + (frame->data[index] & 0xFU));
+    }
+    ticks[count++] = (uint16_t)(SENT_CODEC_NIBBLE_TICKS_MIN + frame->crc);
+
+    if (format->frameTicks != 0U)
+    {
+        for (index = 1U; index < count; index++)
+        {
+            frameTicks += ticks[index];
+        }
+
+        /* The pause pulse pads the frame to its constant length */
+        if ((format->frameTicks - frameTicks) > SENT_CODEC_PAUSE_TICKS_MAX)
+        {
+            return 0U;
+        }
+        ticks[count++] = (uint16_t)(format->frameTicks - frameTicks);
+    }
+
+    return count;
+}
+
+uint32_t SENT_CODEC_WaveformRender(const uint16_t* ticks, uint32_t count, uint32_t samplesPerTick, uint8_t* levels, uint32_t size)
+{
+    uint32_t samples = 0U;
+    uint32_t length;
+    uint32_t low;
+    uint32_t index;
+    uint32_t sample;
+
+    for (index = 0U; index < count; index++)
+    {
+        samples += (uint32_t)ticks[index] * samplesPerTick;
+    }
+    if ((samples > size) || (samplesPerTick == 0U))
+    {
+        return 0U;
+    }
+
+    samples = 0U;
+    for (index = 0U; index < count; index++)
+    {
+        length = (uint32_t)ticks[index] * samplesPerTick;
+        low = SENT_CODEC_LOW_TICKS * samplesPerTick;
+
+        for (sample = 0U; sample < length; sample++)
+        {
+            levels[samples++] = (sample < low) ? 0U : 1U;
+        }
+    }
+
+    return samples;
+}
+
+void SENT_CODEC_EdgesGenerate(const uint16_t* ticks, uint32_t count, uint32_t tickQ16, uint64_t* start, uint32_t* edges)
+{
+    uint64_t time = *start;
+    uint32_t index;
+
+    for (index = 0U; index < count; index++)
+    {
+        time += (uint64_t)ticks[index] * tickQ16;
+        edges[index] = (uint32_t)(time >> 16);
+    }
+
+    *start = time;
+}
+
+bool SENT_CODEC_RegistersCompute(uint32_t clockHz, uint32_t tickNs, uint32_t tolerancePercent, const SENT_CODEC_FORMAT* format, SENT_CODEC_REGISTERS* registers)
+{
+    uint32_t clocks = (uint32_t)((((uint64_t)clockHz * tickNs) + 500000000U) / 1000000000U);
+
+    if ((clocks == 0U) || (clocks > 0x10000U) || (tolerancePercent >= 100U) || (SENT_CODEC_FormatIsValid(format) == false))
+    {
+        return false;
+    }
+
+    registers->tickTime = clocks - 1U;
+    registers->frameTime = format->frameTicks;
+
+    /* The window must hold the nominal sync pulse, rounded inwards */
+    registers->syncMin = ((8U * clocks * (100U - tolerancePercent)) + 99U) / 100U;
+    registers->syncMax = (8U * clocks * (100U + tolerancePercent)) / 100U;
+
+    return (registers->syncMax <= 0xFFFFU);
+}
+
+void SENT_CODEC_DecoderInitialize(SENT_CODEC_DECODER* decoder, const SENT_CODEC_FORMAT* format, uint32_t syncMin, uint32_t syncMax)
+{
+    decoder->format = *format;
+    decoder->syncMin = syncMin;
+    decoder->syncMax = syncMax;
+    decoder->tickQ16 = 0U;
+    decoder->lastEdge = 0U;
+    decoder->edgeValid = false;
+    decoder->state = SENT_CODEC_STATE_SYNC;
+}
+
+SENT_CODEC_RESULT SENT_CODEC_EdgeProcess(SENT_CODEC_DECODER* decoder, uint32_t timestamp, SENT_CODEC_FRAME* frame)
+{
+    uint32_t nibbles = decoder->format.nibbles + 2U;
+    uint32_t period = timestamp - decoder->lastEdge;
+    bool isSync = (period >= decoder->syncMin) && (period <= decoder->syncMax);
+    bool isPause = (decoder->state > nibbles);
+    SENT_CODEC_RESULT result = SENT_CODEC_RESULT_PENDING;
+    uint32_t ticks;
+    uint32_t index;
+
+    if (decoder->edgeValid == false)
+    {
+        /* The first edge only starts the first pulse */
+        decoder->edgeValid = true;
+        decoder->lastEdge = timestamp;
+        return SENT_CODEC_RESULT_PENDING;
+    }
+    decoder->lastEdge = timestamp;
+
+    if ((decoder->state == SENT_CODEC_STATE_SYNC) || (isSync && (isPause == false)))
+    {
+        if (decoder->state != SENT_CODEC_STATE_SYNC)
+        {
+            /* Sync pulse in the middle of a frame */
+            result = SENT_CODEC_RESULT_FRAME_ERROR;
+        }
+
+        if (isSync)
+        {
+            decoder->tickQ16 = (uint32_t)(((uint64_t)period << 16) / SENT_CODEC_SYNC_TICKS);
+            decoder->state = 1U;
+        }
+        else
+        {
+            decoder->state = SENT_CODEC_STATE_SYNC;
+        }
+        return result;
+    }
+
+    ticks = (uint32_t)((((uint64_t)period << 16) + (decoder->tickQ16 / 2U)) / decoder->tickQ16);
+
+    if (isPause)
+    {
+        decoder->state = SENT_CODEC_STATE_SYNC;
+        return ((ticks >= SENT_CODEC_PAUSE_TICKS_MIN) && (ticks <= SENT_CODEC_PAUSE_TICKS_MAX)) ? SENT_CODEC_RESULT_PENDING : SENT_CODEC_RESULT_FRAME_ERROR;
+    }
+
+    if ((ticks < SENT_CODEC_NIBBLE_TICKS_MIN) || (ticks > SENT_CODEC_NIBBLE_TICKS_MAX))
+    {
+        decoder->state = SENT_CODEC_STATE_SYNC;
+        return SENT_CODEC_RESULT_FRAME_ERROR;
+    }
+
+    decoder->nibbles[decoder->state - 1U] = (uint8_t)(ticks - SENT_CODEC_NIBBLE_TICKS_MIN);
+    decoder->state++;
+
+    if (decoder->state > nibbles)
+    {
+        frame->status = decoder->nibbles[0];
+        for (index = 0U; index < decoder->format.nibbles; index++)
+        {
+            frame->data[index] = decoder->nibbles[index + 1U];
+        }
+        frame->crc = decoder->nibbles[nibbles - 1U];
+
+        /* Next is the pause pulse, or the sync pulse of the next frame */
+        if (decoder->format.frameTicks == 0U)
+        {
+            decoder->state = SENT_CODEC_STATE_SYNC;
+        }
+
+        result = (SENT_CODEC_Crc4(frame->data, decoder->format.nibbles, decoder->format.crcMode) == frame->crc) ?
+                 SENT_CODEC_RESULT_FRAME : SENT_CODEC_RESULT_CRC_ERROR;
+    }
+
+    return result;
+}
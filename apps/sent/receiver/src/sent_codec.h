@@ -0,0 +1,318 @@
+/*******************************************************************************
+  SENT Codec Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sent_codec.h
+
+  Summary:
+    Portable SAE J2716 SENT frame codec and timing model.
+
+  Description:
+    The codec encodes frames to pulse lengths in ticks, renders them as a
+    tick accurate waveform or as falling edge timestamps, and decodes frames
+    in software from falling edge timestamps with the same sync window as the
+    SENT receiver. It also computes the SENT register values from the clock
+    frequency and the tick time, instead of hand computed constants.
+
+    The module only depends on the C standard library: it builds on a Linux
+    host for unit tests and benchmarks as well as on the device, where the
+    decoder can run from input capture timestamps.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef SENT_CODEC_H
+#define SENT_CODEC_H
+
+// Section: Included Files
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// Section: Data Types
+
+/* Pulse lengths in ticks */
+#define SENT_CODEC_SYNC_TICKS           (56U)
+#define SENT_CODEC_NIBBLE_TICKS_MIN     (12U)
+#define SENT_CODEC_NIBBLE_TICKS_MAX     (27U)
+#define SENT_CODEC_PAUSE_TICKS_MIN      (12U)
+#define SENT_CODEC_PAUSE_TICKS_MAX      (768U)
+
+/* Low time at the start of each pulse */
+#define SENT_CODEC_LOW_TICKS            (5U)
+
+#define SENT_CODEC_DATA_NIBBLES_MAX     (6U)
+
+/* Sync, status, data nibbles, CRC and pause */
+#define SENT_CODEC_PULSES_MAX           (SENT_CODEC_DATA_NIBBLES_MAX + 4U)
+
+/* The receiver sync window registers count the sync pulse in 1/7 steps */
+#define SENT_CODEC_SYNC_REGISTER_TO_CLOCKS(value)   ((value) * 7U)
+
+/**
+ @enum     SENT_CODEC_CRC_MODE
+ @brief    CRC4 variants
+*/
+typedef enum
+{
+    /* CRC over the data nibbles followed by a zero nibble, SAE J2716 2008 and later */
+    SENT_CODEC_CRC_RECOMMENDED,
+
+    /* CRC over the data nibbles only, SAE J2716 2007 and earlier */
+    SENT_CODEC_CRC_LEGACY
+
+} SENT_CODEC_CRC_MODE;
+
+/**
+ @struct   SENT_CODEC_FORMAT
+ @brief    Frame format, shared by the transmitter and the receiver
+*/
+typedef struct
+{
+    /* Number of data nibbles, 1 to 6 */
+    uint32_t                nibbles;
+
+    SENT_CODEC_CRC_MODE     crcMode;
+
+    /* Constant frame length in ticks set by a pause pulse, 0 without pause pulse */
+    uint32_t                frameTicks;
+
+} SENT_CODEC_FORMAT;
+
+/**
+ @struct   SENT_CODEC_FRAME
+ @brief    Frame nibbles, each 0 to 15
+*/
+typedef struct
+{
+    uint8_t                 status;
+
+    uint8_t                 data[SENT_CODEC_DATA_NIBBLES_MAX];
+
+    uint8_t                 crc;
+
+} SENT_CODEC_FRAME;
+
+/**
+ @struct   SENT_CODEC_REGISTERS
+ @brief    SENT register values for a tick time
+*/
+typedef struct
+{
+    /* Transmitter SENTxCON2, clocks per tick minus 1 */
+    uint32_t                tickTime;
+
+    /* Transmitter SENTxCON3, frame length in ticks, 0 without pause pulse */
+    uint32_t                frameTime;
+
+    /* Receiver SENTxCON3 and SENTxCON2, sync pulse window */
+    uint32_t                syncMin;
+
+    uint32_t                syncMax;
+
+} SENT_CODEC_REGISTERS;
+
+/**
+ @enum     SENT_CODEC_RESULT
+ @brief    Decoder result for an edge
+*/
+typedef enum
+{
+    /* No frame completed */
+    SENT_CODEC_RESULT_PENDING,
+
+    /* Frame decoded with a valid CRC */
+    SENT_CODEC_RESULT_FRAME,
+
+    /* Frame decoded with a CRC mismatch */
+    SENT_CODEC_RESULT_CRC_ERROR,
+
+    /* Nibble or pause pulse out of range, the frame is discarded */
+    SENT_CODEC_RESULT_FRAME_ERROR
+
+} SENT_CODEC_RESULT;
+
+/**
+ @struct   SENT_CODEC_DECODER
+ @brief    Software decoder state. The members are private.
+*/
+typedef struct
+{
+    SENT_CODEC_FORMAT       format;
+
+    /* Sync pulse window in clocks */
+    uint32_t                syncMin;
+
+    uint32_t                syncMax;
+
+    /* Clocks per tick measured on the last sync pulse, 16 fractional bits */
+    uint32_t                tickQ16;
+
+    uint32_t                lastEdge;
+
+    bool                    edgeValid;
+
+    /* 0 waits for a sync, 1 to nibbles + 2 collects the nibbles, then the pause */
+    uint32_t                state;
+
+    uint8_t                 nibbles[SENT_CODEC_DATA_NIBBLES_MAX + 2U];
+
+} SENT_CODEC_DECODER;
+
+// Section: Interface Functions
+
+/**
+ * @brief      Computes the CRC4 of data nibbles.
+ *
+ * @details    Polynomial x^4 + x^3 + x^2 + 1 with seed 0101. The status nibble
+ *             is not covered.
+ *
+ * @param      nibbles - Data nibbles, 0 to 15
+ * @param      count   - Number of nibbles
+ * @param      mode    - CRC variant
+ *
+ * @return     CRC nibble
+ */
+uint8_t SENT_CODEC_Crc4(const uint8_t* nibbles, uint32_t count, SENT_CODEC_CRC_MODE mode);
+
+/**
+ * @brief      Encodes a frame to pulse lengths.
+ *
+ * @details    The CRC of the frame is computed and written back. The pulses
+ *             are the sync pulse, the status, data and CRC nibbles, and the
+ *             pause pulse when the format has a constant frame length.
+ *
+ * @param      format - Frame format
+ * @param      frame  - Frame, its CRC is updated
+ * @param      ticks  - Pulse lengths in ticks, SENT_CODEC_PULSES_MAX entries
+ *
+ * @return     Number of pulses, 0 when the format is invalid or the frame
+ *             does not leave room for a valid pause pulse
+ */
+uint32_t SENT_CODEC_FrameEncode(const SENT_CODEC_FORMAT* format, SENT_CODEC_FRAME* frame, uint16_t* ticks);
+
+/**
+ * @brief      Renders pulses as a sampled waveform.
+ *
+ * @details    Each pulse is low for SENT_CODEC_LOW_TICKS ticks and high for
+ *             the rest of its length, one byte per sample.
+ *
+ * @param      ticks          - Pulse lengths in ticks
+ * @param      count          - Number of pulses
+ * @param      samplesPerTick - Samples per tick, at least 1
+ * @param      levels         - Sample levels, 0 or 1
+ * @param      size           - Number of samples available in levels
+ *
+ * @return     Number of samples written, 0 when levels is too small
+ */
+uint32_t SENT_CODEC_WaveformRender(const uint16_t* ticks, uint32_t count, uint32_t samplesPerTick, uint8_t* levels, uint32_t size);
+
+/**
+ * @brief      Converts pulses to falling edge timestamps.
+ *
+ * @details    The timestamps are in clocks of the receiving timer. A tick
+ *             length that differs from the receiver nominal tick simulates
+ *             the transmitter clock tolerance.
+ *
+ * @param      ticks    - Pulse lengths in ticks
+ * @param      count    - Number of pulses
+ * @param      tickQ16  - Clocks per tick with 16 fractional bits
+ * @param      start    - Timestamp of the first falling edge, in clocks with 16 fractional bits,
+ *                        updated to the falling edge that ends the last pulse
+ * @param      edges    - Timestamps of the falling edges that end the pulses
+ *
+ * @return     None
+ */
+void SENT_CODEC_EdgesGenerate(const uint16_t* ticks, uint32_t count, uint32_t tickQ16, uint64_t* start, uint32_t* edges);
+
+/**
+ * @brief      Computes the SENT register values.
+ *
+ * @details    The transmitter tick time is the number of clocks per tick minus
+ *             1. The receiver accepts sync pulses between syncMin and syncMax,
+ *             8 times the clocks per tick less and more the tolerance.
+ *
+ * @param      clockHz          - SENT module clock in Hz
+ * @param      tickNs           - Tick time in ns, 3000 for the usual 3 us
+ * @param      tolerancePercent - Accepted tick time deviation, 20 for the SAE J2716 limit
+ * @param      format           - Frame format
+ * @param      registers        - Register values
+ *
+ * @return     true  - registers hold valid values
+ * @return     false - Tick time out of the clock range, or frame length too short
+ */
+bool SENT_CODEC_RegistersCompute(uint32_t clockHz, uint32_t tickNs, uint32_t tolerancePercent, const SENT_CODEC_FORMAT* format, SENT_CODEC_REGISTERS* registers);
+
+/**
+ * @brief      Initializes a software decoder.
+ *
+ * @param      decoder - Decoder
+ * @param      format  - Frame format
+ * @param      syncMin - Shortest sync pulse in clocks
+ * @param      syncMax - Longest sync pulse in clocks
+ *
+ * @remarks    SENT_CODEC_SYNC_REGISTER_TO_CLOCKS converts the receiver
+ *             register values to the window of the hardware receiver.
+ *
+ * @return     None
+ */
+void SENT_CODEC_DecoderInitialize(SENT_CODEC_DECODER* decoder, const SENT_CODEC_FORMAT* format, uint32_t syncMin, uint32_t syncMax);
+
+/**
+ * @brief      Decodes the next falling edge.
+ *
+ * @details    The tick length is measured on each sync pulse and the nibbles
+ *             are rounded to the nearest tick, as the hardware receiver does.
+ *             Except where the pause pulse is expected, a pulse in the sync
+ *             window starts a new frame.
+ *
+ * @param      decoder   - Decoder
+ * @param      timestamp - Falling edge timestamp in clocks
+ * @param      frame     - Frame, written when a frame completes
+ *
+ * @return     Decoding result \ref SENT_CODEC_RESULT
+ */
+SENT_CODEC_RESULT SENT_CODEC_EdgeProcess(SENT_CODEC_DECODER* decoder, uint32_t timestamp, SENT_CODEC_FRAME* frame);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif // SENT_CODEC_H
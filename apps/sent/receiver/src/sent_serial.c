@@ -0,0 +1,188 @@
+/*******************************************************************************
+  SENT Serial Message Decoder Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sent_serial.c
+
+  Summary:
+    Slow channel serial message decoder for SENT receive frames.
+
+  Description:
+    The decoder keeps status bits 2 and 3 of the last frames in two shift
+    registers and looks for a complete message after each frame.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// Section: Included Files
+
+#include "sent_serial.h"
+
+// Section: Local Objects
+
+#define SENT_SERIAL_STATUS_BIT2     (0x4U)
+#define SENT_SERIAL_STATUS_BIT3     (0x8U)
+
+#define SENT_SERIAL_SHORT_FRAMES    (16U)
+#define SENT_SERIAL_ENHANCED_FRAMES (18U)
+
+/* CRC4 x^4 + x^3 + x^2 + 1 and CRC6 x^6 + x^4 + x^3 + 1, with the J2716 seeds */
+#define SENT_SERIAL_CRC4_POLYNOMIAL (0x1DU)
+#define SENT_SERIAL_CRC4_SEED       (0x5U)
+#define SENT_SERIAL_CRC6_POLYNOMIAL (0x59U)
+#define SENT_SERIAL_CRC6_SEED       (0x15U)
+
+// Section: Local Functions
+
+/* Remainder of the seed and message bits, augmented with width zero bits, most significant bit first */
+static uint32_t SENT_SERIAL_Crc(uint32_t message, uint32_t length, uint32_t polynomial, uint32_t width, uint32_t seed)
+{
+    uint32_t crc = seed;
+    uint32_t index;
+
+    message <<= width;
+    for (index = length + width; index > 0U; index--)
+    {
+        crc = (crc << 1) | ((message >> (index - 1U)) & 1U);
+        if ((crc & (1UL << width)) != 0U)
+        {
+            crc ^= polynomial;
+        }
+    }
+
+    return crc;
+}
+
+/* Frames 1 to 16: bit 3 is 1 in the first frame only, bit 2 carries ID, data and CRC4 */
+static bool SENT_SERIAL_ShortDecode(SENT_SERIAL_DECODER* decoder, SENT_SERIAL_MESSAGE* message)
+{
+    uint32_t bits = decoder->bit2 & 0xFFFFU;
+
+    if ((decoder->frames < SENT_SERIAL_SHORT_FRAMES) || ((decoder->bit3 & 0xFFFFU) != 0x8000U))
+    {
+        return false;
+    }
+
+    if (SENT_SERIAL_Crc(bits >> 4, 12U, SENT_SERIAL_CRC4_POLYNOMIAL, 4U, SENT_SERIAL_CRC4_SEED) != (bits & 0xFU))
+    {
+        decoder->crcErrors++;
+        return false;
+    }
+
+    message->format = SENT_SERIAL_SHORT;
+    message->id = (uint8_t)(bits >> 12);
+    message->data = (uint16_t)((bits >> 4) & 0xFFU);
+
+    return true;
+}
+
+/* Frames 1 to 18: bit 3 is 111111 0 C ID/data 0 ID/data 0, bit 2 carries CRC6 and 12 data bits */
+static bool SENT_SERIAL_EnhancedDecode(SENT_SERIAL_DECODER* decoder, SENT_SERIAL_MESSAGE* message)
+{
+    uint32_t bit2 = decoder->bit2 & 0x3FFFFU;
+    uint32_t bit3 = decoder->bit3 & 0x3FFFFU;
+    uint32_t crcData = 0U;
+    uint32_t index;
+
+    if ((decoder->frames < SENT_SERIAL_ENHANCED_FRAMES) || ((bit3 & 0x3F821U) != 0x3F000U))
+    {
+        return false;
+    }
+
+    /* Frames 7 to 18, bit 2 then bit 3 of each frame */
+    for (index = 12U; index > 0U; index--)
+    {
+        crcData = (crcData << 2) | (((bit2 >> (index - 1U)) & 1U) << 1) | ((bit3 >> (index - 1U)) & 1U);
+    }
+
+    if (SENT_SERIAL_Crc(crcData, 24U, SENT_SERIAL_CRC6_POLYNOMIAL, 6U, SENT_SERIAL_CRC6_SEED) != (bit2 >> 12))
+    {
+        decoder->crcErrors++;
+        return false;
+    }
+
+    /* The configuration bit of frame 8 selects the ID and data sizes */
+    if ((bit3 & 0x400U) == 0U)
+    {
+        message->format = SENT_SERIAL_ENHANCED_12BIT;
+        message->id = (uint8_t)((((bit3 >> 6) & 0xFU) << 4) | ((bit3 >> 1) & 0xFU));
+        message->data = (uint16_t)(bit2 & 0xFFFU);
+    }
+    else
+    {
+        message->format = SENT_SERIAL_ENHANCED_16BIT;
+        message->id = (uint8_t)((bit3 >> 6) & 0xFU);
+        message->data = (uint16_t)((((bit3 >> 1) & 0xFU) << 12) | (bit2 & 0xFFFU));
+    }
+
+    return true;
+}
+
+// Section: SENT Serial Message Decoder Implementation
+
+void SENT_SERIAL_Initialize(SENT_SERIAL_DECODER* decoder)
+{
+    decoder->bit2 = 0U;
+    decoder->bit3 = 0U;
+    decoder->frames = 0U;
+    decoder->nextSequence = 0U;
+    decoder->crcErrors = 0U;
+}
+
+bool SENT_SERIAL_FrameProcess(SENT_SERIAL_DECODER* decoder, const SENT_RECEIVE_FRAME* frame, SENT_SERIAL_MESSAGE* message)
+{
+    uint32_t status = frame->data.status;
+    bool decoded;
+
+    /* A lost frame breaks the message it belongs to */
+    if (frame->sequence != decoder->nextSequence)
+    {
+        decoder->frames = 0U;
+    }
+    decoder->nextSequence = frame->sequence + 1U;
+
+    decoder->bit2 = (decoder->bit2 << 1) | (((status & SENT_SERIAL_STATUS_BIT2) != 0U) ? 1U : 0U);
+    decoder->bit3 = (decoder->bit3 << 1) | (((status & SENT_SERIAL_STATUS_BIT3) != 0U) ? 1U : 0U);
+    if (decoder->frames < SENT_SERIAL_ENHANCED_FRAMES)
+    {
+        decoder->frames++;
+    }
+
+    decoded = SENT_SERIAL_EnhancedDecode(decoder, message);
+    if (decoded == false)
+    {
+        decoded = SENT_SERIAL_ShortDecode(decoder, message);
+    }
+
+    if (decoded)
+    {
+        /* The frames of a decoded message do not start another one */
+        decoder->frames = 0U;
+    }
+
+    return decoded;
+}
@@ -0,0 +1,155 @@
+/*******************************************************************************
+  SENT Serial Message Decoder Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    sent_serial.h
+
+  Summary:
+    Slow channel serial message decoder for SENT receive frames.
+
+  Description:
+    SAE J2716 sensors send slow channel messages one bit per frame in the
+    status nibble, next to the fast channel data. The decoder takes the
+    frames read from the receive queue in order and returns each message
+    once its last frame is received and its CRC is checked:
+
+    - Short serial message: 16 frames, 4-bit ID, 8-bit data, CRC4
+    - Enhanced serial message: 18 frames, 8-bit ID and 12-bit data or
+      4-bit ID and 16-bit data, CRC6
+
+    A gap in the frame sequence numbers discards the partial message.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef SENT_SERIAL_H
+#define SENT_SERIAL_H
+
+// Section: Included Files
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "definitions.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// Section: Data Types
+
+/**
+ @enum     SENT_SERIAL_FORMAT
+ @brief    Serial message formats
+*/
+typedef enum
+{
+    /* 4-bit ID, 8-bit data */
+    SENT_SERIAL_SHORT,
+
+    /* 8-bit ID, 12-bit data */
+    SENT_SERIAL_ENHANCED_12BIT,
+
+    /* 4-bit ID, 16-bit data */
+    SENT_SERIAL_ENHANCED_16BIT
+
+} SENT_SERIAL_FORMAT;
+
+/**
+ @struct   SENT_SERIAL_MESSAGE
+ @brief    Decoded serial message
+*/
+typedef struct
+{
+    SENT_SERIAL_FORMAT      format;
+
+    uint8_t                 id;
+
+    uint16_t                data;
+
+} SENT_SERIAL_MESSAGE;
+
+/**
+ @struct   SENT_SERIAL_DECODER
+ @brief    Decoder state, one per SENT channel. The members are private
+           except crcErrors, the number of messages discarded on a CRC error.
+*/
+typedef struct
+{
+    /* Status bits 2 and 3 of the last frames, the newest in bit 0 */
+    uint32_t                bit2;
+
+    uint32_t                bit3;
+
+    /* Number of consecutive frames in the history */
+    uint32_t                frames;
+
+    uint32_t                nextSequence;
+
+    uint32_t                crcErrors;
+
+} SENT_SERIAL_DECODER;
+
+// Section: Interface Functions
+
+/**
+ * @brief      Initializes a decoder, the next frame starts a new history.
+ *
+ * @param      decoder - Decoder
+ *
+ * @return     None
+ */
+void SENT_SERIAL_Initialize(SENT_SERIAL_DECODER* decoder);
+
+/**
+ * @brief      Adds a received frame to the decoder.
+ *
+ * @details    The frames of a channel must be passed in the order they are
+ *             read from the receive queue. Short and enhanced messages are
+ *             both recognized, a sensor sends only one of them.
+ *
+ * @param      decoder - Decoder
+ * @param      frame   - Frame read from the receive queue
+ * @param      message - Message decoded, written only when the function returns true
+ *
+ * @return     true  - frame completed a message with a valid CRC
+ * @return     false - No message completed
+ */
+bool SENT_SERIAL_FrameProcess(SENT_SERIAL_DECODER* decoder, const SENT_RECEIVE_FRAME* frame, SENT_SERIAL_MESSAGE* message);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif // SENT_SERIAL_H
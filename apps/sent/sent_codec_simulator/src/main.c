@@ -0,0 +1,399 @@
+/*******************************************************************************
+  SENT Codec Simulator Main Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    main.c
+
+  Summary:
+    Checks the SENT codec of the receiver demo on the build host.
+
+  Description:
+    Builds sent_codec.c of the SENT receiver application for the build host.
+    The CRC4 is compared with a bitwise reference, the register values with
+    the ones of the demo configuration, and random frames are encoded, turned
+    into falling edges with a transmitter tick error and decoded again.
+    Corrupted frames must be reported. The exit status tells whether all the
+    checks passed.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/* clock_gettime */
+#define _POSIX_C_SOURCE 199309L
+
+// Section: Included Files
+
+#include <stddef.h>                     // Defines NULL
+#include <stdbool.h>                    // Defines true
+#include <stdlib.h>                     // Defines EXIT_FAILURE
+#include <stdio.h>
+#include <time.h>
+#include "sent_codec.h"
+
+// Section: Main Entry Point
+
+/* Demo configuration: 8 MHz SENT clock, 1.5 us tick, 20 % sync tolerance */
+#define APP_CLOCK_HZ                    (8000000U)
+#define APP_TICK_NS                     (1500U)
+#define APP_TOLERANCE_PERCENT           (20U)
+
+/* Register values generated for the demo, transmitter SENT1CON2 and
+   receiver SENT2CON3 and SENT2CON2 */
+#define APP_TICK_TIME                   (0xBU)
+#define APP_SYNC_MIN                    (0x4DU)
+#define APP_SYNC_MAX                    (0x73U)
+
+/* Random frames, and largest transmitter tick error in 0.1 % steps */
+#define APP_FRAMES                      (8000U)
+#define APP_TICK_ERROR_MAX              (150)
+
+/* One frame in APP_CORRUPT_RATE has a data nibble changed, or a nibble
+   stretched out of range */
+#define APP_CORRUPT_RATE                (8U)
+
+/* Random CRC inputs compared with the bitwise reference */
+#define APP_CRC_RUNS                    (20000U)
+
+#define APP_SAMPLES_PER_TICK            (4U)
+
+typedef enum
+{
+    APP_CORRUPT_NONE,
+
+    APP_CORRUPT_CRC,
+
+    APP_CORRUPT_FRAMING
+
+} APP_CORRUPT;
+
+static uint32_t randomState = 0x2545F491U;
+static uint32_t failures = 0U;
+
+static uint32_t APP_Random(void)
+{
+    /* xorshift32, the runs are reproducible */
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+
+    return randomState;
+}
+
+static uint64_t APP_TimeNs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+}
+
+static void APP_Check(bool passed, const char* name)
+{
+    printf("%-52s %s\n", name, passed ? "pass" : "FAIL");
+
+    if (!passed)
+    {
+        failures++;
+    }
+}
+
+/* Remainder of the division by x^4 + x^3 + x^2 + 1, one bit at a time */
+static uint8_t APP_Crc4Reference(const uint8_t* nibbles, uint32_t count, SENT_CODEC_CRC_MODE mode)
+{
+    uint32_t remainder = 0x5U;
+    uint32_t index;
+    uint32_t bit;
+    uint32_t total = (mode == SENT_CODEC_CRC_RECOMMENDED) ? (count + 1U) : count;
+
+    for (index = 0U; index < total; index++)
+    {
+        remainder = (remainder << 4) | ((index < count) ? (nibbles[index] & 0xFU) : 0U);
+
+        for (bit = 7U; bit >= 4U; bit--)
+        {
+            if ((remainder & (1UL << bit)) != 0U)
+            {
+                remainder ^= 0x1DUL << (bit - 4U);
+            }
+        }
+    }
+
+    return (uint8_t)remainder;
+}
+
+static void APP_Crc4Check(void)
+{
+    uint8_t nibbles[SENT_CODEC_DATA_NIBBLES_MAX];
+    SENT_CODEC_CRC_MODE mode;
+    uint32_t count;
+    uint32_t run;
+    uint32_t index;
+    bool passed = true;
+
+    for (run = 0U; run < APP_CRC_RUNS; run++)
+    {
+        count = 1U + (APP_Random() % SENT_CODEC_DATA_NIBBLES_MAX);
+        mode = ((run & 1U) == 0U) ? SENT_CODEC_CRC_RECOMMENDED : SENT_CODEC_CRC_LEGACY;
+
+        for (index = 0U; index < count; index++)
+        {
+            nibbles[index] = (uint8_t)(APP_Random() & 0xFU);
+        }
+
+        if (SENT_CODEC_Crc4(nibbles, count, mode) != APP_Crc4Reference(nibbles, count, mode))
+        {
+            passed = false;
+        }
+    }
+
+    APP_Check(passed, "CRC4 against the bitwise reference");
+}
+
+static void APP_RegistersCheck(void)
+{
+    SENT_CODEC_FORMAT format = { 2U, SENT_CODEC_CRC_RECOMMENDED, 0U };
+    SENT_CODEC_REGISTERS registers;
+    bool passed;
+
+    passed = SENT_CODEC_RegistersCompute(APP_CLOCK_HZ, APP_TICK_NS, APP_TOLERANCE_PERCENT, &format, &registers);
+    passed = passed && (registers.tickTime == APP_TICK_TIME) && (registers.frameTime == 0U)
+             && (registers.syncMin == APP_SYNC_MIN) && (registers.syncMax == APP_SYNC_MAX);
+
+    printf("tick time 0x%lX, sync window 0x%lX to 0x%lX\n", (unsigned long)registers.tickTime,
+           (unsigned long)registers.syncMin, (unsigned long)registers.syncMax);
+    APP_Check(passed, "registers of the demo configuration");
+
+    /* A clock too slow for the tick, and a frame length too short for a pause */
+    passed = (SENT_CODEC_RegistersCompute(1000U, APP_TICK_NS, APP_TOLERANCE_PERCENT, &format, &registers) == false);
+    format.frameTicks = 100U;
+    passed = passed && (SENT_CODEC_RegistersCompute(APP_CLOCK_HZ, APP_TICK_NS, APP_TOLERANCE_PERCENT, &format, &registers) == false);
+    APP_Check(passed, "invalid register requests rejected");
+}
+
+static void APP_WaveformCheck(void)
+{
+    SENT_CODEC_FORMAT format = { 6U, SENT_CODEC_CRC_RECOMMENDED, 0U };
+    SENT_CODEC_FRAME frame = { 0x9U, { 0x1U, 0x2U, 0x3U, 0xCU, 0xDU, 0xFU }, 0U };
+    static uint8_t levels[SENT_CODEC_PULSES_MAX * SENT_CODEC_PAUSE_TICKS_MAX * APP_SAMPLES_PER_TICK];
+    uint16_t ticks[SENT_CODEC_PULSES_MAX];
+    uint32_t count = SENT_CODEC_FrameEncode(&format, &frame, ticks);
+    uint32_t expected = 0U;
+    uint32_t falling = 0U;
+    uint32_t samples;
+    uint32_t index;
+
+    for (index = 0U; index < count; index++)
+    {
+        expected += (uint32_t)ticks[index] * APP_SAMPLES_PER_TICK;
+    }
+
+    samples = SENT_CODEC_WaveformRender(ticks, count, APP_SAMPLES_PER_TICK, levels, sizeof(levels));
+    for (index = 1U; index < samples; index++)
+    {
+        if ((levels[index - 1U] == 1U) && (levels[index] == 0U))
+        {
+            falling++;
+        }
+    }
+
+    APP_Check((count != 0U) && (samples == expected) && (levels[0] == 0U) && (falling == (count - 1U)),
+              "waveform length and falling edges");
+    APP_Check(SENT_CODEC_WaveformRender(ticks, count, APP_SAMPLES_PER_TICK, levels, expected - 1U) == 0U,
+              "waveform rejected when the buffer is too small");
+}
+
+static void APP_FormatRandom(SENT_CODEC_FORMAT* format)
+{
+    format->nibbles = 1U + (APP_Random() % SENT_CODEC_DATA_NIBBLES_MAX);
+    format->crcMode = ((APP_Random() & 1U) == 0U) ? SENT_CODEC_CRC_RECOMMENDED : SENT_CODEC_CRC_LEGACY;
+    format->frameTicks = 0U;
+
+    if ((APP_Random() & 1U) == 0U)
+    {
+        /* Longest frame, shortest pause and some margin */
+        format->frameTicks = SENT_CODEC_SYNC_TICKS + ((format->nibbles + 2U) * SENT_CODEC_NIBBLE_TICKS_MAX)
+                             + SENT_CODEC_PAUSE_TICKS_MIN + (APP_Random() % 200U);
+    }
+}
+
+/* Encodes random frames in one edge stream and decodes it */
+static void APP_StreamCheck(const char* name, uint64_t start)
+{
+    SENT_CODEC_FORMAT format;
+    SENT_CODEC_FRAME frame;
+    SENT_CODEC_DECODER decoder;
+    SENT_CODEC_RESULT results[SENT_CODEC_PULSES_MAX];
+    SENT_CODEC_FRAME decodedFrames[SENT_CODEC_PULSES_MAX];
+    APP_CORRUPT corrupt;
+    uint16_t ticks[SENT_CODEC_PULSES_MAX];
+    uint32_t edges[SENT_CODEC_PULSES_MAX];
+    uint32_t tickQ16;
+    uint32_t count;
+    uint32_t index;
+    uint32_t pulse;
+    uint32_t frames;
+    int32_t error;
+    uint32_t clean = 0U;
+    uint32_t decodedCount = 0U;
+    uint32_t crcExpected = 0U;
+    uint32_t crcErrors = 0U;
+    uint32_t framingExpected = 0U;
+    uint32_t framingErrors = 0U;
+    uint32_t mismatches = 0U;
+    uint32_t edgeCount = 0U;
+    uint64_t decodeNs = 0U;
+    uint64_t begin;
+    bool passed;
+    char label[64];
+
+    /* One format per stream, the decoder is not reconfigured between frames */
+    APP_FormatRandom(&format);
+    SENT_CODEC_DecoderInitialize(&decoder, &format, SENT_CODEC_SYNC_REGISTER_TO_CLOCKS(APP_SYNC_MIN),
+                                 SENT_CODEC_SYNC_REGISTER_TO_CLOCKS(APP_SYNC_MAX));
+
+    /* Falling edge that starts the first sync pulse */
+    (void)SENT_CODEC_EdgeProcess(&decoder, (uint32_t)(start >> 16), &decodedFrames[0]);
+
+    for (frames = 0U; frames < (APP_FRAMES / 4U); frames++)
+    {
+        frame.status = (uint8_t)(APP_Random() & 0xFU);
+        for (index = 0U; index < SENT_CODEC_DATA_NIBBLES_MAX; index++)
+        {
+            frame.data[index] = (uint8_t)(APP_Random() & 0xFU);
+        }
+
+        count = SENT_CODEC_FrameEncode(&format, &frame, ticks);
+        if (count == 0U)
+        {
+            failures++;
+            break;
+        }
+
+        corrupt = APP_CORRUPT_NONE;
+        if ((APP_Random() % APP_CORRUPT_RATE) == 0U)
+        {
+            /* Any data or CRC nibble, the status nibble is not covered */
+            pulse = 2U + (APP_Random() % (format.nibbles + 1U));
+
+            if ((APP_Random() & 1U) == 0U)
+            {
+                ticks[pulse] = (uint16_t)(SENT_CODEC_NIBBLE_TICKS_MIN + ((ticks[pulse] - SENT_CODEC_NIBBLE_TICKS_MIN + 1U + (APP_Random() % 15U)) % 16U));
+                corrupt = APP_CORRUPT_CRC;
+                crcExpected++;
+            }
+            else
+            {
+                ticks[pulse] = (uint16_t)(SENT_CODEC_NIBBLE_TICKS_MAX + 3U);
+                corrupt = APP_CORRUPT_FRAMING;
+                framingExpected++;
+            }
+        }
+        else
+        {
+            clean++;
+        }
+
+        /* Transmitter clock error, receiver nominal tick of APP_TICK_TIME + 1 clocks */
+        error = (int32_t)(APP_Random() % ((2U * APP_TICK_ERROR_MAX) + 1U)) - APP_TICK_ERROR_MAX;
+        tickQ16 = (uint32_t)((((int64_t)(APP_TICK_TIME + 1U) << 16) * (1000 + error)) / 1000);
+        SENT_CODEC_EdgesGenerate(ticks, count, tickQ16, &start, edges);
+
+        begin = APP_TimeNs();
+        for (index = 0U; index < count; index++)
+        {
+            results[index] = SENT_CODEC_EdgeProcess(&decoder, edges[index], &decodedFrames[index]);
+        }
+        decodeNs += APP_TimeNs() - begin;
+        edgeCount += count;
+
+        for (index = 0U; index < count; index++)
+        {
+            if (results[index] == SENT_CODEC_RESULT_FRAME)
+            {
+                decodedCount++;
+                if ((corrupt != APP_CORRUPT_NONE) || (decodedFrames[index].status != frame.status)
+                    || (decodedFrames[index].crc != frame.crc))
+                {
+                    mismatches++;
+                }
+                for (pulse = 0U; pulse < format.nibbles; pulse++)
+                {
+                    if (decodedFrames[index].data[pulse] != frame.data[pulse])
+                    {
+                        mismatches++;
+                    }
+                }
+            }
+            else if (results[index] == SENT_CODEC_RESULT_CRC_ERROR)
+            {
+                crcErrors++;
+            }
+            else if (results[index] == SENT_CODEC_RESULT_FRAME_ERROR)
+            {
+                framingErrors++;
+            }
+            else
+            {
+                /* Pending */
+            }
+        }
+    }
+
+    /* A broken frame may also be reported again at the sync pulse that follows */
+    passed = (decodedCount == clean) && (mismatches == 0U) && (crcErrors == crcExpected)
+             && (framingErrors >= framingExpected) && (framingErrors <= (2U * framingExpected));
+
+    (void)snprintf(label, sizeof(label), "%s, %lu nibble(s)%s%s", name, (unsigned long)format.nibbles,
+                   (format.crcMode == SENT_CODEC_CRC_LEGACY) ? ", legacy CRC" : "",
+                   (format.frameTicks != 0U) ? ", pause" : "");
+    APP_Check(passed, label);
+    printf("    %lu frames, %lu decoded, %lu CRC and %lu framing error(s), %.1f ns per edge\n",
+           (unsigned long)frames, (unsigned long)decodedCount, (unsigned long)crcErrors,
+           (unsigned long)framingErrors, (edgeCount != 0U) ? (double)decodeNs / (double)edgeCount : 0.0);
+}
+
+int main ( void )
+{
+    printf("SENT clock %u Hz, tick %u ns, sync tolerance %u %%, tick error up to %d.%d %%\n\n",
+           APP_CLOCK_HZ, APP_TICK_NS, APP_TOLERANCE_PERCENT, APP_TICK_ERROR_MAX / 10, APP_TICK_ERROR_MAX % 10);
+
+    APP_Crc4Check();
+    APP_RegistersCheck();
+    APP_WaveformCheck();
+
+    APP_StreamCheck("stream 1", 0U);
+    APP_StreamCheck("stream 2", 0U);
+    APP_StreamCheck("stream 3", 0U);
+
+    /* The 32-bit timestamps wrap around during the stream */
+    APP_StreamCheck("stream 4 over the timer wrap", (uint64_t)0xFFFF0000U << 16);
+
+    printf("\n%lu check(s) failed\n", (unsigned long)failures);
+
+    return (failures == 0U) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
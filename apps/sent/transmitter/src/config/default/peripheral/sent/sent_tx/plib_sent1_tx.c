@@ -51,6 +51,13 @@ static volatile bool bDataTransmitted = true;
 
 volatile static SENT_TRANSMIT_COMPLETE_OBJECT txCompleteObj;
 
+/* Transmit queue of packed SENT1DAT words, written by the application and read by the interrupt */
+static volatile uint32_t sent1Queue[SENT1_TRANSMIT_QUEUE_SIZE];
+static volatile uint32_t sent1WriteIndex = 0U;
+static volatile uint32_t sent1ReadIndex = 0U;
+static volatile uint32_t sent1Underruns = 0U;
+static volatile bool sent1Streaming = false;
+
 #define SENT1CON1_NIBCNT_ONE      ((uint32_t)(_SENT1CON1_NIBCNT_MASK & ((uint32_t)(1) << _SENT1CON1_NIBCNT_POSITION))) 
 #define SENT1CON1_NIBCNT_TWO      ((uint32_t)(_SENT1CON1_NIBCNT_MASK & ((uint32_t)(2) << _SENT1CON1_NIBCNT_POSITION))) 
 #define SENT1CON1_NIBCNT_THREE      ((uint32_t)(_SENT1CON1_NIBCNT_MASK & ((uint32_t)(3) << _SENT1CON1_NIBCNT_POSITION))) 
@@ -58,6 +65,32 @@ volatile static SENT_TRANSMIT_COMPLETE_OBJECT txCompleteObj;
 #define SENT1CON1_NIBCNT_FIVE      ((uint32_t)(_SENT1CON1_NIBCNT_MASK & ((uint32_t)(5) << _SENT1CON1_NIBCNT_POSITION))) 
 #define SENT1CON1_NIBCNT_SIX      ((uint32_t)(_SENT1CON1_NIBCNT_MASK & ((uint32_t)(6) << _SENT1CON1_NIBCNT_POSITION))) 
 
+#define SENT1DAT_FIELD(value, field)    (((uint32_t)(value) << _SENT1DAT_##field##_POSITION) & _SENT1DAT_##field##_MASK)
+
+// Section: Local Functions
+
+/* All the nibbles in one word, so that SENT1DAT is written once instead of once per field */
+static uint32_t SENT1_FramePack(const SENT_DATA_TRANSMIT *sentData)
+{
+    return (SENT1DAT_FIELD(sentData->status, STAT)
+            | SENT1DAT_FIELD(sentData->data1, DATA1)
+            | SENT1DAT_FIELD(sentData->data2, DATA2)
+            | SENT1DAT_FIELD(sentData->data3, DATA3)
+            | SENT1DAT_FIELD(sentData->data4, DATA4)
+            | SENT1DAT_FIELD(sentData->data5, DATA5)
+            | SENT1DAT_FIELD(sentData->data6, DATA6)
+            | SENT1DAT_FIELD(sentData->crc, CRC));
+}
+
+static void SENT1_FrameWrite(uint32_t frame)
+{
+    SENT1DAT = frame;
+    if(SENT1CON1bits.TXM == 1U)
+    {
+        SENT1STATbits.SYNCTXEN = 1U;
+    }
+}
+
 // Section: SENT1 Module APIs
 
 void SENT1_Initialize(void)
@@ -78,6 +111,11 @@ void SENT1_Initialize(void)
     IEC3bits.SENT1EIE = 1U;
 	
 	txCompleteObj.callback_fn = NULL;
+
+    sent1WriteIndex = 0U;
+    sent1ReadIndex = 0U;
+    sent1Underruns = 0U;
+    sent1Streaming = false;
 }
 
 void SENT1_Deinitialize(void)
@@ -114,17 +152,66 @@ void SENT1_TransmitModeSet(SENT_TRANSMIT_MODE mode)
 void SENT1_Transmit(const SENT_DATA_TRANSMIT *sentData)
 {
     bDataTransmitted = false;
-    SENT1DATbits.STAT = sentData->status;
-    SENT1DATbits.DATA1 = sentData->data1;
-    SENT1DATbits.DATA2 = sentData->data2;
-    SENT1DATbits.DATA3 = sentData->data3;
-    SENT1DATbits.DATA4 = sentData->data4;
-    SENT1DATbits.DATA5 = sentData->data5;
-    SENT1DATbits.DATA6 = sentData->data6;
-    if(SENT1CON1bits.TXM == 1U)
+    SENT1_FrameWrite(SENT1_FramePack(sentData));
+}
+
+uint32_t SENT1_TransmitQueue(const SENT_DATA_TRANSMIT *sentData, uint32_t count)
+{
+    uint32_t interruptEnabled = IEC3bits.SENT1IE;
+    uint32_t writeIndex;
+    uint32_t index;
+
+    IEC3bits.SENT1IE = 0U;
+
+    writeIndex = sent1WriteIndex;
+    if (count > (SENT1_TRANSMIT_QUEUE_SIZE - (writeIndex - sent1ReadIndex)))
     {
-        SENT1STATbits.SYNCTXEN = 1U;
+        count = SENT1_TRANSMIT_QUEUE_SIZE - (writeIndex - sent1ReadIndex);
     }
+
+    for (index = 0U; index < count; index++)
+    {
+        sent1Queue[(writeIndex + index) & (SENT1_TRANSMIT_QUEUE_SIZE - 1U)] = SENT1_FramePack(&sentData[index]);
+    }
+    sent1WriteIndex = writeIndex + count;
+
+    if (count != 0U)
+    {
+        bDataTransmitted = false;
+
+        /* An idle synchronous transmitter has no interrupt coming to load the
+           first frame. Otherwise the interrupt loads it at the end of the
+           current frame. */
+        if ((SENT1CON1bits.TXM == 1U) && (SENT1STATbits.SYNCTXEN == 0U) && (IFS3bits.SENT1IF == 0U))
+        {
+            SENT1_FrameWrite(sent1Queue[sent1ReadIndex & (SENT1_TRANSMIT_QUEUE_SIZE - 1U)]);
+            sent1ReadIndex++;
+            sent1Streaming = true;
+        }
+    }
+
+    IEC3bits.SENT1IE = interruptEnabled;
+
+    return count;
+}
+
+uint32_t SENT1_TransmitQueueFreeGet(void)
+{
+    return (SENT1_TRANSMIT_QUEUE_SIZE - (sent1WriteIndex - sent1ReadIndex));
+}
+
+void SENT1_TransmitQueueFlush(void)
+{
+    uint32_t interruptEnabled = IEC3bits.SENT1IE;
+
+    IEC3bits.SENT1IE = 0U;
+    sent1WriteIndex = sent1ReadIndex;
+    IEC3bits.SENT1IE = interruptEnabled;
+}
+
+uint32_t SENT1_TransmitUnderrunCountGet(void)
+{
+    return sent1Underruns;
 }
 
 bool SENT1_IsTransmissionComplete(void)
@@ -146,12 +233,41 @@ void SENT1_TransmitCompleteCallbackRegister(SENT_TRANSMIT_COMPLETE_CALLBACK call
 
 void __attribute__ ( ( used ) ) SENT1_InterruptHandler( void )
 {	
+    uint32_t readIndex = sent1ReadIndex;
+    bool frameLoaded = false;
+
+    /* The next frame is loaded first, the transmitter starts it after the current one */
+    if (readIndex != sent1WriteIndex)
+    {
+        SENT1_FrameWrite(sent1Queue[readIndex & (SENT1_TRANSMIT_QUEUE_SIZE - 1U)]);
+        sent1ReadIndex = readIndex + 1U;
+        sent1Streaming = true;
+        frameLoaded = true;
+    }
+    else if (sent1Streaming)
+    {
+        /* The queue ran dry, the asynchronous transmitter repeats the last frame */
+        sent1Streaming = false;
+        if (SENT1CON1bits.TXM == 0U)
+        {
+            sent1Underruns++;
+        }
+    }
+    else
+    {
+        /* Nothing queued */
+    }
+
 	if(txCompleteObj.callback_fn != NULL )
     {
         uintptr_t context = txCompleteObj.context;
         txCompleteObj.callback_fn(context);
     }
-	if(SENT1CON1bits.TXM == 0U)
+	if(frameLoaded)
+    {
+        bDataTransmitted = false;
+    }
+	else if(SENT1CON1bits.TXM == 0U)
     {
         bDataTransmitted = true;
     }
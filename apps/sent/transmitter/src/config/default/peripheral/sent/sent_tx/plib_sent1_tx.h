@@ -59,6 +59,11 @@
 #include <stdint.h>
 #include "plib_sent_tx_common.h"
 
+// Section: Macro Definitions
+
+/* Depth of the transmit queue in frames, a power of 2 */
+#define SENT1_TRANSMIT_QUEUE_SIZE   (16U)
+
 // Section: SENT1 PLIB Routines
  
 /**
@@ -202,8 +207,9 @@ void SENT1_TransmitModeSet(SENT_TRANSMIT_MODE mode);
  * @brief    Transmits the data to the receiver
  *
  * @details  This function is responsible for transmitting data for the
- * SENT peripheral. The function will handle the reception process and return the
- * received data.
+ * SENT peripheral. The nibbles are packed and written to SENT1DAT at once.
+ * The frame bypasses the transmit queue, SENT1_TransmitQueue should be used
+ * while queued frames are being sent.
  *
  * @pre  The SENT1 peripheral must have been initialized using the SENT1_Initialize API.
  * The peripheral should be enabled using the SENT1_Enable() API.
@@ -322,6 +328,72 @@ SENT_TRANSMIT_STATUS SENT1_TransmitStatusGet(void);
  * @remarks     None  
  */
 void SENT1_TransmitCompleteCallbackRegister(SENT_TRANSMIT_COMPLETE_CALLBACK callback_fn, uintptr_t context);
+
+/**
+ * @brief    Queues frames for transmission.
+ *
+ * @details  The frames are packed and queued, the function does not wait. The
+ * SENT1 interrupt at the end of each frame loads the next queued frame, so
+ * that the frames are sent back to back without the application. An idle
+ * synchronous transmitter is started at once.
+ *
+ * In asynchronous mode, the transmitter repeats the last frame when the queue
+ * runs dry, this is counted as an underrun.
+ *
+ * @pre  The SENT1 peripheral must have been initialized using the SENT1_Initialize API.
+ *
+ * @param[in] sentData  Frames to transmit
+ * @param[in] count     Number of frames
+ *
+ * @return   Number of frames queued, less than count when the queue is full
+ *
+ * @b Example:
+ * @code
+ *    SENT_DATA_TRANSMIT frames[4];
+ *    uint32_t queued = 0U;
+ *    while (queued < 4U)
+ *    {
+ *        queued += SENT1_TransmitQueue(&frames[queued], 4U - queued);
+ *    }
+ * @endcode
+ *
+ * @remarks None
+ */
+uint32_t SENT1_TransmitQueue(const SENT_DATA_TRANSMIT *sentData, uint32_t count);
+
+/**
+ * @brief    Returns the number of frames that can be queued.
+ *
+ * @param    none
+ *
+ * @return   Number of free entries, up to SENT1_TRANSMIT_QUEUE_SIZE
+ *
+ * @remarks None
+ */
+uint32_t SENT1_TransmitQueueFreeGet(void);
+
+/**
+ * @brief    Discards the frames not yet loaded in the transmitter.
+ *
+ * @param    none
+ *
+ * @return   none
+ *
+ * @remarks The frame being transmitted completes.
+ */
+void SENT1_TransmitQueueFlush(void);
+
+/**
+ * @brief    Returns the number of times the transmit queue ran dry in
+ *           asynchronous mode, the last frame being repeated.
+ *
+ * @param    none
+ *
+ * @return   Number of underruns since SENT1_Initialize
+ *
+ * @remarks None
+ */
+uint32_t SENT1_TransmitUnderrunCountGet(void);
 #endif  // SENT1_H
 /**
  End of File
@@ -49,6 +49,10 @@
 #include <stdlib.h>                     // Defines EXIT_FAILURE
 #include "definitions.h"                // SYS function prototypes
 
+/* Set to 1 to stream a ramp through the transmit queue, the SENT1 interrupt
+   sends the frames back to back */
+#define SENT_TRANSMIT_QUEUEING  (0)
+
 
 // *****************************************************************************
 // *****************************************************************************
@@ -66,6 +70,24 @@ SENT_DATA_TRANSMIT sentDataTransmit = {
     .data6 = 6
 };
 
+#if (SENT_TRANSMIT_QUEUEING == 1)
+/* Queues the next frames of a 12-bit ramp in data1 to data3 */
+static void ramp_queue(void)
+{
+    static uint32_t ramp = 0U;
+    SENT_DATA_TRANSMIT frame = sentDataTransmit;
+
+    while (SENT1_TransmitQueueFreeGet() != 0U)
+    {
+        frame.data1 = (ramp >> 8) & 0xFU;
+        frame.data2 = (ramp >> 4) & 0xFU;
+        frame.data3 = ramp & 0xFU;
+        (void)SENT1_TransmitQueue(&frame, 1U);
+        ramp = (ramp + 1U) & 0xFFFU;
+    }
+}
+#endif
+
 void sent_callback_tx(uintptr_t context){
     //LED4 on the curiosity board
     LED_Set();
@@ -85,6 +107,13 @@ int main ( void )
     SENT1_Transmit(&sentDataTransmit);
     while ( true )
     {
+#if (SENT_TRANSMIT_QUEUEING == 1)
+        /* Top up the queue, the frames are sent from the interrupt */
+        if (SENT1_TransmitQueueFreeGet() >= (SENT1_TRANSMIT_QUEUE_SIZE / 2U))
+        {
+            ramp_queue();
+        }
+#endif
         /* Maintain state machines of all polled MPLAB Harmony modules. */
         SYS_Tasks ( );
     }
@@ -50,6 +50,21 @@
 
 volatile static TIMER_OBJECT tmr1Obj;
 
+/* Tickless mode: tick length in timer counts, ticks of the running period and
+   longest period in ticks. In periodic mode the running period is one tick. */
+static uint32_t tmr1TickPeriod = 0xf4240UL;
+static uint32_t tmr1MaxTicks = 1U;
+static volatile uint32_t tmr1PeriodTicks = 1U;
+static volatile bool tmr1Tickless = false;
+
+/* Upper 32 bits of the tick counter, and tick count at the end of the running
+   period, which a reader uses while the match interrupt is pending */
+static volatile uint32_t tmr1TickCounterHigh = 0U;
+static volatile uint64_t tmr1PeriodEnd = 1U;
+
+/* Shortest time in timer counts between a period reprogramming and the match */
+#define TMR1_TICKLESS_MARGIN    (64U)
+
 // Section: Macro Definitions
 
 //Timer Pre-Scalar options
@@ -74,7 +89,14 @@ void TMR1_Initialize(void)
     /*Set period */
     PR1 = 0xf423fUL; /* Decimal Equivalent 999999 */
 
+    tmr1TickPeriod = 0xf4240UL;
+    tmr1MaxTicks = 0xFFFFFFFFUL / tmr1TickPeriod;
+    tmr1PeriodTicks = 1U;
+    tmr1Tickless = false;
+
     tmr1Obj.tickCounter = 0;
+    tmr1TickCounterHigh = 0U;
+    tmr1PeriodEnd = 1U;
     tmr1Obj.callback_fn = NULL;
 
     /* Setup TMR1 Interrupt */
@@ -127,13 +149,48 @@ uint32_t TMR1_FrequencyGet(void)
 
 uint32_t TMR1_GetTickCounter(void)
 {
-    return tmr1Obj.tickCounter;
+    return (uint32_t)TMR1_GetTickCounter64();
+}
+
+uint64_t TMR1_GetTickCounter64(void)
+{
+    uint32_t count;
+    uint32_t countHigh;
+    uint32_t periodTicks;
+    uint32_t timer;
+    bool matchPending;
+    uint64_t ticks;
+    uint64_t periodEnd;
+
+    /* Read again when the interrupt updated the counter meanwhile */
+    do
+    {
+        count = tmr1Obj.tickCounter;
+        countHigh = tmr1TickCounterHigh;
+        periodTicks = tmr1PeriodTicks;
+        periodEnd = tmr1PeriodEnd;
+        timer = TMR1;
+        matchPending = (_T1IF != 0U);
+    } while ((count != tmr1Obj.tickCounter) || (countHigh != tmr1TickCounterHigh));
+
+    ticks = ((uint64_t)countHigh << 32) | count;
+
+    /* A match not handled yet has restarted the counter, unless it occurred
+       after the counter was read, in which case the counter is near the period.
+       The end of the period stays valid until the interrupt clears the flag. */
+    if (matchPending && (timer < ((periodTicks * tmr1TickPeriod) / 2U)))
+    {
+        ticks = periodEnd;
+    }
+
+    /* In periodic mode the running period is one tick and this adds nothing */
+    return ticks + (timer / tmr1TickPeriod);
 }
 
 void TMR1_StartTimeOut (TMR_TIMEOUT* timeout, uint32_t delay_ms)
 {
     timeout->start = TMR1_GetTickCounter();
-    timeout->count = (delay_ms * 1000000U)/TMR_INTERRUPT_PERIOD_IN_NS;
+    timeout->count = (uint32_t)(((uint64_t)delay_ms * 1000000U) / TMR_INTERRUPT_PERIOD_IN_NS);
 }
 
 void TMR1_ResetTimeOut (TMR_TIMEOUT* timeout)
@@ -144,7 +201,7 @@ void TMR1_ResetTimeOut (TMR_TIMEOUT* timeout)
 bool TMR1_IsTimeoutReached (TMR_TIMEOUT* timeout)
 {
     bool valTimeout  = true;
-    if ((tmr1Obj.tickCounter - timeout->start) < timeout->count)
+    if ((TMR1_GetTickCounter() - timeout->start) < timeout->count)
     {
         valTimeout = false;
     }
@@ -156,9 +213,31 @@ bool TMR1_IsTimeoutReached (TMR_TIMEOUT* timeout)
 void __attribute__((used)) T1_InterruptHandler (void)
 {
     uint32_t status = _T1IF;
+
+    /* Compensate the ticks of the period that just ended. The counter is
+       updated before the flag is cleared, so that a reader in a higher priority
+       interrupt counts the match exactly once. */
+    tmr1Obj.tickCounter = (uint32_t)tmr1PeriodEnd;
+    tmr1TickCounterHigh = (uint32_t)(tmr1PeriodEnd >> 32);
     _T1IF = 0;
 
-    tmr1Obj.tickCounter++;
+    if (tmr1Tickless)
+    {
+        /* Sleep as long as possible, the callback brings the wakeup forward */
+        tmr1PeriodTicks = tmr1MaxTicks;
+        PR1 = (tmr1MaxTicks * tmr1TickPeriod) - 1U;
+    }
+    else if (tmr1PeriodTicks != 1U)
+    {
+        tmr1PeriodTicks = 1U;
+        PR1 = tmr1TickPeriod - 1U;
+    }
+    else
+    {
+        /* Periodic mode */
+    }
+
+    tmr1PeriodEnd += tmr1PeriodTicks;
 
     if((tmr1Obj.callback_fn != NULL))
     {
@@ -186,3 +265,93 @@ void TMR1_CallbackRegister( TMR_CALLBACK callback_fn, uintptr_t context )
     tmr1Obj.callback_fn = callback_fn;
     tmr1Obj.context = context;
 }
+
+void TMR1_TicklessEnable(void)
+{
+    tmr1Tickless = true;
+}
+
+void TMR1_TicklessDisable(void)
+{
+    bool interruptEnabled = (_T1IE != 0U);
+
+    /* Interrupt at the end of the current tick, which restores the periodic mode */
+    TMR1_InterruptDisable();
+    TMR1_TicklessWakeupSet(1U);
+    tmr1Tickless = false;
+
+    if (interruptEnabled)
+    {
+        TMR1_InterruptEnable();
+    }
+}
+
+bool TMR1_TicklessIsEnabled(void)
+{
+    return tmr1Tickless;
+}
+
+void TMR1_TicklessWakeupSet(uint32_t ticks)
+{
+    bool interruptEnabled;
+    uint32_t periodTicks;
+    uint32_t elapsedTicks;
+    uint32_t timer;
+    uint32_t period;
+
+    if (!tmr1Tickless)
+    {
+        return;
+    }
+
+    ticks = (ticks == 0U) ? 1U : ticks;
+
+    /* No interrupt of any priority may delay the write of PR1 past the margin */
+    interruptEnabled = (INTCON1bits.GIE != 0U);
+    (void)__builtin_disable_interrupts();
+
+    timer = TMR1;
+    periodTicks = tmr1PeriodTicks;
+
+    /* A pending match restarts the period and the interrupt takes new requests */
+    if (_T1IF == 0U)
+    {
+        elapsedTicks = timer / tmr1TickPeriod;
+
+        if (ticks <= (periodTicks - elapsedTicks - 1U))
+        {
+            periodTicks = elapsedTicks + ticks;
+            period = periodTicks * tmr1TickPeriod;
+
+            /* Too close to program safely, wake up one tick later */
+            if ((period - timer) < TMR1_TICKLESS_MARGIN)
+            {
+                periodTicks++;
+                period += tmr1TickPeriod;
+            }
+
+            /* The old period ends at least one tick later, it cannot match meanwhile */
+            if (periodTicks < tmr1PeriodTicks)
+            {
+                tmr1PeriodEnd -= (uint64_t)tmr1PeriodTicks - periodTicks;
+                tmr1PeriodTicks = periodTicks;
+                PR1 = period - 1U;
+
+                /* The counter passed the new period before the write (a bus stall
+                   longer than the margin), it would run up to 2^32. Restart it past
+                   the period and pend the match, a few counts are lost. */
+                timer = TMR1;
+                if ((timer >= period) && (_T1IF == 0U))
+                {
+                    TMR1 = TMR1 - period;
+                    _T1IF = 1U;
+                }
+            }
+        }
+    }
+
+    if (interruptEnabled)
+    {
+        (void)__builtin_enable_interrupts();
+    }
+}
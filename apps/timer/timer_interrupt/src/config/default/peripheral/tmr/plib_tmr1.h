@@ -183,10 +183,28 @@ uint32_t TMR1_FrequencyGet(void);
  *
  * @return     Current tick count
  *
- * @remarks    None
+ * @remarks    In tickless mode the ticks elapsed since the last interrupt are included.
+ *             A period match whose interrupt is not handled yet is counted.
  */
 uint32_t TMR1_GetTickCounter(void);
 
+/**
+ * @brief      Returns current tick count on 64 bits
+ *
+ * @details    This function returns current tick count, which does not wrap
+ *             around. It is read without disabling the timer interrupt and
+ *             can be called from any context.
+ *
+ * @pre        Timer should be initialized properly
+ *
+ * @param      None
+ *
+ * @return     Current tick count
+ *
+ * @remarks    The lower 32 bits are the value of TMR1_GetTickCounter.
+ */
+uint64_t TMR1_GetTickCounter64(void);
+
 /**
  * @brief      Stores current tick count and delay value in the timeout
  *
@@ -277,6 +295,77 @@ void TMR1_InterruptDisable(void);
  */
 void TMR1_CallbackRegister( TMR_CALLBACK callback_fn, uintptr_t context );
 
+/**
+ * @brief      Enables the tickless mode
+ *
+ * @details    In tickless mode the timer interrupt only occurs when a client
+ *             needs it, as requested with TMR1_TicklessWakeupSet, instead of at
+ *             every period. The period set at initialization remains the tick,
+ *             and the tick counter is compensated for the skipped interrupts.
+ *             TMR1_GetTickCounter adds the ticks elapsed since the last
+ *             interrupt, so the time base stays monotonic. The mode takes
+ *             effect at the next timer interrupt.
+ *
+ * @pre        Timer should be initialized properly
+ *
+ * @param      None
+ *
+ * @return     None
+ *
+ * @remarks    Without any wakeup request, the interrupt occurs after the longest
+ *             number of ticks that fits in the 32-bit period register.
+ */
+void TMR1_TicklessEnable(void);
+
+/**
+ * @brief      Disables the tickless mode
+ *
+ * @details    The timer interrupt occurs at every period again from the next
+ *             tick.
+ *
+ * @pre        Timer should be initialized properly
+ *
+ * @param      None
+ *
+ * @return     None
+ *
+ * @remarks    None
+ */
+void TMR1_TicklessDisable(void);
+
+/**
+ * @brief      Returns the tickless mode state
+ *
+ * @pre        Timer should be initialized properly
+ *
+ * @param      None
+ *
+ * @return     true when the tickless mode is enabled
+ *
+ * @remarks    None
+ */
+bool TMR1_TicklessIsEnabled(void);
+
+/**
+ * @brief      Requests a timer interrupt after a number of ticks
+ *
+ * @details    The interrupt is brought forward to the end of the given tick,
+ *             counted from the current tick count, when it is programmed later
+ *             than that. A later request never delays the interrupt. The timer
+ *             callback is the place to request the next wakeup, the requests
+ *             start over at every interrupt.
+ *
+ * @pre        Tickless mode should be enabled, the request is ignored otherwise
+ *
+ * @param[in]  ticks - Number of ticks from the current tick count, at least 1
+ *
+ * @return     None
+ *
+ * @remarks    Can be called from the timer callback and from the application.
+ *             Global interrupts are disabled while the period is reprogrammed.
+ */
+void TMR1_TicklessWakeupSet(uint32_t ticks);
+
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
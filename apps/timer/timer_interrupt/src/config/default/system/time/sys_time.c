@@ -0,0 +1,75 @@
+/*******************************************************************************
+  System Time Source File
+
+  Company
+    Microchip Technology Inc.
+
+  File Name
+    sys_time.c
+
+  Summary
+    Monotonic microsecond time base built on TMR1.
+
+  Description
+    This file implements the system time service.
+
+*/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include "definitions.h"
+#include "sys_time.h"
+
+// Section: Macro Definitions
+
+/* Length of a tick in microseconds and in TMR1 counts */
+#define SYS_TIME_TICK_US            ((uint32_t)(TMR_INTERRUPT_PERIOD_IN_NS / 1000U))
+#define SYS_TIME_TICK_COUNTS        ((uint32_t)(((uint64_t)TMR_INTERRUPT_PERIOD_IN_NS * TIMER_CLOCK_FREQUENCY) / 1000000000U))
+
+/* Microseconds per TMR1 count in 32.32 fixed point, so that the conversion of
+   the counter takes a multiplication instead of a 64-bit division */
+#define SYS_TIME_US_PER_COUNT_Q32   ((uint64_t)((1000000ULL << 32) / TIMER_CLOCK_FREQUENCY))
+
+// Section: System Time Implementation
+
+uint64_t SYS_TimeUsGet64(void)
+{
+    uint64_t ticks;
+    uint32_t counter;
+
+    /* A tick ending between the reads changes the tick count, read again */
+    do
+    {
+        ticks = TMR1_GetTickCounter64();
+        counter = TMR1_CounterGet();
+    } while (ticks != TMR1_GetTickCounter64());
+
+    /* In tickless mode the counter spans several ticks, which the tick count
+       already includes. The part of a tick stays below one tick, rounded down. */
+    counter = counter % SYS_TIME_TICK_COUNTS;
+
+    return (ticks * SYS_TIME_TICK_US) + (((uint64_t)counter * SYS_TIME_US_PER_COUNT_Q32) >> 32);
+}
@@ -0,0 +1,100 @@
+/*******************************************************************************
+  System Time Header File
+
+  Company
+    Microchip Technology Inc.
+
+  File Name
+    sys_time.h
+
+  Summary
+    Monotonic microsecond time base built on TMR1.
+
+  Description
+    This file defines the interface of the system time service. The time
+    combines the TMR1 tick counter with the live TMR1 counter, for a resolution
+    of one microsecond at the cost of a few register reads.
+
+*/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+#ifndef SYS_TIME_H
+#define SYS_TIME_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief      Returns the time since TMR1 was started, in microseconds
+ *
+ * @details    The time is the TMR1 tick count, plus the part of the current
+ *             tick given by the TMR1 counter. Both are read again until the
+ *             tick count is the same before and after the counter is read, so
+ *             the two values always belong to the same tick. No interrupt is
+ *             disabled.
+ *
+ * @pre        TMR1 should be initialized and started. The tick period must be
+ *             a whole number of microseconds.
+ *
+ * @param      None
+ *
+ * @return     Time in microseconds, it never decreases and does not wrap around
+ *
+ * @remarks    The function can be called from any interrupt, including an
+ *             interrupt of a higher priority than TMR1. It works with the
+ *             TMR1 periodic and tickless modes.
+ */
+uint64_t SYS_TimeUsGet64(void);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif // SYS_TIME_H
@@ -48,6 +48,7 @@
 #include <stdbool.h>                    // Defines true
 #include <stdlib.h>                     // Defines EXIT_FAILURE
 #include "definitions.h"                // SYS function prototypes
+#include "timer_wheel.h"                // Software timers on the TMR1 tick
 
 
 // *****************************************************************************
@@ -56,21 +57,39 @@
 // *****************************************************************************
 // *****************************************************************************
 
-void tmr_callback_fn(uint32_t status, uintptr_t context){
+/* LED toggle period */
+#define LED_TOGGLE_PERIOD_MS    (250U)
+
+/* Set to 1 to interrupt only at the timer wheel deadlines and idle in between */
+#define TIMER_TICKLESS          (0)
+
+static TIMER_WHEEL_TIMER ledTimer;
+
+void led_timer_callback_fn(uintptr_t context){
     LED_Toggle();
 }
 int main ( void )
 {
     /* Initialize all modules */
     SYS_Initialize ( NULL );
-    //Registering a callback function when there is a timer match
-    TMR1_CallbackRegister( tmr_callback_fn, (uintptr_t)NULL);
+    //The timer wheel runs the software timers from the timer match interrupt
+    TIMER_WHEEL_Initialize();
+    TIMER_WHEEL_TimerCreate(&ledTimer, led_timer_callback_fn, (uintptr_t)NULL);
+    (void)TIMER_WHEEL_TimerStart(&ledTimer, 0U, TIMER_WHEEL_MsToTicks(LED_TOGGLE_PERIOD_MS));
+#if (TIMER_TICKLESS == 1)
+    //The timer period is stretched up to the next timer wheel deadline
+    TMR1_TicklessEnable();
+#endif
     //Starting the timer
     TMR1_Start();
     while ( true )
     {
         /* Maintain state machines of all polled MPLAB Harmony modules. */
         SYS_Tasks ( );
+#if (TIMER_TICKLESS == 1)
+        /* Wakes up at the next timer interrupt */
+        Idle();
+#endif
     }
 
     /* Execution should not come here during normal operation */
@@ -0,0 +1,380 @@
+/*******************************************************************************
+  Timer Wheel Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    timer_wheel.c
+
+  Summary:
+    Software timers driven by the TMR1 interrupt.
+
+  Description:
+    The wheel has four levels. Level 0 has one slot per tick for the next 256
+    ticks, and each of the upper levels has 64 slots covering 64 times the
+    span of the level below. A timer is linked in the slot of its expiry tick,
+    or of its expiry range when it is further away. Every 256 ticks the next
+    slot of level 1 is moved down (cascaded), and so on for the upper levels.
+
+    With the TMR1 tickless mode, the wheel catches up with the ticks elapsed
+    since the last interrupt and requests the next interrupt at its next
+    expiry, or at its next cascade when only the upper levels hold timers.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// Section: Included Files
+
+#include <stddef.h>
+#include "definitions.h"
+#include "timer_wheel.h"
+
+// Section: Macro Definitions
+
+#define WHEEL_ROOT_BITS     (8U)
+#define WHEEL_LEVEL_BITS    (6U)
+#define WHEEL_ROOT_SIZE     (1UL << WHEEL_ROOT_BITS)
+#define WHEEL_LEVEL_SIZE    (1UL << WHEEL_LEVEL_BITS)
+#define WHEEL_ROOT_MASK     (WHEEL_ROOT_SIZE - 1UL)
+#define WHEEL_LEVEL_MASK    (WHEEL_LEVEL_SIZE - 1UL)
+#define WHEEL_UPPER_LEVELS  (3U)
+
+/* Index of a tick in an upper level, level 1 to 3 */
+#define WHEEL_LEVEL_INDEX(tick, level)  (((tick) >> (WHEEL_ROOT_BITS + (((level) - 1U) * WHEEL_LEVEL_BITS))) & WHEEL_LEVEL_MASK)
+
+// Section: Local Objects
+
+static TIMER_WHEEL_NODE wheelRoot[WHEEL_ROOT_SIZE];
+static TIMER_WHEEL_NODE wheelLevel[WHEEL_UPPER_LEVELS][WHEEL_LEVEL_SIZE];
+
+/* Timers expiring in the tick being processed */
+static TIMER_WHEEL_NODE wheelExpiring;
+
+/* Next tick to be processed */
+static volatile uint32_t wheelTick = 0U;
+
+// Section: Local Functions
+
+static void WHEEL_ListInit(TIMER_WHEEL_NODE* list)
+{
+    list->next = list;
+    list->prev = list;
+}
+
+static void WHEEL_ListAppend(TIMER_WHEEL_NODE* list, TIMER_WHEEL_NODE* node)
+{
+    node->next = list;
+    node->prev = list->prev;
+    list->prev->next = node;
+    list->prev = node;
+}
+
+static void WHEEL_ListRemove(TIMER_WHEEL_NODE* node)
+{
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+    node->next = node;
+    node->prev = node;
+}
+
+/* Moves all the timers of a slot to an empty list */
+static void WHEEL_ListMove(TIMER_WHEEL_NODE* from, TIMER_WHEEL_NODE* to)
+{
+    if (from->next == from)
+    {
+        WHEEL_ListInit(to);
+    }
+    else
+    {
+        to->next = from->next;
+        to->prev = from->prev;
+        to->next->prev = to;
+        to->prev->next = to;
+        WHEEL_ListInit(from);
+    }
+}
+
+/* Links a timer in the slot of its expiry, relative to the next tick processed */
+static void WHEEL_TimerAdd(TIMER_WHEEL_TIMER* timer)
+{
+    uint32_t expires = timer->expires;
+    uint32_t distance = expires - wheelTick;
+    TIMER_WHEEL_NODE* slot;
+
+    if ((int32_t)distance < 0)
+    {
+        /* Already due, expires at the next tick */
+        slot = &wheelRoot[wheelTick & WHEEL_ROOT_MASK];
+    }
+    else if (distance < WHEEL_ROOT_SIZE)
+    {
+        slot = &wheelRoot[expires & WHEEL_ROOT_MASK];
+    }
+    else if (distance < (1UL << (WHEEL_ROOT_BITS + WHEEL_LEVEL_BITS)))
+    {
+        slot = &wheelLevel[0][WHEEL_LEVEL_INDEX(expires, 1U)];
+    }
+    else if (distance < (1UL << (WHEEL_ROOT_BITS + (2U * WHEEL_LEVEL_BITS))))
+    {
+        slot = &wheelLevel[1][WHEEL_LEVEL_INDEX(expires, 2U)];
+    }
+    else
+    {
+        slot = &wheelLevel[2][WHEEL_LEVEL_INDEX(expires, 3U)];
+    }
+
+    WHEEL_ListAppend(slot, &timer->node);
+}
+
+/* Moves the timers of an upper level slot down to the lower levels */
+static uint32_t WHEEL_Cascade(uint32_t level)
+{
+    TIMER_WHEEL_NODE cascading;
+    uint32_t index = WHEEL_LEVEL_INDEX(wheelTick, level);
+
+    WHEEL_ListMove(&wheelLevel[level - 1U][index], &cascading);
+
+    while (cascading.next != &cascading)
+    {
+        TIMER_WHEEL_TIMER* timer = (TIMER_WHEEL_TIMER*)cascading.next;
+        WHEEL_ListRemove(&timer->node);
+        WHEEL_TimerAdd(timer);
+    }
+
+    return index;
+}
+
+/* Critical section against the TMR1 interrupt, also safe within the interrupt */
+static bool WHEEL_Lock(void)
+{
+    bool interruptEnabled = (_T1IE != 0U);
+
+    TMR1_InterruptDisable();
+
+    return interruptEnabled;
+}
+
+static void WHEEL_Unlock(bool interruptEnabled)
+{
+    if (interruptEnabled)
+    {
+        TMR1_InterruptEnable();
+    }
+}
+
+/* Processes one tick */
+static void WHEEL_Tick(void)
+{
+    uint32_t index = wheelTick & WHEEL_ROOT_MASK;
+    uint32_t level;
+    TIMER_WHEEL_TIMER* timer;
+
+    /* Each time a level wraps, the next slot of the level above is cascaded */
+    if (index == 0U)
+    {
+        for (level = 1U; level <= WHEEL_UPPER_LEVELS; level++)
+        {
+            if (WHEEL_Cascade(level) != 0U)
+            {
+                break;
+            }
+        }
+    }
+
+    /* Timers started from the callbacks are added relative to the next tick */
+    wheelTick++;
+    WHEEL_ListMove(&wheelRoot[index], &wheelExpiring);
+
+    while (wheelExpiring.next != &wheelExpiring)
+    {
+        timer = (TIMER_WHEEL_TIMER*)wheelExpiring.next;
+        WHEEL_ListRemove(&timer->node);
+
+        if (timer->period != 0U)
+        {
+            timer->expires += timer->period;
+            WHEEL_TimerAdd(timer);
+        }
+        else
+        {
+            timer->active = false;
+        }
+
+        timer->expired = true;
+
+        if (timer->callback != NULL)
+        {
+            timer->callback(timer->context);
+        }
+    }
+}
+
+/* Number of ticks until the wheel has to process a tick, from the next tick */
+static uint32_t WHEEL_NextTicks(void)
+{
+    uint32_t ticks = TIMER_WHEEL_MAX_TICKS;
+    uint32_t index;
+    uint32_t level;
+
+    for (index = 0U; index < WHEEL_ROOT_SIZE; index++)
+    {
+        if (wheelRoot[(wheelTick + index) & WHEEL_ROOT_MASK].next != &wheelRoot[(wheelTick + index) & WHEEL_ROOT_MASK])
+        {
+            ticks = index + 1U;
+            break;
+        }
+    }
+
+    for (level = 0U; level < WHEEL_UPPER_LEVELS; level++)
+    {
+        for (index = 0U; index < WHEEL_LEVEL_SIZE; index++)
+        {
+            if (wheelLevel[level][index].next != &wheelLevel[level][index])
+            {
+                /* Ticks until the root wraps and the cascade takes place */
+                index = ((WHEEL_ROOT_SIZE - (wheelTick & WHEEL_ROOT_MASK)) & WHEEL_ROOT_MASK) + 1U;
+                return (index < ticks) ? index : ticks;
+            }
+        }
+    }
+
+    return ticks;
+}
+
+/* This function is called from the TMR1 interrupt */
+static void WHEEL_TickHandler(uint32_t status, uintptr_t context)
+{
+    /* One tick per interrupt in periodic mode, all the elapsed ticks in tickless mode */
+    while ((int32_t)(TMR1_GetTickCounter() - wheelTick) > 0)
+    {
+        WHEEL_Tick();
+    }
+
+    if (TMR1_TicklessIsEnabled())
+    {
+        TMR1_TicklessWakeupSet(WHEEL_NextTicks());
+    }
+}
+
+// Section: Timer Wheel Implementation
+
+void TIMER_WHEEL_Initialize(void)
+{
+    uint32_t index;
+    uint32_t level;
+
+    for (index = 0U; index < WHEEL_ROOT_SIZE; index++)
+    {
+        WHEEL_ListInit(&wheelRoot[index]);
+    }
+
+    for (level = 0U; level < WHEEL_UPPER_LEVELS; level++)
+    {
+        for (index = 0U; index < WHEEL_LEVEL_SIZE; index++)
+        {
+            WHEEL_ListInit(&wheelLevel[level][index]);
+        }
+    }
+
+    WHEEL_ListInit(&wheelExpiring);
+    wheelTick = TMR1_GetTickCounter();
+
+    TMR1_CallbackRegister(WHEEL_TickHandler, (uintptr_t)NULL);
+}
+
+void TIMER_WHEEL_TimerCreate(TIMER_WHEEL_TIMER* timer, TIMER_WHEEL_CALLBACK callback, uintptr_t context)
+{
+    WHEEL_ListInit(&timer->node);
+    timer->expires = 0U;
+    timer->period = 0U;
+    timer->callback = callback;
+    timer->context = context;
+    timer->active = false;
+    timer->expired = false;
+}
+
+bool TIMER_WHEEL_TimerStart(TIMER_WHEEL_TIMER* timer, uint32_t delay, uint32_t period)
+{
+    bool interruptEnabled;
+
+    if ((delay > TIMER_WHEEL_MAX_TICKS) || (period > TIMER_WHEEL_MAX_TICKS))
+    {
+        return false;
+    }
+
+    interruptEnabled = WHEEL_Lock();
+
+    /* Unlinking an idle timer has no effect, its node points to itself */
+    WHEEL_ListRemove(&timer->node);
+
+    /* Relative to the tick counter, which runs ahead of the wheel in tickless mode */
+    timer->expires = TMR1_GetTickCounter() + delay;
+    timer->period = period;
+    timer->active = true;
+    timer->expired = false;
+    WHEEL_TimerAdd(timer);
+
+    /* The tick of the expiry is processed at the end of that tick */
+    TMR1_TicklessWakeupSet(delay + 1U);
+
+    WHEEL_Unlock(interruptEnabled);
+
+    return true;
+}
+
+void TIMER_WHEEL_TimerStop(TIMER_WHEEL_TIMER* timer)
+{
+    bool interruptEnabled = WHEEL_Lock();
+
+    WHEEL_ListRemove(&timer->node);
+    timer->active = false;
+
+    WHEEL_Unlock(interruptEnabled);
+}
+
+bool TIMER_WHEEL_TimerIsActive(const TIMER_WHEEL_TIMER* timer)
+{
+    return timer->active;
+}
+
+bool TIMER_WHEEL_TimerExpiredGet(TIMER_WHEEL_TIMER* timer)
+{
+    bool interruptEnabled = WHEEL_Lock();
+    bool expired = timer->expired;
+
+    /* A periodic timer expiring between the read and the clear must not be lost */
+    timer->expired = false;
+
+    WHEEL_Unlock(interruptEnabled);
+
+    return expired;
+}
+
+uint32_t TIMER_WHEEL_MsToTicks(uint32_t delay_ms)
+{
+    uint64_t ticks = (((uint64_t)delay_ms * 1000000U) + (TMR_INTERRUPT_PERIOD_IN_NS - 1U)) / TMR_INTERRUPT_PERIOD_IN_NS;
+
+    return (ticks > TIMER_WHEEL_MAX_TICKS) ? TIMER_WHEEL_MAX_TICKS : (uint32_t)ticks;
+}
@@ -0,0 +1,196 @@
+/*******************************************************************************
+  Timer Wheel Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    timer_wheel.h
+
+  Summary:
+    Software timers driven by the TMR1 interrupt.
+
+  Description:
+    A hierarchical timer wheel runs any number of one-shot and periodic
+    software timers from the TMR1 period interrupt. Starting, stopping and
+    expiring a timer take constant time, whatever the number of timers, and
+    no timer is polled. The resolution is one TMR1 period.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+// Section: Included Files
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// Section: Data Types
+
+/* Longest delay or period in ticks */
+#define TIMER_WHEEL_MAX_TICKS   ((1UL << 26) - 1UL)
+
+/**
+ @brief    Function called from the TMR1 interrupt when a timer expires
+*/
+typedef void (*TIMER_WHEEL_CALLBACK)(uintptr_t context);
+
+// /cond IGNORE_THIS
+/**
+ @struct   TIMER_WHEEL_NODE
+ @brief    Wheel slot list link
+ @remarks  Local Objects ****** Do Not Use ******
+*/
+typedef struct TIMER_WHEEL_NODE_S
+{
+    struct TIMER_WHEEL_NODE_S*  next;
+
+    struct TIMER_WHEEL_NODE_S*  prev;
+
+} TIMER_WHEEL_NODE;
+// /endcond
+
+/**
+ @struct   TIMER_WHEEL_TIMER
+ @brief    Software timer. The application owns the storage, which must remain
+           valid while the timer is active. The members are private.
+*/
+typedef struct
+{
+    /* Must be the first member, the slot lists link the timers through it */
+    TIMER_WHEEL_NODE        node;
+
+    uint32_t                expires;
+
+    uint32_t                period;
+
+    TIMER_WHEEL_CALLBACK    callback;
+
+    uintptr_t               context;
+
+    volatile bool           active;
+
+    volatile bool           expired;
+
+} TIMER_WHEEL_TIMER;
+
+// Section: Interface Functions
+
+/**
+ * @brief      Initializes the timer wheel.
+ *
+ * @details    The wheel takes the TMR1 callback and advances one tick at every
+ *             TMR1 period interrupt. In the TMR1 tickless mode, it processes all
+ *             the ticks elapsed at each interrupt and programs the next
+ *             interrupt at its next deadline.
+ *
+ * @pre        TMR1 should be initialized. TMR1_Start starts the wheel.
+ *
+ * @return     None
+ */
+void TIMER_WHEEL_Initialize(void);
+
+/**
+ * @brief      Prepares a timer before its first start.
+ *
+ * @param      timer    - Timer
+ * @param      callback - Function called from the TMR1 interrupt at expiry, or
+ *                        NULL to deliver the expiry through TIMER_WHEEL_TimerExpiredGet
+ * @param      context  - Value passed to the callback
+ *
+ * @return     None
+ */
+void TIMER_WHEEL_TimerCreate(TIMER_WHEEL_TIMER* timer, TIMER_WHEEL_CALLBACK callback, uintptr_t context);
+
+/**
+ * @brief      Starts or restarts a timer.
+ *
+ * @details    The timer first expires after at least delay full ticks, and then
+ *             every period ticks without drift when period is not 0. The
+ *             function can be called from a timer callback.
+ *
+ * @param      timer  - Timer
+ * @param      delay  - Ticks before the first expiry, up to TIMER_WHEEL_MAX_TICKS
+ * @param      period - Ticks between expiries, 0 for a one-shot timer
+ *
+ * @return     true  - Timer started
+ * @return     false - Delay or period above TIMER_WHEEL_MAX_TICKS
+ */
+bool TIMER_WHEEL_TimerStart(TIMER_WHEEL_TIMER* timer, uint32_t delay, uint32_t period);
+
+/**
+ * @brief      Stops a timer, a stopped timer does not expire.
+ *
+ * @param      timer - Timer
+ *
+ * @return     None
+ */
+void TIMER_WHEEL_TimerStop(TIMER_WHEEL_TIMER* timer);
+
+/**
+ * @brief      Tells whether a timer is waiting for its expiry.
+ *
+ * @param      timer - Timer
+ *
+ * @return     true while the timer is started
+ */
+bool TIMER_WHEEL_TimerIsActive(const TIMER_WHEEL_TIMER* timer);
+
+/**
+ * @brief      Reads and clears the expiry flag of a timer.
+ *
+ * @param      timer - Timer
+ *
+ * @return     true when the timer expired since the last call
+ */
+bool TIMER_WHEEL_TimerExpiredGet(TIMER_WHEEL_TIMER* timer);
+
+/**
+ * @brief      Converts a delay in milliseconds to ticks, rounded up.
+ *
+ * @param      delay_ms - Delay in milliseconds
+ *
+ * @return     Number of ticks
+ */
+uint32_t TIMER_WHEEL_MsToTicks(uint32_t delay_ms);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif // TIMER_WHEEL_H
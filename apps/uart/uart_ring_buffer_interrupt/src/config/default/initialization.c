@@ -283,6 +283,8 @@ void SYS_Initialize ( void* data )
 
 	UART3_Initialize();
 
+    SCCP1_TimerInitialize();
+
 
     INTC_Initialize();
 
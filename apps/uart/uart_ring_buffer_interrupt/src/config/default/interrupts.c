@@ -67,21 +67,38 @@ void _U3RXInterrupt (void);
 void _U3TXInterrupt (void);
 void _U3EInterrupt (void);
 
+#if (PROFILER_ENABLED == 1)
+PROFILER_SECTION U3RX_ProfilerSection = PROFILER_SECTION_INVALID;
+
+static void U3RX_ProfiledInterruptHandler(void)
+{
+    uint32_t begin = PROFILER_Begin();
+
+    U3RX_InterruptHandler();
+
+    PROFILER_End(U3RX_ProfilerSection, begin);
+}
+
+#define U3RX_VECTOR_HANDLER     U3RX_ProfiledInterruptHandler
+#else
+#define U3RX_VECTOR_HANDLER     U3RX_InterruptHandler
+#endif
+
 // Section: System Interrupt Vector definitions
 
 void __attribute__ (( interrupt, no_auto_psv)) _U3RXInterrupt (void)
 {
-    U3RX_InterruptHandler();
+    ISR_MONITOR_VECTOR(ISR_MONITOR_SOURCE_U3RX, U3RX_VECTOR_HANDLER);
 }
 
 void __attribute__ (( interrupt, no_auto_psv)) _U3TXInterrupt (void)
 {
-    U3TX_InterruptHandler();
+    ISR_MONITOR_VECTOR(ISR_MONITOR_SOURCE_U3TX, U3TX_InterruptHandler);
 }
 
 void __attribute__ (( interrupt, no_auto_psv)) _U3EInterrupt (void)
 {
-    U3E_InterruptHandler();
+    ISR_MONITOR_VECTOR(ISR_MONITOR_SOURCE_U3E, U3E_InterruptHandler);
 }
 
 
@@ -48,6 +48,8 @@
 // *****************************************************************************
 // *****************************************************************************
 #include <stdint.h>
+#include "profiler.h"
+#include "isr_monitor.h"
 
 
 
@@ -60,6 +62,13 @@ void U3RX_InterruptHandler( void );
 void U3TX_InterruptHandler( void );
 void U3E_InterruptHandler( void );
 
+#if (PROFILER_ENABLED == 1)
+/* Section measuring the UART3 receive handler, which pushes the received
+   bytes in the ring buffer. The handler is not measured until the
+   application creates the section. */
+extern PROFILER_SECTION U3RX_ProfilerSection;
+#endif
+
 
 
 #endif // INTERRUPTS_H
@@ -0,0 +1,287 @@
+/*******************************************************************************
+  Interrupt Monitor Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    isr_monitor.c
+
+  Summary:
+    Interrupt load monitor for the configured interrupt vectors.
+
+  Description:
+    The time of a nested interrupt is added to the level it preempted, and
+    subtracted from the time of that level when it exits. The statistics are
+    updated under a sequence counter and read without disabling interrupts.
+*******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *******************************************************************************/
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <stdio.h>
+#include "definitions.h"
+#include "isr_monitor.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Objects
+// *****************************************************************************
+// *****************************************************************************
+
+typedef struct
+{
+    /* Odd while the source is updated */
+    volatile uint32_t   sequence;
+
+    uint32_t            count;
+
+    uint64_t            total;
+
+    uint32_t            max;
+
+    uint32_t            nestingMax;
+
+} ISR_MONITOR_SOURCE_DATA;
+
+/* Reads of a source before ISR_MONITOR_StatisticsGet gives up, the vector
+   updating a source preempted by the reader never completes while the reader
+   spins */
+#define ISR_MONITOR_READ_RETRIES    (16U)
+
+static const char* const isrMonitorNames[ISR_MONITOR_SOURCE_COUNT] =
+{
+    "U3RX",
+    "U3TX",
+    "U3E",
+};
+
+static ISR_MONITOR_SOURCE_DATA isrMonitorSources[ISR_MONITOR_SOURCE_COUNT];
+
+/* Current nesting, and time of the nested interrupts of each level. A nested
+   interrupt always exits before the level it preempted resumes, so these are
+   consistent without a critical section. */
+static volatile uint32_t isrMonitorNesting = 0U;
+static volatile uint32_t isrMonitorNestedTime[ISR_MONITOR_NESTING_MAX + 1U];
+
+/* Load measurement window, extended to 64 bits from the 32-bit SCCP1 counter
+   each time an interrupt exits or the statistics are read */
+static uint64_t isrMonitorWindow = 0U;
+static uint32_t isrMonitorWindowLast = 0U;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interrupt Monitor Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+/* Adds the counts since the last update to the window, with all the interrupts
+   masked so that a preempting vector cannot add the same counts twice */
+static uint64_t ISR_MONITOR_WindowUpdate(bool restart)
+{
+    bool interruptState = INTC_Disable();
+    uint32_t now = SCCP1_Timer32bitCounterGet();
+    uint64_t window;
+
+    if (restart == true)
+    {
+        isrMonitorWindow = 0U;
+    }
+    else
+    {
+        isrMonitorWindow += (uint64_t)(now - isrMonitorWindowLast);
+    }
+    isrMonitorWindowLast = now;
+    window = isrMonitorWindow;
+
+    INTC_Restore(interruptState);
+
+    return window;
+}
+
+void ISR_MONITOR_Initialize(void)
+{
+    SCCP1_TimerStart();
+
+    ISR_MONITOR_Reset();
+}
+
+void ISR_MONITOR_Reset(void)
+{
+    ISR_MONITOR_SOURCE_DATA* data;
+    uint32_t source;
+
+    for (source = 0U; source < (uint32_t)ISR_MONITOR_SOURCE_COUNT; source++)
+    {
+        data = &isrMonitorSources[source];
+
+        data->sequence++;
+        data->count = 0U;
+        data->total = 0U;
+        data->max = 0U;
+        data->nestingMax = 0U;
+        data->sequence++;
+    }
+
+    (void)ISR_MONITOR_WindowUpdate(true);
+}
+
+uint32_t ISR_MONITOR_Enter(void)
+{
+    uint32_t nesting = isrMonitorNesting + 1U;
+
+    /* A preempting interrupt now counts for the level below this one */
+    isrMonitorNesting = nesting;
+    if (nesting <= ISR_MONITOR_NESTING_MAX)
+    {
+        isrMonitorNestedTime[nesting] = 0U;
+    }
+
+    return SCCP1_Timer32bitCounterGet();
+}
+
+void ISR_MONITOR_Exit(ISR_MONITOR_SOURCE source, uint32_t entry)
+{
+    uint32_t elapsed = SCCP1_Timer32bitCounterGet() - entry;
+    uint32_t nesting = isrMonitorNesting;
+    uint32_t duration = elapsed;
+    ISR_MONITOR_SOURCE_DATA* data = &isrMonitorSources[source];
+
+    /* An interrupt nested just before the entry timestamp can exceed the elapsed time */
+    if (nesting <= ISR_MONITOR_NESTING_MAX)
+    {
+        duration = (elapsed > isrMonitorNestedTime[nesting]) ? (elapsed - isrMonitorNestedTime[nesting]) : 0U;
+    }
+
+    /* The whole time of this interrupt is hidden from the level below */
+    isrMonitorNesting = nesting - 1U;
+    if ((nesting > 1U) && ((nesting - 1U) <= ISR_MONITOR_NESTING_MAX))
+    {
+        isrMonitorNestedTime[nesting - 1U] += elapsed;
+    }
+
+    data->sequence++;
+
+    data->count++;
+    data->total += duration;
+
+    if (duration > data->max)
+    {
+        data->max = duration;
+    }
+    if (nesting > data->nestingMax)
+    {
+        data->nestingMax = nesting;
+    }
+
+    data->sequence++;
+
+    /* Keeps the window below one SCCP1 period between two updates */
+    (void)ISR_MONITOR_WindowUpdate(false);
+}
+
+bool ISR_MONITOR_StatisticsGet(ISR_MONITOR_SOURCE source, ISR_MONITOR_STATISTICS* stats)
+{
+    ISR_MONITOR_SOURCE_DATA* data;
+    uint32_t sequence;
+    uint64_t window = 0U;
+    uint32_t retries = 0U;
+    bool isConsistent = false;
+
+    if ((uint32_t)source >= (uint32_t)ISR_MONITOR_SOURCE_COUNT)
+    {
+        return false;
+    }
+
+    data = &isrMonitorSources[source];
+
+    while ((isConsistent == false) && (retries < ISR_MONITOR_READ_RETRIES))
+    {
+        retries++;
+
+        sequence = data->sequence;
+        if ((sequence & 1U) != 0U)
+        {
+            continue;
+        }
+
+        window = ISR_MONITOR_WindowUpdate(false);
+        stats->count = data->count;
+        stats->total = data->total;
+        stats->max = data->max;
+        stats->nestingMax = data->nestingMax;
+
+        isConsistent = (sequence == data->sequence);
+    }
+
+    if (isConsistent == false)
+    {
+        return false;
+    }
+
+    stats->load = (window != 0U) ? (uint32_t)((stats->total * 10000U) / window) : 0U;
+
+    return true;
+}
+
+void ISR_MONITOR_Dump(ISR_MONITOR_WRITE write)
+{
+    ISR_MONITOR_STATISTICS stats;
+    char line[96];
+    uint32_t countsPerUs = SCCP1_TimerFrequencyGet() / 1000000U;
+    uint32_t source;
+    size_t size;
+    size_t written;
+
+    for (source = 0U; source < (uint32_t)ISR_MONITOR_SOURCE_COUNT; source++)
+    {
+        if (ISR_MONITOR_StatisticsGet((ISR_MONITOR_SOURCE)source, &stats) == false)
+        {
+            continue;
+        }
+
+        size = (size_t)snprintf(line, sizeof(line), "%-6s count=%lu total=%luus max=%luus nesting=%lu load=%lu.%02lu%%\r\n",
+                isrMonitorNames[source],
+                (unsigned long)stats.count,
+                (unsigned long)(stats.total / countsPerUs),
+                (unsigned long)(stats.max / countsPerUs),
+                (unsigned long)stats.nestingMax,
+                (unsigned long)(stats.load / 100U),
+                (unsigned long)(stats.load % 100U));
+
+        size = (size < sizeof(line)) ? size : (sizeof(line) - 1U);
+
+        written = 0U;
+        while (written < size)
+        {
+            written += write((uint8_t*)&line[written], size - written);
+        }
+    }
+}
@@ -0,0 +1,211 @@
+/*******************************************************************************
+  Interrupt Monitor Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    isr_monitor.h
+
+  Summary:
+    Interrupt load monitor for the UART3 interrupt vectors of this demo.
+
+  Description:
+    When ISR_MONITOR_ENABLED is 1, each vector of interrupts.c timestamps the
+    entry and the exit of its handler on the SCCP1 free running timer. The
+    monitor accumulates, for each interrupt source, the number of interrupts,
+    the total and worst case handler time, excluding the time spent in the
+    interrupts that preempted it, and the deepest nesting seen at entry.
+    When ISR_MONITOR_ENABLED is 0 the vectors call the handlers directly.
+
+    The monitor belongs to this UART demo, its sources are the UART3 vectors
+    and its time base is the SCCP1 timer of this configuration. Another
+    application adds its own vectors to ISR_MONITOR_SOURCE and to the names
+    of isr_monitor.c.
+*******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *******************************************************************************/
+// DOM-IGNORE-END
+
+#ifndef ISR_MONITOR_H
+#define ISR_MONITOR_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+/* Set to 1 to monitor the interrupt vectors */
+#define ISR_MONITOR_ENABLED         (0)
+
+/* Deepest interrupt nesting tracked, one level per interrupt priority */
+#define ISR_MONITOR_NESTING_MAX     (8U)
+
+/**
+ @enum     ISR_MONITOR_SOURCE
+ @brief    Monitored interrupt sources, the UART3 vectors of interrupts.c
+*/
+typedef enum
+{
+    ISR_MONITOR_SOURCE_U3RX = 0,
+
+    ISR_MONITOR_SOURCE_U3TX,
+
+    ISR_MONITOR_SOURCE_U3E,
+
+    ISR_MONITOR_SOURCE_COUNT
+
+} ISR_MONITOR_SOURCE;
+
+/**
+ @brief    Function writing the dump, UART3_Write for instance. It returns the
+           number of bytes accepted.
+*/
+typedef size_t (*ISR_MONITOR_WRITE)(uint8_t* buffer, const size_t size);
+
+/**
+ @struct   ISR_MONITOR_STATISTICS
+ @brief    Statistics of an interrupt source, times in SCCP1 time base counts
+*/
+typedef struct
+{
+    /* Number of interrupts handled */
+    uint32_t                count;
+
+    /* Time spent in the handler, without the nested interrupts */
+    uint64_t                total;
+
+    uint32_t                max;
+
+    /* Deepest nesting at entry, 1 when the source never preempted another one */
+    uint32_t                nestingMax;
+
+    /* Share of the CPU time since the last reset, in 0.01 % steps */
+    uint32_t                load;
+
+} ISR_MONITOR_STATISTICS;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief      Clears the statistics and starts the SCCP1 timer.
+ * @details    The SCCP1 timer must be initialized as a free running 32-bit
+ *             timer. The load is computed over the time since this call or
+ *             the last ISR_MONITOR_Reset, counted in 64 bits. The counter is
+ *             sampled at each monitored interrupt exit and statistics read,
+ *             these must not be more than one SCCP1 timer period apart
+ *             (about 43 s at 100 MHz).
+ * @return     None
+ */
+void ISR_MONITOR_Initialize(void);
+
+/**
+ * @brief      Clears the statistics and restarts the load measurement.
+ * @return     None
+ */
+void ISR_MONITOR_Reset(void);
+
+/**
+ * @brief      Called by a vector before its handler.
+ * @return     Entry timestamp to pass to ISR_MONITOR_Exit
+ */
+uint32_t ISR_MONITOR_Enter(void);
+
+/**
+ * @brief      Called by a vector after its handler.
+ * @param[in]  source - Interrupt source of the vector
+ * @param[in]  entry  - Timestamp returned by ISR_MONITOR_Enter
+ * @return     None
+ */
+void ISR_MONITOR_Exit(ISR_MONITOR_SOURCE source, uint32_t entry);
+
+/**
+ * @brief      Reads the statistics of an interrupt source.
+ * @details    The source is read again when one of its interrupts updated it
+ *             during the copy, interrupts are never disabled. The function is
+ *             called from the main loop, or from an interrupt only if it
+ *             cannot preempt a monitored vector.
+ * @param[in]  source - Interrupt source
+ * @param[out] stats  - Statistics
+ * @return     true  - stats holds the statistics
+ * @return     false - Invalid source, or the source was updated during each
+ *                     of the read attempts
+ */
+bool ISR_MONITOR_StatisticsGet(ISR_MONITOR_SOURCE source, ISR_MONITOR_STATISTICS* stats);
+
+/**
+ * @brief      Writes the statistics of all the sources as text lines.
+ * @details    One line per source, with the count, the total and worst case
+ *             time in microseconds, the nesting and the load in percent. The
+ *             function waits until write accepts all the bytes.
+ * @param[in]  write - Function writing the text
+ * @return     None
+ */
+void ISR_MONITOR_Dump(ISR_MONITOR_WRITE write);
+
+/* Vector body, the handler is called directly when the monitor is disabled */
+#if (ISR_MONITOR_ENABLED == 1)
+#define ISR_MONITOR_VECTOR(source, handler)                 \
+    do                                                      \
+    {                                                       \
+        uint32_t isrMonitorEntry = ISR_MONITOR_Enter();     \
+        handler();                                          \
+        ISR_MONITOR_Exit((source), isrMonitorEntry);        \
+    } while (false)
+#else
+#define ISR_MONITOR_VECTOR(source, handler)     handler()
+#endif
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif // ISR_MONITOR_H
@@ -50,12 +50,18 @@
 #include <string.h>
 #include <stdio.h>
 #include "definitions.h"                // SYS function prototypes
+#include "interrupts.h"
+#include "profiler.h"
 
 static uint8_t txBuffer[50];
 static uint8_t rxBuffer[10];
 volatile static uint32_t nBytesRead = 0;
 volatile static bool txThresholdEventReceived = false;
 volatile static bool rxThresholdEventReceived = false;
+#if (PROFILER_ENABLED == 1)
+static PROFILER_SECTION readCallbackSection;
+static PROFILER_SECTION echoSection;
+#endif
 
 // *****************************************************************************
 // *****************************************************************************
@@ -66,6 +72,9 @@ volatile static bool rxThresholdEventReceived = false;
 void usartReadEventHandler(UART_EVENT event, uintptr_t context )
 {
     uint32_t nBytesAvailable = 0;
+#if (PROFILER_ENABLED == 1)
+    uint32_t begin = PROFILER_Begin();
+#endif
     
     if (event == UART_EVENT_READ_THRESHOLD_REACHED)
     {
@@ -74,6 +83,9 @@ void usartReadEventHandler(UART_EVENT event, uintptr_t context )
         
         nBytesRead += UART3_Read((uint8_t*)&rxBuffer[nBytesRead], nBytesAvailable);                          
     }
+#if (PROFILER_ENABLED == 1)
+    PROFILER_End(readCallbackSection, begin);
+#endif
 }
 
 void usartWriteEventHandler(UART_EVENT event, uintptr_t context )
@@ -84,9 +96,24 @@ void usartWriteEventHandler(UART_EVENT event, uintptr_t context )
 int main ( void )
 {
     uint32_t nBytes = 0;        
+#if (PROFILER_ENABLED == 1)
+    uint32_t begin;
+#endif
     
     /* Initialize all modules */
     SYS_Initialize ( NULL );          
+
+#if (PROFILER_ENABLED == 1)
+    /* The SCCP1 free running timer measures the sections */
+    PROFILER_Initialize();
+    U3RX_ProfilerSection = PROFILER_SectionCreate("U3RX handler");
+    readCallbackSection = PROFILER_SectionCreate("read callback");
+    echoSection = PROFILER_SectionCreate("echo");
+#endif
+#if (ISR_MONITOR_ENABLED == 1)
+    /* The vectors of interrupts.c report to the interrupt monitor */
+    ISR_MONITOR_Initialize();
+#endif
     
     /* Register a callback for write events */
     UART3_WriteCallbackRegister(usartWriteEventHandler, (uintptr_t) NULL);
@@ -155,10 +182,24 @@ int main ( void )
         /* Wait until at-least 10 characters are entered by the user */
         while (nBytesRead < 10);    
     
+#if (PROFILER_ENABLED == 1)
+        begin = PROFILER_Begin();
+#endif
         /* Echo the received data */
         UART3_Write((uint8_t*)rxBuffer, nBytesRead);
         
         UART3_Write((uint8_t*)"\r\n>", 3);
+#if (PROFILER_ENABLED == 1)
+        PROFILER_End(echoSection, begin);
+
+        /* Send the profile frame to the host */
+        PROFILER_Export(UART3_Write);
+#endif
+#if (ISR_MONITOR_ENABLED == 1)
+        /* Print the interrupt load since the last echo */
+        ISR_MONITOR_Dump(UART3_Write);
+        ISR_MONITOR_Reset();
+#endif
 
         nBytesRead = 0;
     }
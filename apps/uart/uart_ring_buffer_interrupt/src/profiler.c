@@ -0,0 +1,348 @@
+/*******************************************************************************
+  Profiler Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    profiler.c
+
+  Summary:
+    Code section profiler on the SCCP1 free running timer.
+
+  Description:
+    Each section is updated by its end marker and read through a sequence
+    counter, without disabling interrupts.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// Section: Included Files
+
+#include <stddef.h>
+#include <string.h>
+#include "definitions.h"
+#include "profiler.h"
+
+// Section: Local Objects
+
+/* Number of empty sections measured at initialization */
+#define PROFILER_CALIBRATION_RUNS   (8U)
+
+/* Reads of a section before PROFILER_StatisticsGet gives up, the writer of a
+   section preempted by the reader never completes while the reader spins */
+#define PROFILER_READ_RETRIES       (16U)
+
+/* Size of a section record in the export frame, without the name */
+#define PROFILER_RECORD_SIZE        (2U + (4U * 4U) + (4U * PROFILER_HISTOGRAM_BINS))
+
+typedef struct
+{
+    const char*         name;
+
+    /* Odd while the section is updated */
+    volatile uint32_t   sequence;
+
+    uint32_t            count;
+
+    uint32_t            min;
+
+    uint32_t            max;
+
+    uint64_t            total;
+
+    uint32_t            histogram[PROFILER_HISTOGRAM_BINS];
+
+} PROFILER_SECTION_DATA;
+
+static PROFILER_SECTION_DATA profilerSections[PROFILER_SECTIONS_MAX];
+static uint32_t profilerSectionCount = 0U;
+
+/* Cost of an empty section in counts */
+static uint32_t profilerOverhead = 0U;
+
+// Section: Local Functions
+
+static uint32_t PROFILER_HistogramBin(uint32_t duration)
+{
+    uint32_t bin = 0U;
+
+    if (duration != 0U)
+    {
+        bin = 31U - (uint32_t)__builtin_clz(duration);
+    }
+
+    return (bin < PROFILER_HISTOGRAM_BINS) ? bin : (PROFILER_HISTOGRAM_BINS - 1U);
+}
+
+static void PROFILER_SectionClear(PROFILER_SECTION_DATA* data)
+{
+    uint32_t bin;
+
+    data->sequence++;
+
+    data->count = 0U;
+    data->min = 0xFFFFFFFFU;
+    data->max = 0U;
+    data->total = 0U;
+
+    for (bin = 0U; bin < PROFILER_HISTOGRAM_BINS; bin++)
+    {
+        data->histogram[bin] = 0U;
+    }
+
+    data->sequence++;
+}
+
+static uint32_t PROFILER_Put32(uint8_t* buffer, uint32_t value)
+{
+    buffer[0] = (uint8_t)value;
+    buffer[1] = (uint8_t)(value >> 8);
+    buffer[2] = (uint8_t)(value >> 16);
+    buffer[3] = (uint8_t)(value >> 24);
+
+    return 4U;
+}
+
+/* Writes all the bytes and adds them to the checksum */
+static void PROFILER_WriteAll(PROFILER_WRITE write, uint8_t* buffer, uint32_t size, uint8_t* checksum)
+{
+    uint32_t index;
+    uint32_t written = 0U;
+
+    for (index = 0U; index < size; index++)
+    {
+        *checksum += buffer[index];
+    }
+
+    while (written < size)
+    {
+        written += (uint32_t)write(&buffer[written], size - written);
+    }
+}
+
+// Section: Profiler Implementation
+
+void PROFILER_Initialize(void)
+{
+    uint32_t run;
+    uint32_t begin;
+    uint32_t duration;
+
+    profilerSectionCount = 0U;
+    profilerOverhead = 0xFFFFFFFFU;
+
+    SCCP1_TimerStart();
+
+    /* Same sequence as a marker pair around an empty section */
+    for (run = 0U; run < PROFILER_CALIBRATION_RUNS; run++)
+    {
+        begin = PROFILER_Begin();
+        duration = SCCP1_Timer32bitCounterGet() - begin;
+
+        if (duration < profilerOverhead)
+        {
+            profilerOverhead = duration;
+        }
+    }
+}
+
+PROFILER_SECTION PROFILER_SectionCreate(const char* name)
+{
+    PROFILER_SECTION section = PROFILER_SECTION_INVALID;
+
+    if (profilerSectionCount < PROFILER_SECTIONS_MAX)
+    {
+        section = (PROFILER_SECTION)profilerSectionCount;
+        profilerSections[section].name = name;
+        PROFILER_SectionClear(&profilerSections[section]);
+        profilerSectionCount++;
+    }
+
+    return section;
+}
+
+uint32_t PROFILER_Begin(void)
+{
+    return SCCP1_Timer32bitCounterGet();
+}
+
+void PROFILER_End(PROFILER_SECTION section, uint32_t begin)
+{
+    uint32_t duration = SCCP1_Timer32bitCounterGet() - begin;
+    PROFILER_SECTION_DATA* data;
+
+    if (section >= profilerSectionCount)
+    {
+        return;
+    }
+
+    data = &profilerSections[section];
+    duration = (duration > profilerOverhead) ? (duration - profilerOverhead) : 0U;
+
+    data->sequence++;
+
+    data->count++;
+    data->total += duration;
+
+    if (duration < data->min)
+    {
+        data->min = duration;
+    }
+    if (duration > data->max)
+    {
+        data->max = duration;
+    }
+
+    data->histogram[PROFILER_HistogramBin(duration)]++;
+
+    data->sequence++;
+}
+
+bool PROFILER_StatisticsGet(PROFILER_SECTION section, PROFILER_STATISTICS* stats)
+{
+    PROFILER_SECTION_DATA* data;
+    uint32_t sequence;
+    uint32_t retries = 0U;
+    bool isConsistent = false;
+    uint64_t total = 0U;
+    uint32_t bin;
+
+    if (section >= profilerSectionCount)
+    {
+        return false;
+    }
+
+    data = &profilerSections[section];
+
+    while ((isConsistent == false) && (retries < PROFILER_READ_RETRIES))
+    {
+        retries++;
+
+        /* Odd while the writer is updating the section */
+        sequence = data->sequence;
+        if ((sequence & 1U) != 0U)
+        {
+            continue;
+        }
+
+        stats->count = data->count;
+        stats->min = data->min;
+        stats->max = data->max;
+        total = data->total;
+
+        for (bin = 0U; bin < PROFILER_HISTOGRAM_BINS; bin++)
+        {
+            stats->histogram[bin] = data->histogram[bin];
+        }
+
+        isConsistent = (sequence == data->sequence);
+    }
+
+    if (isConsistent == false)
+    {
+        return false;
+    }
+
+    stats->name = data->name;
+
+    if (stats->count == 0U)
+    {
+        stats->min = 0U;
+        stats->mean = 0U;
+    }
+    else
+    {
+        stats->mean = (uint32_t)(total / stats->count);
+    }
+
+    return true;
+}
+
+void PROFILER_Reset(void)
+{
+    uint32_t section;
+
+    for (section = 0U; section < profilerSectionCount; section++)
+    {
+        PROFILER_SectionClear(&profilerSections[section]);
+    }
+}
+
+void PROFILER_Export(PROFILER_WRITE write)
+{
+    uint8_t record[PROFILER_RECORD_SIZE];
+    PROFILER_STATISTICS stats;
+    uint8_t checksum = 0U;
+    uint32_t section;
+    uint32_t length;
+    uint32_t size;
+    uint32_t bin;
+
+    record[0] = (uint8_t)'P';
+    record[1] = (uint8_t)'F';
+    record[2] = PROFILER_FRAME_VERSION;
+    record[3] = (uint8_t)profilerSectionCount;
+    size = 4U;
+    size += PROFILER_Put32(&record[size], SCCP1_TimerFrequencyGet());
+    size += PROFILER_Put32(&record[size], profilerOverhead);
+    PROFILER_WriteAll(write, record, size, &checksum);
+
+    for (section = 0U; section < profilerSectionCount; section++)
+    {
+        if (PROFILER_StatisticsGet((PROFILER_SECTION)section, &stats) == false)
+        {
+            /* Section busy, exported empty */
+            (void)memset(&stats, 0, sizeof(stats));
+            stats.name = profilerSections[section].name;
+        }
+
+        length = 0U;
+        while ((length < PROFILER_NAME_LENGTH_MAX) && (stats.name[length] != '\0'))
+        {
+            length++;
+        }
+
+        record[0] = (uint8_t)section;
+        record[1] = (uint8_t)length;
+        PROFILER_WriteAll(write, record, 2U, &checksum);
+        PROFILER_WriteAll(write, (uint8_t*)stats.name, length, &checksum);
+
+        size = 0U;
+        size += PROFILER_Put32(&record[size], stats.count);
+        size += PROFILER_Put32(&record[size], stats.min);
+        size += PROFILER_Put32(&record[size], stats.max);
+        size += PROFILER_Put32(&record[size], stats.mean);
+
+        for (bin = 0U; bin < PROFILER_HISTOGRAM_BINS; bin++)
+        {
+            size += PROFILER_Put32(&record[size], stats.histogram[bin]);
+        }
+
+        PROFILER_WriteAll(write, record, size, &checksum);
+    }
+
+    record[0] = (uint8_t)(0U - checksum);
+    PROFILER_WriteAll(write, record, 1U, &checksum);
+}
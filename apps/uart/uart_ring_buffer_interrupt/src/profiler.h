@@ -0,0 +1,194 @@
+/*******************************************************************************
+  Profiler Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    profiler.h
+
+  Summary:
+    Code section profiler on the SCCP1 free running timer.
+
+  Description:
+    A section is measured between a begin and an end marker, in SCCP1 time
+    base counts. Each section keeps its count, minimum, maximum, mean and a
+    histogram of the durations in a static table, which is exported in a
+    compact binary frame, for instance over the UART.
+
+    A marker reads the timer and updates a few counters, so the sections can
+    stay instrumented in production builds. The cost of the markers themselves
+    is measured at initialization and subtracted from each duration.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+// Section: Included Files
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// Section: Data Types
+
+/* Set to 1 to profile the UART3 receive handler, the read callback and the
+   echo of the demo, and to export the profile in binary after each echo */
+#define PROFILER_ENABLED            (0)
+
+/* Number of sections in the table */
+#define PROFILER_SECTIONS_MAX       (8U)
+
+/* Histogram bin k counts the durations from 2^k to 2^(k+1) - 1, the first bin
+   also counts 0 and the last bin counts all the longer durations */
+#define PROFILER_HISTOGRAM_BINS     (16U)
+
+/* Longest section name in the export frame */
+#define PROFILER_NAME_LENGTH_MAX    (16U)
+
+/* Returned when the table is full */
+#define PROFILER_SECTION_INVALID    (0xFFU)
+
+/* Export frame format version */
+#define PROFILER_FRAME_VERSION      (1U)
+
+/**
+ @brief    Section handle
+*/
+typedef uint8_t PROFILER_SECTION;
+
+/**
+ @brief    Function writing the export frame, UART3_Write for instance. It
+           returns the number of bytes accepted.
+*/
+typedef size_t (*PROFILER_WRITE)(uint8_t* buffer, const size_t size);
+
+/**
+ @struct   PROFILER_STATISTICS
+ @brief    Statistics of a section, durations in SCCP1 time base counts
+*/
+typedef struct
+{
+    const char*             name;
+
+    /* Number of measurements */
+    uint32_t                count;
+
+    uint32_t                min;
+
+    uint32_t                max;
+
+    uint32_t                mean;
+
+    uint32_t                histogram[PROFILER_HISTOGRAM_BINS];
+
+} PROFILER_STATISTICS;
+
+// Section: Interface Functions
+
+/**
+ * @brief      Clears the table and starts the SCCP1 timer.
+ * @details    The SCCP1 timer must be initialized as a free running 32-bit
+ *             timer. The cost of an empty section is measured here.
+ * @return     none
+ */
+void PROFILER_Initialize(void);
+
+/**
+ * @brief      Adds a section to the table.
+ * @param[in]  name - Section name, the string must remain valid
+ * @return     Section handle, or PROFILER_SECTION_INVALID when the table is full
+ */
+PROFILER_SECTION PROFILER_SectionCreate(const char* name);
+
+/**
+ * @brief      Begin marker.
+ * @return     Timestamp to pass to PROFILER_End
+ */
+uint32_t PROFILER_Begin(void);
+
+/**
+ * @brief      End marker, adds the duration since the begin marker to a section.
+ * @details    Sections can be nested and used from interrupts, as long as a
+ *             section is always ended from the same interrupt priority level.
+ * @param[in]  section - Section handle
+ * @param[in]  begin   - Timestamp returned by PROFILER_Begin
+ * @return     none
+ */
+void PROFILER_End(PROFILER_SECTION section, uint32_t begin);
+
+/**
+ * @brief      Reads the statistics of a section.
+ * @details    The section is read again when it was updated during the copy,
+ *             interrupts are never disabled. The number of reads is bounded:
+ *             called from an interrupt that preempted PROFILER_End on the same
+ *             section, the function returns false instead of waiting for an
+ *             update that cannot complete.
+ * @param[in]  section - Section handle
+ * @param[out] stats   - Statistics
+ * @return     true  - stats holds the statistics
+ * @return     false - Invalid section, or section still being updated
+ */
+bool PROFILER_StatisticsGet(PROFILER_SECTION section, PROFILER_STATISTICS* stats);
+
+/**
+ * @brief      Clears the statistics of all the sections, the sections are kept.
+ * @return     none
+ */
+void PROFILER_Reset(void);
+
+/**
+ * @brief      Writes all the sections in a binary frame.
+ * @details    All the fields are little endian:
+ *             - 'P', 'F', version, number of sections, timer frequency in Hz
+ *               (4 bytes), marker cost in counts (4 bytes)
+ *             - for each section: index, name length, name, count, min, max,
+ *               mean (4 bytes each), PROFILER_HISTOGRAM_BINS bins (4 bytes each)
+ *             - checksum, the two's complement of the sum of all the bytes
+ *             A section that cannot be read is exported with zero counts.
+ *             The function waits until write accepts all the bytes.
+ * @param[in]  write - Function writing the frame
+ * @return     none
+ */
+void PROFILER_Export(PROFILER_WRITE write);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif // PROFILER_H